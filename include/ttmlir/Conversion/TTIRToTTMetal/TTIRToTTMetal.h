@@ -10,12 +10,22 @@
 
 namespace mlir::tt {
 
+namespace ttir {
+#define GEN_PASS_DECL_CONVERTTTIRTOTTMETAL
+#include "ttmlir/Conversion/Passes.h.inc"
+} // namespace ttir
+
 void populateTTIRToTTMetalPatterns(MLIRContext *ctx,
                                    RewritePatternSet &patterns,
-                                   TypeConverter &typeConverter);
+                                   TypeConverter &typeConverter,
+                                   unsigned numStreamBuffers = 1,
+                                   bool enableMulticast = false);
 
 std::unique_ptr<OperationPass<ModuleOp>> createConvertTTIRToTTMetalPass();
 
+std::unique_ptr<OperationPass<ModuleOp>> createConvertTTIRToTTMetalPass(
+    const ttir::ConvertTTIRToTTMetalOptions &options);
+
 } // namespace mlir::tt
 
 #endif // TTMLIR_CONVERSION_TTIRTOTTMETAL_TTIRTOTTMETAL_H
@@ -99,7 +99,7 @@ inline DataType elementTypeToDataType(Type elementType) {
   } else if (isa<IntegerType>(elementType)) {
     auto intType = mlir::cast<IntegerType>(elementType);
     if (intType.getWidth() == 32) {
-      dtype = DataType::UInt32;
+      dtype = intType.isSigned() ? DataType::Int32 : DataType::UInt32;
     } else if (intType.getWidth() == 16) {
       dtype = DataType::UInt16;
     } else if (intType.getWidth() == 8) {
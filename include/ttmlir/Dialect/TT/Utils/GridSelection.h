@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TTMLIR_DIALECT_TT_UTILS_GRIDSELECTION_H
+#define TTMLIR_DIALECT_TT_UTILS_GRIDSELECTION_H
+
+#include "ttmlir/Dialect/TT/IR/TTOpsTypes.h"
+
+#include "llvm/ADT/SmallVector.h"
+
+#include <algorithm>
+
+namespace mlir::tt::utils {
+
+/// Returns the largest number of cores, at most \p maxCores, that \p numTiles
+/// tiles can be split across evenly.
+inline int64_t getLargestEvenSplit(int64_t numTiles, int64_t maxCores) {
+  for (int64_t cores = std::min(numTiles, maxCores); cores > 1; --cores) {
+    if (numTiles % cores == 0) {
+      return cores;
+    }
+  }
+  return 1;
+}
+
+/// Selects the grid a tensor without an explicit layout is sharded onto.
+///
+/// The tensor is collapsed onto the rank of the worker grid and each collapsed
+/// dimension is spread over as many cores as evenly divide its tile count, so
+/// every core holds a whole number of tiles and the per-core L1 footprint is
+/// as small as the worker grid allows. Dimensions that are not tile aligned
+/// stay on a single core.
+///
+/// The selection depends on the tensor shape only: tensors of equal shape
+/// always land on the same grid, which lets producer/consumer chains of
+/// eltwise ops alias their shards instead of relayouting between them.
+///
+/// \param type The tensor type to select a grid for.
+/// \param workerGrid The worker grid of the device.
+/// \returns A grid of the same rank as \p workerGrid.
+inline GridAttr selectTensorGrid(MLIRContext *ctx, RankedTensorType type,
+                                 GridAttr workerGrid) {
+  ArrayRef<int64_t> workerGridShape = workerGrid.getShape();
+  const int64_t gridRank = workerGridShape.size();
+  auto singleCoreLayout = MetalLayoutAttr::get(ctx, type, MemorySpace::System,
+                                               GridAttr::get(ctx, gridRank));
+  llvm::SmallVector<int64_t> physicalShape =
+      singleCoreLayout.getPhysicalShape(type.getShape());
+  ArrayRef<int64_t> tileShape =
+      TileType::get(ctx, type.getElementType()).getShape();
+  const int64_t tileRank = tileShape.size();
+
+  llvm::SmallVector<int64_t> gridShape(gridRank, 1);
+  for (int64_t i = std::max<int64_t>(0, gridRank - tileRank); i < gridRank;
+       ++i) {
+    int64_t tileDim = tileShape[i - (gridRank - tileRank)];
+    if (physicalShape[i] % tileDim != 0) {
+      continue;
+    }
+    gridShape[i] =
+        getLargestEvenSplit(physicalShape[i] / tileDim, workerGridShape[i]);
+  }
+  return GridAttr::get(ctx, gridShape);
+}
+
+} // namespace mlir::tt::utils
+
+#endif // TTMLIR_DIALECT_TT_UTILS_GRIDSELECTION_H
@@ -0,0 +1,19 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TTMLIR_DIALECT_TTIR_PIPELINES_PASSES_H
+#define TTMLIR_DIALECT_TTIR_PIPELINES_PASSES_H
+
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/Pass/Pass.h"
+
+namespace mlir::tt::ttir {
+#define GEN_PASS_DECL
+#include "ttmlir/Dialect/TTIR/Pipelines/Passes.h.inc"
+
+#define GEN_PASS_REGISTRATION
+#include "ttmlir/Dialect/TTIR/Pipelines/Passes.h.inc"
+} // namespace mlir::tt::ttir
+
+#endif
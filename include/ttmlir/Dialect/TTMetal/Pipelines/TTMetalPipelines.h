@@ -30,6 +30,33 @@ struct TTIRToTTMetalBackendPipelineOptions
       *this, "version",
       llvm::cl::desc("Select pipeline implementation version (default: 0)."),
       llvm::cl::init(0)};
+
+  // Number of tile row blocks each streamed circular buffer is split into.
+  // Values greater than 1 overlap NoC reads with compute.
+  //
+  Option<unsigned> numStreamBuffers{
+      *this, "num-stream-buffers",
+      llvm::cl::desc("Number of buffers per streamed circular buffer "
+                     "(default: 1, no pipelining)."),
+      llvm::cl::init(1)};
+
+  // Read tiles that several cores of a generic op need only once and multicast
+  // them to the other cores.
+  //
+  Option<bool> enableMulticast{
+      *this, "enable-multicast",
+      llvm::cl::desc("Multicast operand tiles shared by a row or column of "
+                     "cores (default: false)."),
+      llvm::cl::init(false)};
+
+  // Shard tensors without a layout across the worker grid instead of placing
+  // them on a single core.
+  //
+  Option<bool> selectGrid{
+      *this, "select-grid",
+      llvm::cl::desc("Shard tensors without a layout across the worker grid "
+                     "(default: false)."),
+      llvm::cl::init(false)};
 };
 
 void createTTIRToTTMetalBackendPipeline(
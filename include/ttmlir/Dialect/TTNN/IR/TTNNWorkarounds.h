@@ -226,6 +226,14 @@ public:
   // Create workarounds for upsample op operands.
   static TTNNOperandsWorkarounds createUpsampleOpOperandsWorkarounds();
 
+  // Create workarounds for paged update cache op operands.
+  static TTNNOperandsWorkarounds createPagedUpdateCacheOpOperandsWorkarounds();
+
+  // Create workarounds for paged scaled dot product attention decode op
+  // operands.
+  static TTNNOperandsWorkarounds
+  createPagedScaledDotProductAttentionDecodeOpOperandsWorkarounds();
+
   static TTNNOperandsWorkarounds
   createCumSumOpOperandsWorkarounds(RankedTensorType inputType);
 
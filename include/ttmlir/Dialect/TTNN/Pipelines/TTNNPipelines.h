@@ -120,6 +120,15 @@ struct TTIRToTTNNBackendPipelineOptions
       *this, OptionNames::meshShape,
       llvm::cl::desc("Set the multi-device mesh shape.")};
 
+  // Option to partition the program over the mesh, starting from the
+  // `ttir.shard_dims` sharding seeds on the function arguments.
+  //
+  Option<bool> automaticShardingEnabled{
+      *this, "enable-automatic-sharding",
+      llvm::cl::desc("Propagate argument sharding seeds through the program "
+                     "and insert the collectives it needs."),
+      llvm::cl::init(false)};
+
   Option<bool> rowMajorEnabled{
       *this, "row-major-enabled",
       llvm::cl::desc(
@@ -146,12 +155,64 @@ struct TTIRToTTNNBackendPipelineOptions
       *this, "enable-implicit-broadcast-folding-pass",
       llvm::cl::desc("Enable implicit broadcast folding pass."),
       llvm::cl::init(true)};
+
+  // Option to evaluate constant-only subgraphs on host at compile time, via
+  // the TTIR -> Linalg -> LLVM path.
+  //
+  Option<bool> hostConstEvalEnabled{
+      *this, "enable-host-const-eval",
+      llvm::cl::desc("Enable compile time host evaluation of constant-only "
+                     "subgraphs."),
+      llvm::cl::init(false)};
+
+  // Option to remove the layout conversions that undo each other or repeat
+  // one another once ToLayoutOps are decomposed.
+  //
+  Option<bool> layoutConversionEliminationEnabled{
+      *this, "enable-layout-conversion-elimination",
+      llvm::cl::desc("Eliminate redundant layout conversions."),
+      llvm::cl::init(true)};
+
+  // Option to fuse the decomposed softmax and attention subgraphs frontends
+  // produce into the fused TTIR ops.
+  //
+  Option<bool> attentionFusionEnabled{
+      *this, "enable-attention-fusion",
+      llvm::cl::desc("Fuse decomposed softmax and scaled dot product "
+                     "attention subgraphs."),
+      llvm::cl::init(false)};
+
+  // Option to specialize functions with dynamic dimensions for the given
+  // sizes, producing one program per size that the runtime picks from by
+  // the shapes of the inputs.
+  //
+  ListOption<int64_t> shapeBuckets{
+      *this, "shape-buckets",
+      llvm::cl::desc("Specialize dynamic dimensions for these bucket sizes.")};
 };
 
 // TTIR to EmitC pipeline options.
 // Inherit from TTIRToTTNNBackendPipelineOptions to reuse the options.
 //
-struct TTIRToEmitCPipelineOptions : public TTIRToTTNNBackendPipelineOptions {};
+struct TTIRToEmitCPipelineOptions : public TTIRToTTNNBackendPipelineOptions {
+  // Option to split each forward function into an init function, run once,
+  // and a run function that reuses its buffers, instead of generating a main
+  // that runs every forward function once.
+  //
+  Option<bool> modelEntryPointsEnabled{
+      *this, "enable-model-entry-points",
+      llvm::cl::desc("Create init and run entry points for each forward "
+                     "function, and a main that benchmarks them."),
+      llvm::cl::init(false)};
+
+  // Number of timed runs of each forward function in the generated main when
+  // model entry points are enabled.
+  //
+  Option<int32_t> benchmarkIterations{
+      *this, "benchmark-iterations",
+      llvm::cl::desc("Number of timed runs of each model in main."),
+      llvm::cl::init(10)};
+};
 
 void createTTNNPipelineTTIRPasses(
     OpPassManager &pm, const TTIRToTTNNBackendPipelineOptions &options);
@@ -5,6 +5,7 @@
 #ifndef TTMLIR_DIALECT_TTNN_TRANSFORMS_PASSES_H
 #define TTMLIR_DIALECT_TTNN_TRANSFORMS_PASSES_H
 
+#include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/IR/BuiltinOps.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Pass/PassManager.h"
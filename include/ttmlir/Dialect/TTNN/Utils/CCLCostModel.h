@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TTMLIR_DIALECT_TTNN_UTILS_CCLCOSTMODEL_H
+#define TTMLIR_DIALECT_TTNN_UTILS_CCLCOSTMODEL_H
+
+#include "ttmlir/Dialect/TTNN/IR/TTNNOpsAttrs.h"
+
+#include "llvm/ADT/ArrayRef.h"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace mlir::tt::ttnn::utils {
+
+// Alpha-beta model of collectives on a mesh of chips connected by ethernet
+// links. An all_reduce over p devices is costed as a reduce_scatter followed
+// by an all_gather:
+//
+//   line: 2 * (p - 1) hops and 2 * (p - 1) / p of the tensor over the
+//         busiest link.
+//   ring: bidirectional, so half the steps and half the traffic of a line,
+//         but unless the mesh axis has wraparound links the closing hop is
+//         routed back across the p - 1 links of the axis on every step.
+//
+// Small tensors are latency bound and prefer lines, large ones are bandwidth
+// bound and prefer rings.
+struct CCLCostModel {
+  // Latency of a single hop between neighbouring chips, in microseconds.
+  double hopLatencyUs = 1.0;
+  // Bandwidth of a link in one direction, in bytes per microsecond.
+  double linkBandwidthBytesPerUs = 12500.0;
+  // Whether the two ends of each mesh axis are linked directly.
+  bool hasWraparoundLinks = false;
+
+  // Cost of an all_reduce of `tensorBytes` over `numDevices` devices in the
+  // given topology, in microseconds.
+  double getAllReduceCostUs(Topology topology, int64_t numDevices,
+                            int64_t tensorBytes) const;
+};
+
+enum class AllReduceAlgorithm {
+  // A single reduce_scatter/all_gather pair along one mesh axis over a line.
+  Line,
+  // A single reduce_scatter/all_gather pair along one mesh axis over a ring.
+  Ring,
+  // Reduce scattered along mesh axis 1 first and along axis 0 second, then
+  // gathered back in reverse order. Used for reductions over a whole 2D mesh.
+  Torus2D,
+};
+
+struct AllReduceLowering {
+  AllReduceAlgorithm algorithm;
+  // Mesh axis reduced along by Line and Ring.
+  int32_t clusterAxis = 1;
+  // Topology of the collectives along each mesh axis, indexed by axis.
+  std::array<Topology, 2> axisTopology = {Topology::Linear, Topology::Linear};
+  double costUs = 0.0;
+};
+
+// Picks the cheapest lowering of an all_reduce of `tensorBytes` over
+// `numDevices` devices along `clusterAxis` of a mesh of `meshShape` devices.
+// An unset `clusterAxis` reduces over the whole mesh.
+AllReduceLowering selectAllReduceLowering(const CCLCostModel &costModel,
+                                          llvm::ArrayRef<int64_t> meshShape,
+                                          std::optional<int32_t> clusterAxis,
+                                          int64_t numDevices,
+                                          int64_t tensorBytes);
+
+} // namespace mlir::tt::ttnn::utils
+
+#endif // TTMLIR_DIALECT_TTNN_UTILS_CCLCOSTMODEL_H
@@ -25,6 +25,11 @@ createToLayoutOp(mlir::Operation *op,
                  BufferType targetTensorBufferType,
                  std::optional<TensorMemoryLayout> targetTensorMemoryLayout,
                  DataType targetTensorDataType);
+
+// Helper method to create an EmptyOp of the given type on the given device.
+// Its shape, data type, layout and memory config are taken from the type.
+EmptyOp createEmptyOp(PatternRewriter &rewriter, Location loc,
+                      RankedTensorType type, Value device);
 } // namespace mlir::tt::ttnn::utils
 
 #endif
@@ -16,6 +16,17 @@
 
 namespace mlir::tt::ttnn::utils {
 
+// Unit attribute marking the run entry point of a model created by
+// TTNNCreateModelEntryPoints.
+//
+inline constexpr char kModelRunAttrName[] = "ttnn.model_run";
+
+// Attribute holding the number of timed runs of the model run entry points
+// called from a benchmark driver function.
+//
+inline constexpr char kBenchmarkIterationsAttrName[] =
+    "ttnn.benchmark_iterations";
+
 // Map tt::MemorySpace to ttnn::BufferType
 //
 mlir::tt::ttnn::BufferType
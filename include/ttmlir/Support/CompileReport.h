@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TTMLIR_SUPPORT_COMPILEREPORT_H
+#define TTMLIR_SUPPORT_COMPILEREPORT_H
+
+#include "mlir/Pass/PassInstrumentation.h"
+#include "mlir/Support/LogicalResult.h"
+#include "llvm/ADT/StringRef.h"
+
+#include <cstdint>
+#include <memory>
+
+// The compile report collects the wall time of every pass and analysis along
+// with counters of the work they did (layouts considered, op model queries,
+// bytes serialized, ...) and writes them out as JSON. Tracking a compile-time
+// regression down to the pass or the analysis that caused it only needs two
+// reports of the same module.
+//
+// MLIR pass statistics cover part of this, but they are compiled out of
+// release builds of LLVM, which are the builds worth measuring.
+namespace mlir::tt::compile_report {
+
+// Starts collecting timings and counters. Until this is called, recording is
+// a no-op, so passes can record their work unconditionally.
+void enable();
+
+bool isEnabled();
+
+// Adds `value` to the counter `name`. Counters are named
+// "<pass or analysis>.<quantity>", e.g. "shard-solver.resolve-iterations".
+void addCounter(llvm::StringRef name, uint64_t value = 1);
+
+// Creates an instrumentation that records the wall time of every pass and
+// analysis run by the pass manager it is added to. Times of passes running on
+// several functions in parallel are summed over all of them.
+std::unique_ptr<PassInstrumentation> createTimingInstrumentation();
+
+// Writes everything collected since `enable()` as JSON to `path`.
+LogicalResult writeReport(llvm::StringRef path);
+
+} // namespace mlir::tt::compile_report
+
+#endif // TTMLIR_SUPPORT_COMPILEREPORT_H
@@ -12,10 +12,17 @@
 namespace mlir::tt::ttnn {
 
 // Convert a TTNNIR operation to a flatbuffer
+// If debugInfoSidecar is given, the debug info (MLIR, C++ and goldens) is
+// serialized into it as a separate TTNNDebugInfo buffer and the returned
+// binary is stripped of it.
+// If compactLocations is set, ops store the ID of their location in a table
+// of the debug info instead of the printed location.
 std::shared_ptr<void> ttnnToFlatbuffer(
     Operation *op,
     const std::unordered_map<std::string, GoldenTensor> &goldenMap = {},
-    const std::vector<std::pair<std::string, std::string>> &moduleCache = {});
+    const std::vector<std::pair<std::string, std::string>> &moduleCache = {},
+    std::shared_ptr<void> *debugInfoSidecar = nullptr,
+    bool compactLocations = false, bool internDescs = true);
 
 // Convert a TTNNIR operation to a flatbuffer
 // This function signature is required in order to register the conversion in
@@ -23,7 +30,9 @@ std::shared_ptr<void> ttnnToFlatbuffer(
 LogicalResult translateTTNNToFlatbuffer(
     Operation *op, llvm::raw_ostream &os,
     const std::unordered_map<std::string, GoldenTensor> &goldenMap = {},
-    const std::vector<std::pair<std::string, std::string>> &moduleCache = {});
+    const std::vector<std::pair<std::string, std::string>> &moduleCache = {},
+    llvm::raw_ostream *debugInfoOs = nullptr, bool compactLocations = false,
+    bool internDescs = true);
 } // namespace mlir::tt::ttnn
 
 #endif
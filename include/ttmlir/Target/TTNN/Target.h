@@ -13,6 +13,7 @@
 #include "ttmlir/Target/Common/types_generated.h"
 #include "ttmlir/Target/Common/version_generated.h"
 #include "ttmlir/Target/TTNN/binary_generated.h"
+#include "ttmlir/Target/TTNN/debug_info_generated.h"
 
 #pragma clang diagnostic pop
 
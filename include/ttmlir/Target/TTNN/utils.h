@@ -80,6 +80,8 @@ toTargetTensorLayout(::mlir::tt::ttnn::Layout layout) {
     return ::tt::target::DataType::UInt8;
   case ::mlir::tt::DataType::UInt16:
     return ::tt::target::DataType::UInt16;
+  case ::mlir::tt::DataType::Int32:
+    return ::tt::target::DataType::Int32;
   case ::mlir::tt::DataType::Float16:
   case ::mlir::tt::DataType::BFP_Float2:
   case ::mlir::tt::DataType::BFP_Float4:
@@ -6,13 +6,60 @@
 #define TTMLIR_TARGET_UTILS_FLATBUFFEROBJECTCACHE_H
 
 #include "flatbuffers/flatbuffers.h"
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
+
+#include <string>
+#include <type_traits>
 
 namespace mlir::tt {
 
+// Content key of a table interned with FlatbufferObjectCache::intern, built
+// from the table name followed by the raw bytes of its fields. Nested tables
+// are keyed by their (interned) offsets.
+class FlatbufferInternKey {
+public:
+  explicit FlatbufferInternKey(llvm::StringRef tableName)
+      : key(tableName.str()) {
+    key.push_back('\0');
+  }
+
+  template <typename T>
+  FlatbufferInternKey &add(const T &value) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "only trivially copyable fields can be interned");
+    key.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    return *this;
+  }
+
+  template <typename T>
+  FlatbufferInternKey &add(llvm::ArrayRef<T> values) {
+    add(values.size());
+    for (const T &value : values) {
+      add(value);
+    }
+    return *this;
+  }
+
+  template <typename T>
+  FlatbufferInternKey &add(::flatbuffers::Offset<T> offset) {
+    return add(offset.o);
+  }
+
+  llvm::StringRef str() const { return key; }
+
+private:
+  std::string key;
+};
+
 struct FlatbufferObjectCache {
   ::flatbuffers::FlatBufferBuilder *fbb;
   DenseMap<void const *, ::flatbuffers::uoffset_t> objectMap;
+  llvm::StringMap<::flatbuffers::uoffset_t> internMap;
+  // intern() only deduplicates tables while this is set.
+  bool internEnabled = true;
   uint32_t global_id = 1; // 0 is reserved for null
 
   FlatbufferObjectCache(::flatbuffers::FlatBufferBuilder *fbb) : fbb(fbb) {}
@@ -58,6 +105,24 @@ struct FlatbufferObjectCache {
     }
     return insert(obj, createFn(*this, obj, args...));
   }
+
+  // Returns the table created by `createFn` the first time `key` was seen.
+  // Unlike getOrCreate this deduplicates tables built from distinct MLIR
+  // objects, e.g. layouts that only differ in fields that aren't serialized.
+  template <typename SchemaType, typename CreateFn>
+  flatbuffers::Offset<SchemaType> intern(const FlatbufferInternKey &key,
+                                         CreateFn createFn) {
+    if (!internEnabled) {
+      return createFn();
+    }
+    if (auto it = internMap.find(key.str()); it != internMap.end()) {
+      return flatbuffers::Offset<SchemaType>(it->second);
+    }
+    // createFn may intern nested tables, so only insert once it returns.
+    flatbuffers::Offset<SchemaType> offset = createFn();
+    internMap.try_emplace(key.str(), offset.o);
+    return offset;
+  }
 };
 
 } // namespace mlir::tt
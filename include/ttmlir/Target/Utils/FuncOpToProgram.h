@@ -6,12 +6,20 @@
 #define TTMLIR_TARGET_UTILS_FUNCOPTOPROGRAM_H
 
 #include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/AsmState.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/Threading.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include "flatbuffers/flatbuffers.h"
 #include "ttmlir/Target/Utils/FlatbufferObjectCache.h"
 #include "ttmlir/Target/Utils/MLIRToFlatbuffer.h"
 
+#include <optional>
+#include <string>
+#include <vector>
+
 namespace mlir::tt {
 
 template <typename OpT>
@@ -23,25 +31,111 @@ struct Program {
   std::vector<::flatbuffers::Offset<OpT>> ops;
 };
 
-inline std::string getOpDebugString(mlir::Operation *op,
-                                    OpPrintingFlags printFlags) {
+// Location of an op as stored in a binary: printed in full, or as an ID into
+// a LocationTable when the binary is built with compact locations.
+struct OpLocInfo {
+  std::string str;
+  std::optional<uint32_t> id;
+};
+
+inline std::string getOpDebugString(mlir::Operation *op, AsmState &asmState) {
 #ifdef TTMLIR_ENABLE_DEBUG_STRINGS
   std::string str;
   llvm::raw_string_ostream os(str);
-  op->print(os, printFlags);
+  op->print(os, asmState);
   return str;
 #else
   return "";
 #endif
 };
 
-inline std::string getOpLocInfo(mlir::Operation *op) {
+inline std::string getLocInfo(Location loc) {
   std::string str;
   llvm::raw_string_ostream os(str);
-  op->getLoc().print(os);
+  loc.print(os);
   return str;
 }
 
+inline std::string getOpLocInfo(mlir::Operation *op) {
+  return getLocInfo(op->getLoc());
+}
+
+// Calls `fn` on the ops of `entry` that are serialized as operations of its
+// program, in program order.
+template <typename FnT>
+void forEachProgramOp(func::FuncOp entry, FnT fn) {
+  entry.getBody().walk([&](mlir::Operation *op) {
+    if (!isa<func::ReturnOp>(op)) {
+      fn(op);
+    }
+  });
+}
+
+// Table of the distinct op locations of a module. Ops refer to their
+// location by ID, so each location is printed and stored only once.
+class LocationTable {
+public:
+  explicit LocationTable(ModuleOp module) {
+    std::vector<Location> locs;
+    module->walk([&](func::FuncOp func) {
+      forEachProgramOp(func, [&](mlir::Operation *op) {
+        if (ids.try_emplace(op->getLoc(), locs.size()).second) {
+          locs.push_back(op->getLoc());
+        }
+      });
+    });
+
+    locations.resize(locs.size());
+    mlir::parallelFor(module.getContext(), 0, locs.size(),
+                      [&](size_t i) { locations[i] = getLocInfo(locs[i]); });
+  }
+
+  uint32_t getId(Location loc) const {
+    auto it = ids.find(loc);
+    assert(it != ids.end() && "location is not in the table");
+    return it->second;
+  }
+
+  const std::vector<std::string> &getLocations() const { return locations; }
+
+private:
+  llvm::DenseMap<Location, uint32_t> ids;
+  std::vector<std::string> locations;
+};
+
+// Debug strings and locations of the ops of a program, in program order.
+struct ProgramDebugStrings {
+  std::vector<std::string> debugStrings;
+  std::vector<OpLocInfo> locInfos;
+};
+
+// Prints the ops of `entry` with one AsmState shared by all of them.
+// Operation::print builds a new AsmState for the whole module on every call,
+// which makes printing each op of a module quadratic in its size. Functions
+// are independent, so this can run on several of them in parallel.
+inline ProgramDebugStrings
+getProgramDebugStrings(func::FuncOp entry,
+                       const LocationTable *locationTable = nullptr) {
+  OpPrintingFlags printFlags;
+  printFlags = printFlags.elideLargeElementsAttrs()
+                   .elideLargeResourceString()
+                   .skipRegions()
+                   .enableDebugInfo()
+                   .assumeVerified();
+  AsmState asmState(entry, printFlags);
+
+  ProgramDebugStrings strings;
+  forEachProgramOp(entry, [&](mlir::Operation *op) {
+    strings.debugStrings.push_back(getOpDebugString(op, asmState));
+    if (locationTable) {
+      strings.locInfos.push_back({"", locationTable->getId(op->getLoc())});
+    } else {
+      strings.locInfos.push_back({getOpLocInfo(op), std::nullopt});
+    }
+  });
+  return strings;
+}
+
 inline Value getOperandThroughDPSOps(Value value) {
   auto *op = value.getDefiningOp();
   if (!op) {
@@ -58,18 +152,21 @@ inline Value getOperandThroughDPSOps(Value value) {
   return value;
 }
 
+// Serializes `entry` into a program, emitting each op with `fn`. Debug
+// strings are printed here unless they were already printed with
+// getProgramDebugStrings.
 template <typename OpT, typename FnT>
-Program<OpT> funcOpToProgram(FlatbufferObjectCache &cache, func::FuncOp entry,
-                             FnT fn) {
+Program<OpT>
+funcOpToProgram(FlatbufferObjectCache &cache, func::FuncOp entry, FnT fn,
+                const ProgramDebugStrings *debugStrings = nullptr) {
   constexpr uint64_t kHostAllocatedAddress = 0;
   constexpr uint64_t kHostAllocatedSize = 0;
 
-  OpPrintingFlags printFlags;
-  printFlags = printFlags.elideLargeElementsAttrs()
-                   .elideLargeResourceString()
-                   .skipRegions()
-                   .enableDebugInfo()
-                   .assumeVerified();
+  std::optional<ProgramDebugStrings> ownDebugStrings;
+  if (!debugStrings) {
+    ownDebugStrings = getProgramDebugStrings(entry);
+    debugStrings = &*ownDebugStrings;
+  }
 
   Program<OpT> program;
   program.name = entry.getSymName().data();
@@ -80,6 +177,7 @@ Program<OpT> funcOpToProgram(FlatbufferObjectCache &cache, func::FuncOp entry,
                                                kHostAllocatedSize));
   }
 
+  size_t opIndex = 0;
   entry.getBody().walk([&](mlir::Operation *op) {
     if (auto returnOp = dyn_cast_or_null<func::ReturnOp>(op); returnOp) {
       for (auto output : returnOp.getOperands()) {
@@ -87,11 +185,14 @@ Program<OpT> funcOpToProgram(FlatbufferObjectCache &cache, func::FuncOp entry,
             cache.at<::tt::target::TensorRef>(getOperandThroughDPSOps(output)));
       }
     } else {
-      std::string debugStr = getOpDebugString(op, printFlags);
-      std::string locInfo = getOpLocInfo(op);
-      program.ops.push_back(fn(cache, op, debugStr, locInfo));
+      program.ops.push_back(fn(cache, op,
+                               debugStrings->debugStrings[opIndex],
+                               debugStrings->locInfos[opIndex]));
+      ++opIndex;
     }
   });
+  assert(opIndex == debugStrings->debugStrings.size() &&
+         "debug strings do not match the program");
 
   return program;
 }
@@ -100,6 +100,8 @@ inline std::uint64_t getElementSizeBytes(DataType dtype) {
     return 2;
   case DataType::UInt8:
     return 1;
+  case DataType::Int32:
+    return 4;
   default:
     assert(false && "unsupported data type");
     break;
@@ -135,6 +137,8 @@ inline ::tt::target::DataType toFlatbuffer(FlatbufferObjectCache &,
     return ::tt::target::DataType::UInt16;
   case DataType::UInt8:
     return ::tt::target::DataType::UInt8;
+  case DataType::Int32:
+    return ::tt::target::DataType::Int32;
   }
 }
 
@@ -462,10 +466,15 @@ tensorTypeToFlatbuffer(FlatbufferObjectCache &cache, Type type,
   auto tensorType = mlir::cast<RankedTensorType>(type);
   auto shapeInt64 = tensorType.getShape();
   std::vector<int32_t> shape(shapeInt64.begin(), shapeInt64.end());
-  return ::tt::target::CreateTensorDescDirect(
-      *cache.fbb, &shape,
-      cache.getOrCreate(tensorType.getEncoding(), encodingToFlatbuffer,
-                        shapeInt64, deviceAttr));
+  auto layout = cache.getOrCreate(tensorType.getEncoding(),
+                                  encodingToFlatbuffer, shapeInt64, deviceAttr);
+  // The element type of the tensor isn't serialized, only the data type of
+  // its layout, so tensor types that only differ in it share a tensor desc.
+  FlatbufferInternKey key("TensorDesc");
+  key.add(llvm::ArrayRef<int32_t>(shape)).add(layout);
+  return cache.intern<::tt::target::TensorDesc>(key, [&] {
+    return ::tt::target::CreateTensorDescDirect(*cache.fbb, &shape, layout);
+  });
 }
 
 inline flatbuffers::Offset<::tt::target::TensorRef>
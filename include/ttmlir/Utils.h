@@ -14,7 +14,9 @@
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/Support/Error.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <type_traits>
 
 namespace ttmlir::utils {
@@ -47,6 +49,106 @@ inline void sample(Vector const &shape, Fn fn) {
   }
 }
 
+// Describes how an affine expression evolves when a single dimension of the
+// evaluation point is stepped: for every `0 <= t < extent`
+//   expr(point + t * e_dim) == value + stride * t
+// An unbounded extent is reported as INT64_MAX.
+struct LinearRun {
+  std::int64_t value = 0;
+  std::int64_t stride = 0;
+  std::int64_t extent = std::numeric_limits<std::int64_t>::max();
+};
+
+// Evaluates `expr` at `point` and returns the longest run along `dim` over
+// which the expression stays linear.  floordiv, ceildiv and mod are linear in
+// between multiples of their divisor, so the run ends at the next boundary
+// crossed by their operand.  Anything that is not provably linear (e.g. a
+// product of two varying terms) conservatively yields a run of one.
+inline LinearRun evalLinearRun(mlir::AffineExpr expr,
+                               llvm::ArrayRef<std::int64_t> point,
+                               unsigned dim) {
+  auto floorDiv = [](std::int64_t a, std::int64_t b) {
+    std::int64_t q = a / b;
+    return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+  };
+  auto ceilDiv = [&](std::int64_t a, std::int64_t b) {
+    return -floorDiv(-a, b);
+  };
+
+  switch (expr.getKind()) {
+  case mlir::AffineExprKind::Constant:
+    return {mlir::cast<mlir::AffineConstantExpr>(expr).getValue(), 0};
+  case mlir::AffineExprKind::DimId: {
+    unsigned pos = mlir::cast<mlir::AffineDimExpr>(expr).getPosition();
+    return {point[pos], pos == dim ? 1 : 0};
+  }
+  case mlir::AffineExprKind::SymbolId:
+    llvm_unreachable("Expected symbol-less expression");
+  default:
+    break;
+  }
+
+  auto binary = mlir::cast<mlir::AffineBinaryOpExpr>(expr);
+  LinearRun lhs = evalLinearRun(binary.getLHS(), point, dim);
+  LinearRun rhs = evalLinearRun(binary.getRHS(), point, dim);
+  std::int64_t extent = std::min(lhs.extent, rhs.extent);
+
+  if (expr.getKind() == mlir::AffineExprKind::Add) {
+    return {lhs.value + rhs.value, lhs.stride + rhs.stride, extent};
+  }
+
+  if (expr.getKind() == mlir::AffineExprKind::Mul) {
+    if (lhs.stride != 0 && rhs.stride != 0) {
+      return {lhs.value * rhs.value, 0, 1};
+    }
+    return {lhs.value * rhs.value,
+            lhs.stride * rhs.value + rhs.stride * lhs.value, extent};
+  }
+
+  // floordiv / ceildiv / mod: piecewise linear in the lhs as long as the
+  // divisor stays fixed.
+  std::int64_t c = rhs.value;
+  std::int64_t v = lhs.value;
+  std::int64_t s = lhs.stride;
+  assert(c > 0 && "Expected a positive divisor");
+  std::int64_t q = expr.getKind() == mlir::AffineExprKind::CeilDiv
+                       ? ceilDiv(v, c)
+                       : floorDiv(v, c);
+  std::int64_t r = v - floorDiv(v, c) * c;
+  std::int64_t value = expr.getKind() == mlir::AffineExprKind::Mod ? r : q;
+  if (rhs.stride != 0) {
+    return {value, 0, 1};
+  }
+  if (s == 0) {
+    return {value, 0, extent};
+  }
+
+  // Number of steps before the lhs crosses the next multiple of `c`.
+  std::int64_t steps = 0;
+  if (expr.getKind() == mlir::AffineExprKind::CeilDiv) {
+    std::int64_t upper = q * c;
+    steps = s > 0 ? (upper - v) / s + 1 : ceilDiv(v - (upper - c), -s);
+  } else {
+    steps = s > 0 ? ceilDiv(c - r, s) : r / -s + 1;
+  }
+  extent = std::min(extent, steps);
+  return {value, expr.getKind() == mlir::AffineExprKind::Mod ? s : 0, extent};
+}
+
+// Same as above, but for all results of a symbol-less map.
+inline llvm::SmallVector<LinearRun>
+evalLinearRuns(mlir::AffineMap map, llvm::ArrayRef<std::int64_t> point,
+               unsigned dim) {
+  assert(map.getNumSymbols() == 0 && "Expected symbol-less map");
+  assert(point.size() == map.getNumDims());
+  llvm::SmallVector<LinearRun> runs;
+  runs.reserve(map.getNumResults());
+  for (mlir::AffineExpr expr : map.getResults()) {
+    runs.push_back(evalLinearRun(expr, point, dim));
+  }
+  return runs;
+}
+
 template <typename Vector>
 llvm::SmallVector<int64_t> evalShape(mlir::AffineMap map, Vector shape) {
   mlir::SmallVector<int64_t> lastIndex;
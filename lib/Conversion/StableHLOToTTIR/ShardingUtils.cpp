@@ -55,7 +55,13 @@ determineGSPMDShardingDims(MeshSharding &meshSharding,
     }
   }
 
-  if (meshSharding.meshShape.size() != 2) {
+  // Higher dimensional meshes are supported as long as all but two of their
+  // dimensions are 1, e.g. 1x2x4 is treated as 2x4.
+  SmallVector<int64_t> &meshShape = meshSharding.meshShape;
+  while (meshShape.size() > 2 && llvm::is_contained(meshShape, 1)) {
+    meshShape.erase(llvm::find(meshShape, 1));
+  }
+  if (meshShape.size() != 2) {
     // Currently, we are only supporting 2d hardware mesh config.
     return failure();
   }
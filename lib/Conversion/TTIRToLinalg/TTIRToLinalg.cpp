@@ -17,6 +17,8 @@
 #include "mlir/Support/LogicalResult.h"
 #include "mlir/Transforms/DialectConversion.h"
 #include "ttmlir/Utils.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/Sequence.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/ErrorHandling.h"
@@ -183,6 +185,83 @@ public:
   }
 };
 
+// Conversion pattern for ops which only permute the dimensions of their input,
+// i.e. ttir.transpose and ttir.permute, lowered to linalg.transpose.
+template <typename TTIROpTy, typename OpAdaptor = typename TTIROpTy::Adaptor>
+class PermutationOpConversionPattern : public OpConversionPattern<TTIROpTy> {
+public:
+  using OpConversionPattern<TTIROpTy>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(TTIROpTy op, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    SmallVector<int64_t> permutation = getPermutation(op);
+    if (permutation.empty()) {
+      return rewriter.notifyMatchFailure(op, "Invalid permutation!");
+    }
+
+    rewriter.replaceOpWithNewOp<linalg::TransposeOp>(
+        op, adaptor.getInput(), adaptor.getOutput(), permutation);
+    return success();
+  }
+
+private:
+  static SmallVector<int64_t> getPermutation(ttir::TransposeOp op) {
+    int64_t rank = cast<RankedTensorType>(op.getInput().getType()).getRank();
+    int64_t dim0 = op.getDim0() < 0 ? op.getDim0() + rank : op.getDim0();
+    int64_t dim1 = op.getDim1() < 0 ? op.getDim1() + rank : op.getDim1();
+    if (dim0 < 0 || dim0 >= rank || dim1 < 0 || dim1 >= rank) {
+      return {};
+    }
+
+    SmallVector<int64_t> permutation(llvm::seq<int64_t>(0, rank));
+    std::swap(permutation[dim0], permutation[dim1]);
+    return permutation;
+  }
+
+  static SmallVector<int64_t> getPermutation(ttir::PermuteOp op) {
+    return SmallVector<int64_t>(op.getPermutation());
+  }
+};
+
+// Conversion pattern for ttir.reshape.  Statically shaped reshapes are lowered
+// by collapsing the input into a 1D tensor and expanding it into the target
+// shape.
+class ReshapeOpConversionPattern
+    : public OpConversionPattern<ttir::ReshapeOp> {
+public:
+  using OpConversionPattern<ttir::ReshapeOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(ttir::ReshapeOp op, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    auto inputType = cast<RankedTensorType>(adaptor.getInput().getType());
+    auto resultType = cast<RankedTensorType>(
+        getTypeConverter()->convertType(op.getResult().getType()));
+    if (!inputType.hasStaticShape() || !resultType.hasStaticShape()) {
+      return rewriter.notifyMatchFailure(op, "Only static shapes supported!");
+    }
+    if (inputType.getRank() == 0 || resultType.getRank() == 0) {
+      return rewriter.notifyMatchFailure(op, "Rank 0 tensors not supported!");
+    }
+
+    Location loc = op.getLoc();
+    auto flatType = RankedTensorType::get({inputType.getNumElements()},
+                                          inputType.getElementType());
+
+    SmallVector<ReassociationIndices, 1> collapseDims = {
+        llvm::to_vector(llvm::seq<int64_t>(0, inputType.getRank()))};
+    Value flat = rewriter.create<tensor::CollapseShapeOp>(
+        loc, flatType, adaptor.getInput(), collapseDims);
+
+    SmallVector<ReassociationIndices, 1> expandDims = {
+        llvm::to_vector(llvm::seq<int64_t>(0, resultType.getRank()))};
+    rewriter.replaceOpWithNewOp<tensor::ExpandShapeOp>(op, resultType, flat,
+                                                       expandDims);
+    return success();
+  }
+};
+
 } // namespace
 
 namespace mlir::tt {
@@ -192,8 +271,11 @@ void populateTTIRToLinalgPatterns(MLIRContext *ctx, RewritePatternSet &patterns,
   patterns.add<
       ElementwiseBinaryOpConversionPattern<ttir::AddOp, linalg::AddOp>,
       ElementwiseBinaryOpConversionPattern<ttir::MultiplyOp, linalg::MulOp>,
-      ElementwiseBinaryOpConversionPattern<ttir::SubtractOp, linalg::SubOp>>(
-      typeConverter, ctx);
+      ElementwiseBinaryOpConversionPattern<ttir::SubtractOp, linalg::SubOp>,
+      ElementwiseBinaryOpConversionPattern<ttir::DivOp, linalg::DivOp>,
+      PermutationOpConversionPattern<ttir::TransposeOp>,
+      PermutationOpConversionPattern<ttir::PermuteOp>,
+      ReshapeOpConversionPattern>(typeConverter, ctx);
 }
 
 } // namespace mlir::tt
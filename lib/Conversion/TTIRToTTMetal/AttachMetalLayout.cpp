@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "ttmlir/Dialect/TT/IR/TT.h"
+#include "ttmlir/Dialect/TT/Utils/GridSelection.h"
 #include "ttmlir/Dialect/TTIR/Transforms/Passes.h"
 #include <mlir/Dialect/Func/IR/FuncOps.h>
 #include <mlir/IR/PatternMatch.h>
@@ -18,9 +19,10 @@ namespace {
 class TTIRLayoutTensorTypeConverter : public TypeConverter {
 public:
   TTIRLayoutTensorTypeConverter(MLIRContext *ctx, MemorySpace initMemorySpace,
-                                bool useStreamLayout, GridAttr deviceGrid) {
+                                bool useStreamLayout, bool selectGrid,
+                                GridAttr deviceGrid) {
     addConversion([](Type type) { return type; });
-    addConversion([ctx, useStreamLayout, deviceGrid,
+    addConversion([ctx, useStreamLayout, selectGrid, deviceGrid,
                    initMemorySpace](RankedTensorType type) -> Type {
       if (type.getEncoding()) {
         return type;
@@ -28,8 +30,10 @@ public:
       std::int64_t deviceGridRank = deviceGrid.getShape().size();
       std::int64_t collapsedTensorRank = deviceGridRank;
 
-      // Default to single core grid
-      auto tensorGrid = GridAttr::get(ctx, deviceGridRank);
+      // Spread over the worker grid, or default to single core grid
+      auto tensorGrid = selectGrid
+                            ? utils::selectTensorGrid(ctx, type, deviceGrid)
+                            : GridAttr::get(ctx, deviceGridRank);
 
       MetalLayoutAttr newLayout = [&]() {
         // Default to initMemorySpace, the optimizer might decide otherwise:
@@ -139,7 +143,7 @@ class TTIRAttachMetalLayout
     auto device = getCurrentScopeDevice(getOperation());
     assert(device && "Device not found");
     TTIRLayoutTensorTypeConverter typeConverter(&getContext(), initMemorySpace,
-                                                useStreamLayout,
+                                                useStreamLayout, selectGrid,
                                                 device.getWorkerGrid());
     RewritePatternSet patterns(&getContext());
     patterns.add<TTIRLayoutTensorTypeRewriter>(typeConverter, &getContext());
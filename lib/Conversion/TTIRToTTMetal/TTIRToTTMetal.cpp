@@ -37,8 +37,13 @@
 #include <mlir/Support/LogicalResult.h>
 #include <mlir/Transforms/DialectConversion.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
+#include <map>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace mlir::tt::ttmetal {
 
@@ -111,10 +116,15 @@ public:
   };
 
   // This routine calculates the data movement for a tensor layout change by
-  // tracing the walk order of the src and dst affine maps.  The sample routine
-  // is just a helper function that iterates over the tensor shape and calls the
-  // lambda with the current index.  It walks the shape in innermost-major
-  // order. It also coalesces the noc transactions.
+  // tracing the walk order of the src and dst affine maps.  The tensor shape is
+  // walked in innermost-major order, but rather than composing both maps for
+  // every element, each row is split into runs over which all map results are
+  // linear (see ttmlir::utils::evalLinearRun).  A run that stays on the same
+  // pair of cores and advances both shard offsets by exactly one element is
+  // contiguous and is coalesced in a single step; anything else is emitted
+  // element by element.  The result is identical to an element-wise walk that
+  // coalesces each element into the previous noc transaction whenever it is
+  // contiguous and fits within dstCapacity.
   //
   // The return value is a map of physical cores where each core has
   // an associated list of noc reads/writes to be performed.
@@ -127,30 +137,82 @@ public:
     assert(src.getNumResults() == MemoryMapResultIdx::NumIndices);
     assert(dst.getNumResults() == MemoryMapResultIdx::NumIndices);
 
-    ::ttmlir::utils::sample(
-        tensorShape, [&txMap, src, dst, elemSize, read, type,
-                      dstCapacity](ArrayRef<std::int64_t> index) {
-          SmallVector<int64_t> srcResults = src.compose(index);
-          SmallVector<int64_t> dstResults = dst.compose(index);
-          assert(srcResults.size() == src.getNumResults());
-          assert(dstResults.size() == dst.getNumResults());
-          PhysicalCoreCoord srcCoord(srcResults);
-          PhysicalCoreCoord dstCoord(dstResults);
-          std::int64_t srcOffset = srcResults.back() * elemSize;
-          std::int64_t dstOffset = dstResults.back() * elemSize;
-
-          SmallVector<NocTx> &txs = txMap[read ? dstCoord : srcCoord];
+    std::int64_t rank = tensorShape.size();
+    std::int64_t volume = ::ttmlir::utils::volume(tensorShape);
+    if (volume == 0) {
+      return txMap;
+    }
+    unsigned innerDim = rank > 0 ? rank - 1 : 0;
+    std::int64_t rowSize = rank > 0 ? tensorShape.back() : 1;
+
+    auto isContiguousRun = [](ArrayRef<::ttmlir::utils::LinearRun> runs) {
+      return runs[MemoryMapResultIdx::DeviceIdx].stride == 0 &&
+             runs[MemoryMapResultIdx::CoreCoordY].stride == 0 &&
+             runs[MemoryMapResultIdx::CoreCoordX].stride == 0 &&
+             runs[MemoryMapResultIdx::ShardOffset].stride == 1;
+    };
+    auto getCoord = [](ArrayRef<::ttmlir::utils::LinearRun> runs) {
+      return PhysicalCoreCoord(runs[MemoryMapResultIdx::DeviceIdx].value,
+                               runs[MemoryMapResultIdx::CoreCoordY].value,
+                               runs[MemoryMapResultIdx::CoreCoordX].value);
+    };
+
+    SmallVector<int64_t> index(rank, 0);
+    for (std::int64_t row = 0; row < volume / rowSize; ++row) {
+      for (std::int64_t col = 0; col < rowSize;) {
+        if (rank > 0) {
+          index[innerDim] = col;
+        }
+        auto srcRuns = ::ttmlir::utils::evalLinearRuns(src, index, innerDim);
+        auto dstRuns = ::ttmlir::utils::evalLinearRuns(dst, index, innerDim);
+        PhysicalCoreCoord srcCoord = getCoord(srcRuns);
+        PhysicalCoreCoord dstCoord = getCoord(dstRuns);
+        std::int64_t srcOffset =
+            srcRuns[MemoryMapResultIdx::ShardOffset].value * elemSize;
+        std::int64_t dstOffset =
+            dstRuns[MemoryMapResultIdx::ShardOffset].value * elemSize;
+
+        std::int64_t runLength = 1;
+        if (rank > 0 && isContiguousRun(srcRuns) && isContiguousRun(dstRuns)) {
+          runLength = rowSize - col;
+          for (auto const &run : srcRuns) {
+            runLength = std::min(runLength, run.extent);
+          }
+          for (auto const &run : dstRuns) {
+            runLength = std::min(runLength, run.extent);
+          }
+        }
+        col += runLength;
+
+        SmallVector<NocTx> &txs = txMap[read ? dstCoord : srcCoord];
+        PhysicalCoreCoord txCoord = read ? srcCoord : dstCoord;
+        while (runLength > 0) {
+          std::int64_t numElements = 1;
           if (not txs.empty() &&
-              txs.back().isContiguous(read ? srcCoord : dstCoord, srcOffset,
-                                      dstOffset) &&
+              txs.back().isContiguous(txCoord, srcOffset, dstOffset) &&
               txs.back().size + elemSize <= dstCapacity) {
-            txs.back().size += elemSize;
-            txs.back().numElements++;
+            numElements = std::min(
+                runLength, (dstCapacity - txs.back().size) / elemSize);
+            txs.back().size += numElements * elemSize;
+            txs.back().numElements += numElements;
           } else {
-            txs.push_back(NocTx(type, read ? srcCoord : dstCoord, srcOffset,
-                                dstOffset, elemSize, 1));
+            txs.push_back(
+                NocTx(type, txCoord, srcOffset, dstOffset, elemSize, 1));
           }
-        });
+          runLength -= numElements;
+          srcOffset += numElements * elemSize;
+          dstOffset += numElements * elemSize;
+        }
+      }
+
+      // Advance the outer dimensions of the index to the next row.
+      for (std::int64_t dim = rank - 2; dim >= 0; --dim) {
+        if (++index[dim] < tensorShape[dim]) {
+          break;
+        }
+        index[dim] = 0;
+      }
+    }
 
     return txMap;
   }
@@ -551,7 +613,11 @@ namespace {
 class TTIRToTTMetalEnqueueProgramRewriter
     : public OpRewritePattern<ttir::GenericOp> {
 public:
-  using OpRewritePattern<ttir::GenericOp>::OpRewritePattern;
+  TTIRToTTMetalEnqueueProgramRewriter(MLIRContext *ctx,
+                                      unsigned numStreamBuffers,
+                                      bool enableMulticast)
+      : OpRewritePattern<ttir::GenericOp>(ctx),
+        numStreamBuffers(numStreamBuffers), enableMulticast(enableMulticast) {}
 
   bool hasUnloweredTTIRKernel(ttir::GenericOp op) const {
     bool exists = false;
@@ -627,6 +693,27 @@ public:
     return AffineMap::get(physShape.size(), 0, resultExpr, memref.getContext());
   }
 
+  // Same as getAffineIterator, but for a CB operand. A multi-buffered CB only
+  // ever holds a single block (row of tiles) at its front, so its iterator
+  // drops the outer dims and restarts from 0 on every outer loop iteration.
+  AffineMap getAffineIterator(ttkernel::CBType cbType,
+                              ArrayRef<bool> reducedMemrefDims) const {
+    AffineMap affineIterator =
+        getAffineIterator(cbType.getMemref(), reducedMemrefDims);
+    if (cbType.getNumBuffers() == 1) {
+      return affineIterator;
+    }
+    MLIRContext *ctx = affineIterator.getContext();
+    SmallVector<AffineExpr> dims;
+    for (unsigned dim = 0; dim < affineIterator.getNumDims(); ++dim) {
+      dims.push_back(dim + 1 == affineIterator.getNumDims()
+                         ? getAffineDimExpr(dim, ctx)
+                         : getAffineConstantExpr(0, ctx));
+    }
+    return affineIterator.replaceDimsAndSymbols(
+        dims, {}, affineIterator.getNumDims(), 0);
+  }
+
   Value i32(std::int32_t value, OpBuilder &builder) const {
     return builder
         .create<arith::ConstantOp>(builder.getUnknownLoc(),
@@ -675,8 +762,7 @@ public:
     iterators.resize(blockArguments.size());
     for (BlockArgument operand : blockArguments) {
       auto cbType = mlir::cast<ttkernel::CBType>(operand.getType());
-      AffineMap affineIterator =
-          getAffineIterator(cbType.getMemref(), reducedMemrefDims);
+      AffineMap affineIterator = getAffineIterator(cbType, reducedMemrefDims);
 
       assert(affineIterator.getNumDims() == mapRank);
       iterators[operand.getArgNumber()] = getOrInsertIterator(affineIterator);
@@ -684,10 +770,17 @@ public:
 
     // Walking shape is the shape which should be traversed with loop nest. For
     // eltwise ops, all operands have the same shape so we can just use the
-    // first operand. Reduce ops are kind of unary ops so we can use the first
-    // operand as well.
-    auto firstArg =
-        mlir::cast<ttkernel::CBType>(blockArguments.front().getType());
+    // first operand that holds a whole shard (i.e. is not multi-buffered).
+    // Reduce ops are kind of unary ops so we can use the first operand as
+    // well. Outputs are never pipelined, so there always is such an operand.
+    const auto *wholeShardArg =
+        llvm::find_if(blockArguments, [](BlockArgument arg) {
+          return mlir::cast<ttkernel::CBType>(arg.getType()).getNumBuffers() ==
+                 1;
+        });
+    assert(wholeShardArg != blockArguments.end() &&
+           "Expected an operand holding a whole shard");
+    auto firstArg = mlir::cast<ttkernel::CBType>(wholeShardArg->getType());
     SmallVector<int64_t> walkingShape =
         getPermutedAffineMap(firstArg.getMemref().getLayout().getAffineMap(),
                              reducedMemrefDims)
@@ -700,8 +793,7 @@ public:
     blockArgIteratorMapping.resize(blockArguments.size());
     for (BlockArgument operand : blockArguments) {
       auto cbType = mlir::cast<ttkernel::CBType>(operand.getType());
-      AffineMap affineIterator =
-          getAffineIterator(cbType.getMemref(), reducedMemrefDims);
+      AffineMap affineIterator = getAffineIterator(cbType, reducedMemrefDims);
       auto *match = iteratorMaps.find(affineIterator);
       assert(match != iteratorMaps.end());
       blockArgIteratorMapping[operand.getArgNumber()] =
@@ -1262,6 +1354,27 @@ public:
     SmallVector<unsigned> blockArgIteratorMapping =
         loopNest.blockArgIteratorMapping;
 
+    // Multi-buffered input CBs only hold a few blocks at a time, so they are
+    // consumed one block (row of tiles) per outer loop iteration. This lets
+    // the reader fill the next blocks while the current one is computed on.
+    scf::ForOp outerLoop = loopNest.loops.front();
+    for (BlockArgument cb : cbOperands.take_front(numDPSInputs)) {
+      auto cbType = mlir::cast<ttkernel::CBType>(cb.getType());
+      if (cbType.getNumBuffers() == 1) {
+        continue;
+      }
+      OpBuilder outerLoopBuilder(outerLoop.getBody(),
+                                 outerLoop.getBody()->begin());
+      Value blockTiles =
+          i32(ttmlir::utils::volume(cbType.getMemref().getShape()),
+              outerLoopBuilder);
+      outerLoopBuilder.create<ttkernel::CBWaitFrontOp>(arithOrMathOp.getLoc(),
+                                                       cb, blockTiles);
+      outerLoopBuilder.setInsertionPoint(outerLoop.getBody()->getTerminator());
+      outerLoopBuilder.create<ttkernel::CBPopFrontOp>(arithOrMathOp.getLoc(),
+                                                      cb, blockTiles);
+    }
+
     OpBuilder innerLoopBuilder(&innerLoopRegion->front(),
                                innerLoopRegion->front().begin());
 
@@ -1346,6 +1459,118 @@ public:
     buildEndSection(builder, origGenericOpBlock);
   }
 
+  // Lowers a matmul block. Each core computes its output tiles one K block at
+  // a time, accumulating the block's products for an output tile in DST.
+  // Between K blocks the partial sums are packed into an intermediate CB
+  // (which shares L1 with the output shard) and reloaded into DST before the
+  // next block is accumulated on top of them; only the last K block packs
+  // into the output CB.
+  void lowerMatmulBlock(Block *origGenericOpBlock, Block *computeBlock,
+                        uint64_t numKBlocks) const {
+    Location loc = origGenericOpBlock->front().getLoc();
+    OpBuilder builder = OpBuilder::atBlockBegin(computeBlock);
+
+    Value lhsCB = computeBlock->getArgument(0);
+    Value rhsCB = computeBlock->getArgument(1);
+    Value outCB = computeBlock->getArgument(2);
+    Value partialsCB = numKBlocks > 1 ? computeBlock->getArgument(3) : nullptr;
+    ArrayRef<int64_t> lhsBlockShape =
+        mlir::cast<ttkernel::CBType>(lhsCB.getType()).getShape();
+    ArrayRef<int64_t> rhsBlockShape =
+        mlir::cast<ttkernel::CBType>(rhsCB.getType()).getShape();
+    const int32_t mTiles = lhsBlockShape[0];
+    const int32_t kBlockTiles = lhsBlockShape[1];
+    const int32_t nTiles = rhsBlockShape[1];
+
+    builder.create<ttkernel::MatmulInitOp>(loc, lhsCB, rhsCB, outCB,
+                                           i32(0, builder));
+
+    auto createKBlock = [&](bool reloadPartials, bool packToOutput) {
+      Value lhsBlockTiles = i32(mTiles * kBlockTiles, builder);
+      Value rhsBlockTiles = i32(kBlockTiles * nTiles, builder);
+      builder.create<ttkernel::CBWaitFrontOp>(loc, lhsCB, lhsBlockTiles);
+      builder.create<ttkernel::CBWaitFrontOp>(loc, rhsCB, rhsBlockTiles);
+
+      auto mLoop = builder.create<scf::ForOp>(
+          loc, i32(0, builder), i32(mTiles, builder), i32(1, builder));
+      builder.setInsertionPointToStart(mLoop.getBody());
+      auto nLoop = builder.create<scf::ForOp>(
+          loc, i32(0, builder), i32(nTiles, builder), i32(1, builder));
+      builder.setInsertionPointToStart(nLoop.getBody());
+      Value m = mLoop.getInductionVar();
+      Value n = nLoop.getInductionVar();
+      Value dstIndex = i32(0, builder);
+
+      builder.create<ttkernel::TileRegsAcquireOp>(loc);
+      if (reloadPartials) {
+        builder.create<ttkernel::CBWaitFrontOp>(loc, partialsCB,
+                                                i32(1, builder));
+        builder.create<ttkernel::CopyTileInitOp>(loc, partialsCB);
+        builder.create<ttkernel::CopyTileOp>(loc, partialsCB, i32(0, builder),
+                                             dstIndex);
+        builder.create<ttkernel::CBPopFrontOp>(loc, partialsCB,
+                                               i32(1, builder));
+        builder.create<ttkernel::MatmulInitShortOp>(loc, lhsCB, rhsCB,
+                                                    i32(0, builder));
+      }
+      auto kLoop = builder.create<scf::ForOp>(
+          loc, i32(0, builder), i32(kBlockTiles, builder), i32(1, builder));
+      {
+        OpBuilder::InsertionGuard guard(builder);
+        builder.setInsertionPointToStart(kLoop.getBody());
+        Value k = kLoop.getInductionVar();
+        Value lhsIndex = builder.create<arith::AddIOp>(
+            loc,
+            builder.create<arith::MulIOp>(loc, m, i32(kBlockTiles, builder)),
+            k);
+        Value rhsIndex = builder.create<arith::AddIOp>(
+            loc, builder.create<arith::MulIOp>(loc, k, i32(nTiles, builder)),
+            n);
+        builder.create<ttkernel::MatmulTilesOp>(loc, lhsCB, rhsCB, lhsIndex,
+                                                rhsIndex, dstIndex,
+                                                i32(0, builder));
+      }
+      builder.create<ttkernel::TileRegsCommitOp>(loc);
+
+      builder.create<ttkernel::TileRegsWaitOp>(loc);
+      if (packToOutput) {
+        Value outIndex = builder.create<arith::AddIOp>(
+            loc, builder.create<arith::MulIOp>(loc, m, i32(nTiles, builder)),
+            n);
+        builder.create<ttkernel::PackTileOp>(loc, dstIndex, outCB, outIndex);
+      } else {
+        builder.create<ttkernel::CBReserveBackOp>(loc, partialsCB,
+                                                  i32(1, builder));
+        builder.create<ttkernel::PackTileOp>(loc, dstIndex, partialsCB,
+                                             i32(0, builder));
+        builder.create<ttkernel::CBPushBackOp>(loc, partialsCB,
+                                               i32(1, builder));
+      }
+      builder.create<ttkernel::TileRegsReleaseOp>(loc);
+
+      builder.setInsertionPointAfter(mLoop);
+      builder.create<ttkernel::CBPopFrontOp>(loc, lhsCB, lhsBlockTiles);
+      builder.create<ttkernel::CBPopFrontOp>(loc, rhsCB, rhsBlockTiles);
+    };
+
+    if (numKBlocks == 1) {
+      createKBlock(/*reloadPartials=*/false, /*packToOutput=*/true);
+    } else {
+      createKBlock(/*reloadPartials=*/false, /*packToOutput=*/false);
+      if (numKBlocks > 2) {
+        auto blockLoop = builder.create<scf::ForOp>(
+            loc, i32(1, builder), i32(numKBlocks - 1, builder),
+            i32(1, builder));
+        builder.setInsertionPointToStart(blockLoop.getBody());
+        createKBlock(/*reloadPartials=*/true, /*packToOutput=*/false);
+        builder.setInsertionPointAfter(blockLoop);
+      }
+      createKBlock(/*reloadPartials=*/true, /*packToOutput=*/true);
+    }
+
+    buildEndSection(builder, origGenericOpBlock);
+  }
+
   struct StreamedOperand {
     uint64_t srcAddress;
     uint64_t dstAddress;
@@ -1356,6 +1581,12 @@ public:
         dataMovement;
     uint64_t numTiles;
     PhysicalCoreCoordMapping coordMappping;
+    // Streamed operands with a block size are pipelined: the CB holds
+    // numBuffers blocks of blockTiles tiles (one row of the shard, or one K
+    // block of a matmul input) and is filled/drained one block at a time.
+    uint64_t numBuffers = 1;
+    uint64_t blockTiles = 0;
+    uint64_t blockSizeBytes = 0;
 
     StreamedOperand(
         uint64_t srcAddress, uint64_t dstAddress, size_t blockArgIndex,
@@ -1368,8 +1599,38 @@ public:
           blockArgIndex(blockArgIndex), hasDataMovement(hasDataMovement),
           dataMovement(dataMovement), numTiles(numTiles),
           coordMappping(coordMappping) {}
+
+    bool isPipelined() const { return blockTiles > 0; }
+    uint64_t getNumBlocks() const { return numTiles / blockTiles; }
   };
 
+  // Returns the number of buffers a streamed operand's CB should be split
+  // into. Pipelining is done at the granularity of shard rows, which requires
+  // the compute loop nest to walk the CB in row-major order without
+  // revisiting tiles, i.e. eltwise ops on identity-mapped tiled shards. Ops
+  // that touch the input CBs from the compute kernel (div's in-place recip)
+  // or reduce across rows keep a single buffer. The CB is carved out of the
+  // L1 buffer already allocated for the whole shard, so the number of
+  // buffers is capped by the number of rows.
+  uint64_t getNumStreamBuffers(ttir::GenericOp op, MemRefType memref) const {
+    if (numStreamBuffers <= 1 || memref.getRank() != 2 ||
+        !memref.getLayout().isIdentity() ||
+        !mlir::isa<TileType>(memref.getElementType())) {
+      return 1;
+    }
+    for (Attribute iteratorType : op.getIteratorTypes()) {
+      if (mlir::cast<IteratorTypeAttr>(iteratorType).getValue() !=
+          IteratorType::Parallel) {
+        return 1;
+      }
+    }
+    Operation &firstOp = op.getRegion().front().front();
+    if (mlir::isa<ttir::KernelOp, arith::DivFOp>(firstOp)) {
+      return 1;
+    }
+    return std::min<uint64_t>(numStreamBuffers, memref.getShape()[0]);
+  }
+
   std::pair<SmallVector<Type>, SmallVector<StreamedOperand>>
   getBlockArgumentTypesAsCBs(ttir::GenericOp op,
                              mlir::Block::BlockArgListType blockArguments,
@@ -1396,12 +1657,42 @@ public:
       auto address = lookupAddress(correspondingOperand);
       assert(address && "Expected valid address");
 
-      rewrittenBlockArgumentTypes.push_back(
-          rewriter.getType<ttkernel::CBType>(port, address, memref));
+      if (isMatmul(op) && arg.getArgNumber() < op.getInputs().size()) {
+        auto [cbType, streamedOperand] = getMatmulInputCB(
+            op, arg.getArgNumber(), port, memref, matchingOperand,
+            correspondingOperand, rewriter);
+        rewrittenBlockArgumentTypes.push_back(cbType);
+        streamedOperands.push_back(streamedOperand);
+        continue;
+      }
 
       uint64_t numTiles = memref.getShape()[memref.getRank() - 1] *
                           memref.getShape()[memref.getRank() - 2];
 
+      // Only inputs are pipelined; outputs are packed straight into their
+      // shard, so the compute loop nest can always walk the output.
+      uint64_t numBuffers =
+          buffer.getBufferAccess() == BufferAccess::Stream &&
+                  arg.getArgNumber() < op.getInputs().size()
+              ? getNumStreamBuffers(op, memref)
+              : 1;
+      uint64_t blockTiles = memref.getShape()[memref.getRank() - 1];
+      if (numBuffers > 1) {
+        // The CB is sized for numBuffers blocks of a single row each.
+        auto tileType = mlir::cast<TileType>(memref.getElementType());
+        auto blockMemref = MemRefType::get(
+            {1, static_cast<int64_t>(blockTiles)}, tileType,
+            AffineMap::getMultiDimIdentityMap(2, op.getContext()),
+            memref.getMemorySpace());
+        rewrittenBlockArgumentTypes.push_back(
+            rewriter.getType<ttkernel::CBType>(port, address, blockMemref,
+                                               tileType.getSizeBytes(),
+                                               numBuffers));
+      } else {
+        rewrittenBlockArgumentTypes.push_back(
+            rewriter.getType<ttkernel::CBType>(port, address, memref));
+      }
+
       llvm::MapVector<PhysicalCoreCoord,
                       SmallVector<TTIRToTTMetalLayoutRewriter::NocTx>>
           dataMovement;
@@ -1423,6 +1714,14 @@ public:
           PhysicalCoreCoordMapping::getMemorySpaceMapping(
               op.getDevice().getChipIds(), op.getSystemDesc().getChipDescs(),
               MemorySpace::DeviceL1)));
+      if (numBuffers > 1) {
+        StreamedOperand &streamed = streamedOperands.back();
+        streamed.numBuffers = numBuffers;
+        streamed.blockTiles = blockTiles;
+        streamed.blockSizeBytes =
+            blockTiles *
+            mlir::cast<TileType>(memref.getElementType()).getSizeBytes();
+      }
     }
 
     return {rewrittenBlockArgumentTypes, streamedOperands};
@@ -1483,6 +1782,114 @@ public:
     return dm;
   }
 
+  // Returns the CB type and the streamed operand of a matmul input. The CB
+  // shard created by TTIRGenericOpCBs holds either the whole K dim (a single
+  // buffer) or two K blocks (double buffered); either way a block is the
+  // core's rows of A, or columns of B, for kBlockTiles K tiles.
+  std::pair<Type, StreamedOperand>
+  getMatmulInputCB(ttir::GenericOp op, unsigned operandIdx,
+                   ttkernel::CBPort port, MemRefType memref,
+                   Value matchingOperand, Value cb,
+                   PatternRewriter &rewriter) const {
+    bool isLhs = operandIdx == 0;
+    auto tileType = mlir::cast<TileType>(memref.getElementType());
+    auto srcTy = mlir::cast<RankedTensorType>(matchingOperand.getType());
+    auto srcLayout = mlir::cast<tt::MetalLayoutAttr>(srcTy.getEncoding());
+    SmallVector<int64_t> srcTiledShape =
+        srcLayout.getTiledShape(srcTy.getShape());
+
+    int64_t kTiles = srcTiledShape[isLhs ? 1 : 0];
+    int64_t kExtent = memref.getShape()[isLhs ? 1 : 0];
+    uint64_t numBuffers = kExtent == kTiles ? 1 : 2;
+    int64_t kBlockTiles = kExtent / numBuffers;
+    SmallVector<int64_t> blockShape = {memref.getShape()[0], kBlockTiles};
+    if (!isLhs) {
+      blockShape = {kBlockTiles, memref.getShape()[1]};
+    }
+    auto blockMemref = MemRefType::get(
+        blockShape, tileType,
+        AffineMap::getMultiDimIdentityMap(2, op.getContext()),
+        memref.getMemorySpace());
+    auto cbType = rewriter.getType<ttkernel::CBType>(
+        port, lookupAddress(cb), blockMemref, tileType.getSizeBytes(),
+        numBuffers);
+
+    uint64_t blockTiles = ttmlir::utils::volume<int64_t>(blockShape);
+    uint64_t blockSizeBytes = blockTiles * tileType.getSizeBytes();
+    StreamedOperand streamedOperand(
+        lookupAddress(matchingOperand), lookupAddress(cb), operandIdx,
+        /*hasDataMovement=*/true,
+        calculateMatmulDataMovement(isLhs, srcTy, blockShape, blockSizeBytes,
+                                    op.getGrid().getShape(), op.getDevice()),
+        blockTiles / kBlockTiles * kTiles,
+        PhysicalCoreCoordMapping::getMemorySpaceMapping(
+            op.getDevice().getChipIds(), op.getSystemDesc().getChipDescs(),
+            MemorySpace::DeviceL1));
+    streamedOperand.numBuffers = numBuffers;
+    streamedOperand.blockTiles = blockTiles;
+    streamedOperand.blockSizeBytes = blockSizeBytes;
+    return {cbType, streamedOperand};
+  }
+
+  // Core (y, x) reads row block y of A and column block x of B, K block by K
+  // block. The destination map lays the tiles out block after block, each
+  // block being row-major, so that block k of the stream is exactly the CB
+  // page range the compute kernel waits on. The reads are computed for the
+  // first column (row) of cores and replicated across the grid; with
+  // multicast enabled, the replicated reads are done once per row (column)
+  // and multicast to the other cores.
+  llvm::MapVector<PhysicalCoreCoord,
+                  SmallVector<TTIRToTTMetalLayoutRewriter::NocTx>>
+  calculateMatmulDataMovement(bool isLhs, RankedTensorType src,
+                              ArrayRef<int64_t> blockShape,
+                              int64_t blockSizeBytes,
+                              ArrayRef<int64_t> gridShape,
+                              DeviceAttr device) const {
+    auto srcLayout = mlir::cast<tt::MetalLayoutAttr>(src.getEncoding());
+    assert(srcLayout.isTiled());
+    auto srcProjection = srcLayout.projectOnto(
+        srcLayout.getIdentityTileLinearMap(),
+        device.getMapForMemorySpace(srcLayout.getMemorySpace()));
+
+    MLIRContext *ctx = src.getContext();
+    AffineExpr d0 = getAffineDimExpr(0, ctx);
+    AffineExpr d1 = getAffineDimExpr(1, ctx);
+    AffineExpr zero = getAffineConstantExpr(0, ctx);
+    AffineExpr kBlock = isLhs ? d1.floorDiv(blockShape[1])
+                              : d0.floorDiv(blockShape[0]);
+    AffineExpr blockOffset =
+        kBlock * (blockShape[0] * blockShape[1]) +
+        (d0 % blockShape[0]) * blockShape[1] + d1 % blockShape[1];
+    auto dstMap = AffineMap::get(
+        2, 0,
+        {zero, isLhs ? d0.floorDiv(blockShape[0]) : zero,
+         isLhs ? zero : d1.floorDiv(blockShape[1]), blockOffset},
+        ctx);
+
+    auto dm = TTIRToTTMetalLayoutRewriter::calculateDataMovement(
+        srcLayout.getTiledShape(src.getShape()),
+        srcLayout.getElementSizeBytes(), srcProjection, dstMap,
+        TTIRToTTMetalLayoutRewriter::NocTx::Type::Read, blockSizeBytes);
+
+    llvm::MapVector<PhysicalCoreCoord,
+                    SmallVector<TTIRToTTMetalLayoutRewriter::NocTx>>
+        replicated;
+    for (auto &[dstCoord, txs] : dm) {
+      for (int64_t i = 0; i < gridShape[isLhs ? 1 : 0]; ++i) {
+        PhysicalCoreCoord coord = dstCoord;
+        (isLhs ? coord.x : coord.y) = i;
+        replicated[coord] = txs;
+      }
+    }
+    return replicated;
+  }
+
+  static bool isMatmul(ttir::GenericOp op) {
+    auto kernelOp =
+        mlir::dyn_cast<ttir::KernelOp>(op.getRegion().front().front());
+    return kernelOp && kernelOp.getOp() == "matmul";
+  }
+
   static bool needScaler(ttir::GenericOp op) {
     Block &block = op.getRegion().front();
     Operation &firstOp = block.getOperations().front();
@@ -1663,6 +2070,390 @@ public:
     builder.create<ttkernel::CBPushBackOp>(loc, scalerCB, oneConst);
   }
 
+  // A rectangle of destination cores that all read the exact same tiles of a
+  // streamed operand. Only the top-left core (the sender) reads them from the
+  // source cores; it then multicasts the shard to the rest of the rectangle.
+  struct MulticastGroup {
+    PhysicalCoreCoord sender;
+    std::int64_t height;
+    std::int64_t width;
+
+    std::int64_t size() const { return height * width; }
+    PhysicalCoreCoord last() const {
+      return PhysicalCoreCoord(sender.d, sender.y + height - 1,
+                               sender.x + width - 1);
+    }
+    bool contains(PhysicalCoreCoord coord) const {
+      return coord.d == sender.d && coord.y >= sender.y &&
+             coord.y < sender.y + height && coord.x >= sender.x &&
+             coord.x < sender.x + width;
+    }
+  };
+
+  // tt-metal has 8 semaphores per core and every multicast operand uses two.
+  static constexpr int32_t kMaxMulticastOperands = 4;
+
+  // Groups the destination cores of a streamed operand by their transaction
+  // lists. Cores with identical lists read the same tiles into the same CB
+  // offsets, so if they form a rectangle the reads can be done once and
+  // multicast. Groups that are not rectangular are split into row segments.
+  static SmallVector<MulticastGroup>
+  findMulticastGroups(const StreamedOperand &operand) {
+    std::map<std::vector<std::int64_t>, SmallVector<PhysicalCoreCoord>>
+        readers;
+    for (auto &[dstCoord, txs] : operand.dataMovement) {
+      std::vector<std::int64_t> key;
+      for (auto const &tx : txs) {
+        key.insert(key.end(), {tx.coreCoord.d, tx.coreCoord.y, tx.coreCoord.x,
+                               tx.srcOffset, tx.dstOffset, tx.size,
+                               tx.numElements});
+      }
+      readers[key].push_back(dstCoord);
+    }
+
+    SmallVector<MulticastGroup> groups;
+    for (auto &entry : readers) {
+      SmallVector<PhysicalCoreCoord> &coords = entry.second;
+      if (coords.size() < 2) {
+        continue;
+      }
+      llvm::sort(coords, [](PhysicalCoreCoord a, PhysicalCoreCoord b) {
+        return std::tie(a.d, a.y, a.x) < std::tie(b.d, b.y, b.x);
+      });
+
+      MulticastGroup bounds{coords.front(), 1, 1};
+      std::int64_t maxX = coords.front().x;
+      for (PhysicalCoreCoord coord : coords) {
+        bounds.sender.x = std::min(bounds.sender.x, coord.x);
+        maxX = std::max(maxX, coord.x);
+      }
+      bounds.height = coords.back().y - coords.front().y + 1;
+      bounds.width = maxX - bounds.sender.x + 1;
+      if (coords.front().d == coords.back().d &&
+          bounds.size() == static_cast<std::int64_t>(coords.size())) {
+        groups.push_back(bounds);
+        continue;
+      }
+
+      for (size_t begin = 0, end = 1; begin < coords.size(); begin = end++) {
+        while (end < coords.size() && coords[end].d == coords[begin].d &&
+               coords[end].y == coords[begin].y &&
+               coords[end].x == coords[end - 1].x + 1) {
+          ++end;
+        }
+        if (end - begin > 1) {
+          groups.push_back(
+              {coords[begin], 1, static_cast<std::int64_t>(end - begin)});
+        }
+      }
+    }
+    return groups;
+  }
+
+  // Reads the id of the semaphore passed as runtime argument `argIndex` and
+  // returns its L1 address.
+  static Value getSemaphoreAddress(OpBuilder &builder, Location loc,
+                                   int32_t argIndex) {
+    Value index = builder.create<arith::ConstantOp>(
+        loc, builder.getI32IntegerAttr(argIndex));
+    Value id = builder.create<ttkernel::GetArgValOp>(loc, builder.getI32Type(),
+                                                     index);
+    return builder.create<ttkernel::GetSemaphoreOp>(loc, id);
+  }
+
+  // The multicast handshake for one shard (or one block of a pipelined
+  // operand) of a group, split in the steps each side takes. Receivers
+  // first clear their valid semaphore and tell the sender that their CB slot
+  // is reserved:
+  //   noc_semaphore_set(valid, 0)
+  //   noc_semaphore_inc(sender.ready, 1)
+  // The sender, once its reads have landed, waits for every receiver, re-arms
+  // its ready semaphore for the next shard and multicasts the data followed
+  // by the valid flag:
+  //   noc_semaphore_wait(ready, numReceivers)
+  //   noc_semaphore_set(ready, 0)
+  //   noc_async_write_multicast_loopback_src(shard -> group)
+  //   noc_semaphore_set(valid, 1)
+  //   noc_semaphore_set_multicast_loopback_src(valid -> group)
+  //   noc_async_write_barrier()
+  // Receivers then wait for the data:
+  //   noc_semaphore_wait(valid, 1)
+  // The sender is part of the group rectangle, hence the loopback variants;
+  // writing the shard onto itself is harmless. Multicasts from one core are
+  // delivered in order, so the valid flag never overtakes the data. A
+  // receiver only signals ready for the next shard after it saw valid for the
+  // previous one, which the sender sets after re-arming ready.
+  static void emitMulticastReceiverReady(OpBuilder &builder, Location loc,
+                                         const StreamedOperand &operand,
+                                         const MulticastGroup &group,
+                                         int32_t semaphoreArgIndex) {
+    auto i32 = [&](int64_t value) -> Value {
+      return builder.create<arith::ConstantOp>(
+          loc, builder.getI32IntegerAttr(value));
+    };
+    std::array<int64_t, 2> sender = operand.coordMappping[group.sender];
+    Value readySem = getSemaphoreAddress(builder, loc, semaphoreArgIndex);
+    Value validSem = getSemaphoreAddress(builder, loc, semaphoreArgIndex + 1);
+    Value validPtr = builder.create<ttkernel::CastToL1PtrOp>(loc, validSem);
+    builder.create<ttkernel::NocSemaphoreSetOp>(loc, validPtr, i32(0));
+    Value senderReady = builder.create<ttkernel::GetNocAddrXYOp>(
+        loc, i32(sender[1]), i32(sender[0]), readySem);
+    builder.create<ttkernel::NocSemaphoreIncOp>(loc, senderReady, i32(1),
+                                                i32(0));
+  }
+
+  static void emitMulticastReceiverWait(OpBuilder &builder, Location loc,
+                                        int32_t semaphoreArgIndex) {
+    Value validSem = getSemaphoreAddress(builder, loc, semaphoreArgIndex + 1);
+    Value validPtr = builder.create<ttkernel::CastToL1PtrOp>(loc, validSem);
+    builder.create<ttkernel::NocSemaphoreWaitOp>(
+        loc, validPtr,
+        builder.create<arith::ConstantOp>(loc, builder.getI32IntegerAttr(1)));
+  }
+
+  static void emitMulticastSend(OpBuilder &builder, Location loc,
+                                const StreamedOperand &operand,
+                                const MulticastGroup &group,
+                                int32_t semaphoreArgIndex, Value shard,
+                                int64_t size) {
+    auto i32 = [&](int64_t value) -> Value {
+      return builder.create<arith::ConstantOp>(
+          loc, builder.getI32IntegerAttr(value));
+    };
+    std::array<int64_t, 2> start = operand.coordMappping[group.sender];
+    std::array<int64_t, 2> last = operand.coordMappping[group.last()];
+    auto multicastAddr = [&](Value addr) -> Value {
+      return builder.create<ttkernel::GetNocMulticastAddrOp>(
+          loc, i32(start[1]), i32(start[0]), i32(last[1]), i32(last[0]), addr,
+          Value());
+    };
+
+    Value readySem = getSemaphoreAddress(builder, loc, semaphoreArgIndex);
+    Value validSem = getSemaphoreAddress(builder, loc, semaphoreArgIndex + 1);
+
+    Value readyPtr = builder.create<ttkernel::CastToL1PtrOp>(loc, readySem);
+    builder.create<ttkernel::NocSemaphoreWaitOp>(loc, readyPtr,
+                                                 i32(group.size() - 1));
+    builder.create<ttkernel::NocSemaphoreSetOp>(loc, readyPtr, i32(0));
+
+    builder.create<ttkernel::NocAsyncWriteMulticastLoopbackSrcOp>(
+        loc, shard, multicastAddr(shard), i32(size), i32(group.size()),
+        BoolAttr(), BoolAttr(), Value());
+
+    Value validPtr = builder.create<ttkernel::CastToL1PtrOp>(loc, validSem);
+    builder.create<ttkernel::NocSemaphoreSetOp>(loc, validPtr, i32(1));
+    builder.create<ttkernel::NocSemaphoreSetMulticastLoopbackOp>(
+        loc, validSem, multicastAddr(validSem), i32(group.size()),
+        builder.getBoolAttr(false), builder.getBoolAttr(false));
+    builder.create<ttkernel::NocAsyncWriteBarrierOp>(loc);
+  }
+
+  // Appended to the sender's reader thread once the shard is in its CB.
+  static void createMulticastSender(
+      Location loc, Block *block, const StreamedOperand &operand,
+      ArrayRef<TTIRToTTMetalLayoutRewriter::NocTx> transactions,
+      const MulticastGroup &group, int32_t semaphoreArgIndex) {
+    OpBuilder builder = OpBuilder::atBlockEnd(block);
+    std::int64_t begin = std::numeric_limits<std::int64_t>::max();
+    std::int64_t end = 0;
+    for (auto const &tx : transactions) {
+      begin = std::min(begin, tx.dstOffset);
+      end = std::max(end, tx.dstOffset + tx.size);
+    }
+    Value shard = builder.create<arith::ConstantOp>(
+        loc, builder.getI32IntegerAttr(operand.dstAddress + begin));
+    emitMulticastSend(builder, loc, operand, group, semaphoreArgIndex, shard,
+                      end - begin);
+  }
+
+  // Reader thread of a multicast receiver: rather than reading the shard, it
+  // reserves its CB, takes part in the handshake and pushes the shard the
+  // sender wrote into it.
+  static void createMulticastReceiver(
+      Location loc, Block *block, Value cb, const StreamedOperand &operand,
+      ArrayRef<TTIRToTTMetalLayoutRewriter::NocTx> transactions,
+      const MulticastGroup &group, int32_t semaphoreArgIndex) {
+    OpBuilder builder = OpBuilder::atBlockEnd(block);
+    int32_t numTiles = 0;
+    for (auto const &tx : transactions) {
+      numTiles += tx.numElements;
+    }
+    Value numPages = builder.create<arith::ConstantOp>(
+        loc, builder.getI32IntegerAttr(numTiles));
+    builder.create<ttkernel::CBReserveBackOp>(loc, cb, numPages);
+    emitMulticastReceiverReady(builder, loc, operand, group,
+                               semaphoreArgIndex);
+    emitMulticastReceiverWait(builder, loc, semaphoreArgIndex);
+    builder.create<ttkernel::CBPushBackOp>(loc, cb, numPages);
+  }
+
+  struct PipelinedStream {
+    Value cb;
+    const StreamedOperand *operand;
+    ArrayRef<TTIRToTTMetalLayoutRewriter::NocTx> transactions;
+    // Set if the core is part of a multicast group for the operand. Only the
+    // sender reads the blocks, receivers get them multicast.
+    const MulticastGroup *group = nullptr;
+    bool isSender = false;
+    int32_t semaphoreArgIndex = -1;
+
+    bool isReceiver() const { return group && !isSender; }
+  };
+
+  // Emits a reader thread that streams every pipelined operand into its CB one
+  // block (shard row) at a time:
+  //   for (k = 0; k < numBlocks; ++k) {
+  //     for each operand: cb_reserve_back(cb, blockTiles)
+  //                       noc_async_read(...) for each piece of block k
+  //     noc_async_read_barrier()
+  //     for each operand: cb_push_back(cb, blockTiles)
+  //   }
+  // Transactions are split at block boundaries and their destinations are
+  // remapped onto the CB ring, i.e. block k lands in slot k % numBuffers. The
+  // per-block ranges of the transaction table are kept in a second table.
+  //
+  // Operands the core receives by multicast skip the reads; every block of
+  // them goes through the multicast handshake instead, with the receivers
+  // signalling ready right after reserving their slot so that the sender's
+  // reads overlap with the handshake. All cores walk the blocks, and the
+  // operands within a block, in the same order, so the handshakes cannot
+  // wait on each other in a cycle.
+  static void
+  createPipelinedDataMovementThread(Location loc, Block *block,
+                                    ArrayRef<PipelinedStream> streams,
+                                    std::int64_t addressAlignment) {
+    OpBuilder builder = OpBuilder::atBlockEnd(block);
+    constexpr int32_t entrySize = 4;
+
+    auto i32 = [&](int32_t value) -> Value {
+      return builder.create<arith::ConstantOp>(
+          loc, builder.getI32IntegerAttr(value));
+    };
+    auto index = [&](int64_t value) -> Value {
+      return builder.create<arith::ConstantOp>(loc,
+                                               builder.getIndexAttr(value));
+    };
+    auto createTable = [&](ArrayRef<int32_t> entries, int32_t numColumns) {
+      auto tableType = MemRefType::get(
+          {static_cast<int32_t>(entries.size() / numColumns), numColumns},
+          builder.getI32Type(),
+          AffineMap::getMultiDimIdentityMap(2, builder.getContext()));
+      return builder.create<ttkernel::NocTransactionsTableOp>(
+          loc, tableType, builder.getDenseI32ArrayAttr(entries));
+    };
+
+    const std::int64_t numBlocks = streams.front().operand->getNumBlocks();
+    SmallVector<std::pair<Value, Value>> tables;
+    for (const PipelinedStream &stream : streams) {
+      const StreamedOperand &operand = *stream.operand;
+      assert(operand.getNumBlocks() == static_cast<uint64_t>(numBlocks) &&
+             "Pipelined operands must have the same number of blocks");
+      const std::int64_t blockSize = operand.blockSizeBytes;
+
+      SmallVector<SmallVector<int32_t>> blockEntries(numBlocks);
+      for (auto const &tx : stream.transactions) {
+        assert(tx.type == TTIRToTTMetalLayoutRewriter::NocTx::Type::Read);
+        for (std::int64_t offset = 0; offset < tx.size;) {
+          std::int64_t dstOffset = tx.dstOffset + offset;
+          std::int64_t blockIdx = dstOffset / blockSize;
+          std::int64_t size = std::min(tx.size - offset,
+                                       (blockIdx + 1) * blockSize - dstOffset);
+          std::int64_t ringOffset =
+              (blockIdx % operand.numBuffers) * blockSize +
+              (dstOffset - blockIdx * blockSize);
+          assert(ringOffset % addressAlignment == 0);
+          assert((tx.srcOffset + offset) % addressAlignment == 0);
+          assert(size % addressAlignment == 0);
+
+          SmallVector<int32_t> &entries = blockEntries[blockIdx];
+          entries.emplace_back(operand.dstAddress + ringOffset);
+          entries.emplace_back(operand.srcAddress + tx.srcOffset + offset);
+          entries.emplace_back(size);
+          auto const [yPhys, xPhys] = operand.coordMappping[tx.coreCoord];
+          entries.emplace_back((yPhys << 16) | xPhys); // x:lo, y:hi
+          offset += size;
+        }
+      }
+
+      SmallVector<int32_t> entries;
+      SmallVector<int32_t> blockStarts = {0};
+      for (ArrayRef<int32_t> blockEntry : blockEntries) {
+        entries.append(blockEntry.begin(), blockEntry.end());
+        blockStarts.push_back(entries.size() / entrySize);
+      }
+      tables.emplace_back(createTable(entries, entrySize),
+                          createTable(blockStarts, 1));
+    }
+
+    auto coordWidth = i32(16);
+    auto coordMask = i32(0xFFFF);
+
+    auto blockLoop =
+        builder.create<scf::ForOp>(loc, i32(0), i32(numBlocks), i32(1));
+    builder.setInsertionPointToStart(blockLoop.getBody());
+    Value blockIdx = builder.create<arith::IndexCastOp>(
+        loc, builder.getIndexType(), blockLoop.getInductionVar());
+    Value nextBlockIdx = builder.create<arith::AddIOp>(loc, blockIdx, index(1));
+
+    for (auto [stream, table] : llvm::zip(streams, tables)) {
+      Value entriesTable = table.first;
+      Value blockStartsTable = table.second;
+      builder.create<ttkernel::CBReserveBackOp>(
+          loc, stream.cb, i32(stream.operand->blockTiles));
+      if (stream.isReceiver()) {
+        emitMulticastReceiverReady(builder, loc, *stream.operand,
+                                   *stream.group, stream.semaphoreArgIndex);
+        continue;
+      }
+
+      Value begin = builder.create<memref::LoadOp>(
+          loc, blockStartsTable, ValueRange{blockIdx, index(0)});
+      Value end = builder.create<memref::LoadOp>(
+          loc, blockStartsTable, ValueRange{nextBlockIdx, index(0)});
+      auto loop = builder.create<scf::ForOp>(loc, begin, end, i32(1));
+
+      OpBuilder::InsertionGuard guard(builder);
+      builder.setInsertionPointToStart(loop.getBody());
+      Value entry = builder.create<arith::IndexCastOp>(
+          loc, builder.getIndexType(), loop.getInductionVar());
+      auto load = [&](int64_t slot) -> Value {
+        return builder.create<memref::LoadOp>(loc, entriesTable,
+                                              ValueRange{entry, index(slot)});
+      };
+      Value dst = load(0);
+      Value src = load(1);
+      Value size = load(2);
+      Value xy = load(3);
+      auto x = builder.create<arith::AndIOp>(loc, xy, coordMask);
+      auto y = builder.create<arith::ShRUIOp>(loc, xy, coordWidth);
+      auto srcRemote =
+          builder.create<ttkernel::GetNocAddrXYOp>(loc, x, y, src).getResult();
+      builder.create<ttkernel::NocAsyncReadOp>(loc, srcRemote, dst, size);
+    }
+
+    builder.create<ttkernel::NocAsyncReadBarrierOp>(loc);
+    for (const PipelinedStream &stream : streams) {
+      if (stream.isReceiver()) {
+        emitMulticastReceiverWait(builder, loc, stream.semaphoreArgIndex);
+      } else if (stream.group) {
+        const StreamedOperand &operand = *stream.operand;
+        Value slot = builder.create<arith::RemUIOp>(
+            loc, blockLoop.getInductionVar(), i32(operand.numBuffers));
+        Value slotOffset = builder.create<arith::MulIOp>(
+            loc, slot, i32(operand.blockSizeBytes));
+        Value shard = builder.create<arith::AddIOp>(loc, slotOffset,
+                                                    i32(operand.dstAddress));
+        emitMulticastSend(builder, loc, operand, *stream.group,
+                          stream.semaphoreArgIndex, shard,
+                          operand.blockSizeBytes);
+      }
+    }
+    for (const PipelinedStream &stream : streams) {
+      builder.create<ttkernel::CBPushBackOp>(loc, stream.cb,
+                                             i32(stream.operand->blockTiles));
+    }
+  }
+
   void generateDataMovementThreads(
       ttir::GenericOp op, Block *tensixBlock,
       ArrayRef<StreamedOperand> streamedOperands, PatternRewriter &rewriter,
@@ -1674,12 +2465,34 @@ public:
     int dmThreadIdx = 1;
     assert(!streamedOperands.empty());
 
+    // Each multicast operand owns a pair of semaphores (ready, valid). Every
+    // data movement kernel declares all of them in the same order so that
+    // their ids agree across the cores of a group.
+    SmallVector<SmallVector<MulticastGroup>> multicastGroups(
+        streamedOperands.size());
+    SmallVector<int32_t> semaphoreArgIndices(streamedOperands.size(), -1);
+    int32_t numMulticastOperands = 0;
+    for (size_t i = 0; enableMulticast && i < streamedOperands.size(); ++i) {
+      const StreamedOperand &operand = streamedOperands[i];
+      if (!operand.hasDataMovement ||
+          numMulticastOperands == kMaxMulticastOperands) {
+        continue;
+      }
+      multicastGroups[i] = findMulticastGroups(operand);
+      if (!multicastGroups[i].empty()) {
+        semaphoreArgIndices[i] = 2 * numMulticastOperands++;
+      }
+    }
+
     llvm::DenseMap<PhysicalCoreCoord, Block *> coordToBlock;
-    for (auto operand : streamedOperands) {
+    llvm::MapVector<Block *, SmallVector<PipelinedStream>> pipelinedStreams;
+    for (size_t operandIdx = 0; operandIdx < streamedOperands.size();
+         ++operandIdx) {
+      const StreamedOperand &operand = streamedOperands[operandIdx];
       if (!operand.hasDataMovement) {
         continue;
       }
-      for (auto [dstCoord, srcs] : operand.dataMovement) {
+      for (auto &[dstCoord, srcs] : operand.dataMovement) {
         Block *block = coordToBlock.find(dstCoord) == coordToBlock.end()
                            ? rewriter.createBlock(
                                  &metalEnqueueProgram.getRegion(dmThreadIdx++))
@@ -1689,15 +2502,50 @@ public:
         block->addArgument(rewrittenBlockArgumentTypes[operand.blockArgIndex],
                            op.getLoc());
 
-        auto streamedCB = block->getArgument(0);
+        const MulticastGroup *group = nullptr;
+        for (const MulticastGroup &candidate : multicastGroups[operandIdx]) {
+          if (candidate.contains(dstCoord)) {
+            group = &candidate;
+          }
+        }
+
+        if (operand.isPipelined()) {
+          // Pipelined operands on the same core are read block by block in
+          // lockstep, see createPipelinedDataMovementThread.
+          pipelinedStreams[block].push_back(
+              {block->getArguments().back(), &operand, srcs, group,
+               group && group->sender == dstCoord,
+               semaphoreArgIndices[operandIdx]});
+          continue;
+        }
+
+        auto streamedCB = block->getArguments().back();
+
+        if (group && !(group->sender == dstCoord)) {
+          createMulticastReceiver(op->getLoc(), block, streamedCB, operand,
+                                  srcs, *group,
+                                  semaphoreArgIndices[operandIdx]);
+          continue;
+        }
 
         TTIRToTTMetalLayoutRewriter::createDataMovementThread(
             op->getLoc(), block, operand.srcAddress, operand.dstAddress, srcs,
             operand.coordMappping, op.getSystemDesc().getAddressAlignBytes(),
             &streamedCB);
+
+        if (group) {
+          createMulticastSender(op->getLoc(), block, operand, srcs, *group,
+                                semaphoreArgIndices[operandIdx]);
+        }
       }
     }
 
+    for (auto &[block, streams] : pipelinedStreams) {
+      createPipelinedDataMovementThread(
+          op->getLoc(), block, streams,
+          op.getSystemDesc().getAddressAlignBytes());
+    }
+
     if (needScaler(op)) {
       if (coordToBlock.empty()) {
         // No data movement, so we need to add a block for the scaler.
@@ -1717,6 +2565,10 @@ public:
 
     // Finish all blocks with return op.
     for (auto [coord, block] : coordToBlock) {
+      for (int32_t i = 0; i < 2 * numMulticastOperands; ++i) {
+        block->addArgument(rewriter.getType<ttkernel::SemaphoreType>(0),
+                           op.getLoc());
+      }
       OpBuilder builder = OpBuilder::atBlockEnd(block);
       builder.create<ttkernel::ReturnOp>(op.getLoc());
     }
@@ -1726,7 +2578,8 @@ public:
   addSyncronizationForDataMovement(ttir::GenericOp op, Block *tensixBlock,
                                    ArrayRef<StreamedOperand> streamedOperands) {
     for (auto operand : streamedOperands) {
-      if (operand.hasDataMovement) {
+      // Pipelined operands are waited on block by block inside the loop nest.
+      if (operand.hasDataMovement && !operand.isPipelined()) {
         // There is some data movement. Let's just insert waiting command at the
         // start of compute block. We assume whole block is streamed.
         OpBuilder builder(tensixBlock, tensixBlock->begin());
@@ -1769,6 +2622,13 @@ public:
         rewriter.getAttr<ttmetal::CoreRangeAttr>(op.getGrid()),
     };
 
+    if (isMatmul(op) &&
+        !llvm::all_of(op->getOperandTypes(), [](Type type) {
+          return mlir::cast<RankedTensorType>(type).getRank() == 2;
+        })) {
+      return rewriter.notifyMatchFailure(op, "Only rank 2 matmul is supported");
+    }
+
     SmallVector<Type> rewrittenBlockArgumentTypes;
     SmallVector<StreamedOperand> streamedOperands;
     std::tie(rewrittenBlockArgumentTypes, streamedOperands) =
@@ -1782,7 +2642,9 @@ public:
     // unique kernel for data movement, while in the future we'll want to merge
     // them into less kernels if possible and configure them through kernel
     // configs. Operands that have no data movement simply cover whole op grid.
-    llvm::DenseMap<PhysicalCoreCoord, SmallVector<int64_t, 2>> allDstCoords;
+    // The coords are kept in first-seen order, which is also the order data
+    // movement kernels are assigned to regions in.
+    llvm::MapVector<PhysicalCoreCoord, SmallVector<int64_t, 2>> allDstCoords;
     for (auto operand : streamedOperands) {
       for (auto [dstCoord, srcs] : operand.dataMovement) {
         if (allDstCoords.find(dstCoord) != allDstCoords.end() &&
@@ -1791,9 +2653,10 @@ public:
           // overwrite it by this operand which has no data movement.
           continue;
         }
-        allDstCoords.try_emplace(dstCoord, operand.hasDataMovement
-                                               ? SmallVector<int64_t>({1, 1})
-                                               : op.getGrid().getShape());
+        allDstCoords.insert({dstCoord, operand.hasDataMovement
+                                           ? SmallVector<int64_t, 2>({1, 1})
+                                           : SmallVector<int64_t, 2>(
+                                                 op.getGrid().getShape())});
       }
     }
 
@@ -1833,8 +2696,29 @@ public:
                                 metalEnqueueProgram,
                                 rewrittenBlockArgumentTypes);
 
-    lowerBlock(&op->getRegion(0).front(), tensixBlock, op.getIteratorTypes(),
-               op.getIndexingMaps(), op.getInputs().size());
+    if (isMatmul(op)) {
+      uint64_t numKBlocks = streamedOperands.front().getNumBlocks();
+      if (numKBlocks > 1) {
+        // Partial sums are spilled into the output shard between K blocks.
+        // This is safe because the partials CB is exactly one output shard
+        // in size and every K block walks the output tiles in the same
+        // order: tile t is always popped from, and pushed back to, slot t,
+        // which is also where the last K block packs output tile t. A slot
+        // is only overwritten after its partial was copied into DST, as the
+        // packer waits on the math thread, which waits on the unpacker.
+        auto outputCB = mlir::cast<ttkernel::CBType>(
+            rewrittenBlockArgumentTypes[op.getInputs().size()]);
+        tensixBlock->addArgument(
+            rewriter.getType<ttkernel::CBType>(ttkernel::CBPort::Intermed0,
+                                               outputCB.getAddress(),
+                                               outputCB.getMemref()),
+            op.getLoc());
+      }
+      lowerMatmulBlock(&op->getRegion(0).front(), tensixBlock, numKBlocks);
+    } else {
+      lowerBlock(&op->getRegion(0).front(), tensixBlock, op.getIteratorTypes(),
+                 op.getIndexingMaps(), op.getInputs().size());
+    }
 
     addSyncronizationForDataMovement(op, tensixBlock, streamedOperands);
 
@@ -1853,6 +2737,10 @@ public:
 
     return success();
   }
+
+private:
+  unsigned numStreamBuffers;
+  bool enableMulticast;
 };
 } // namespace
 
@@ -1904,12 +2792,15 @@ namespace mlir::tt {
 
 void populateTTIRToTTMetalPatterns(MLIRContext *ctx,
                                    RewritePatternSet &patterns,
-                                   TypeConverter & /*typeConverter*/) {
+                                   TypeConverter & /*typeConverter*/,
+                                   unsigned numStreamBuffers,
+                                   bool enableMulticast) {
   patterns.add<ttmetal::TTIRToTTMetalLayoutRewriter,
-               ttmetal::TTIRToTTMetalEnqueueProgramRewriter,
                ttmetal::TTIRToTTMetalAllocRewriter,
                ttmetal::TTIRToTTMetalDeallocRewriter,
                ttmetal::TTIRToTTMetalFillRewriter>(ctx);
+  patterns.add<ttmetal::TTIRToTTMetalEnqueueProgramRewriter>(
+      ctx, numStreamBuffers, enableMulticast);
 }
 
 } // namespace mlir::tt
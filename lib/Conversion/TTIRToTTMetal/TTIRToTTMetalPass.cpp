@@ -32,6 +32,9 @@ namespace {
 
 struct ConvertTTIRToTTMetal
     : public ttir::impl::ConvertTTIRToTTMetalBase<ConvertTTIRToTTMetal> {
+  using ttir::impl::ConvertTTIRToTTMetalBase<
+      ConvertTTIRToTTMetal>::ConvertTTIRToTTMetalBase;
+
   void runOnOperation() final {
     mlir::ConversionTarget target(getContext());
     target.addLegalDialect<BuiltinDialect>();
@@ -48,7 +51,8 @@ struct ConvertTTIRToTTMetal
     typeConverter.addConversion([](Type type) { return type; });
 
     RewritePatternSet patterns(&getContext());
-    populateTTIRToTTMetalPatterns(&getContext(), patterns, typeConverter);
+    populateTTIRToTTMetalPatterns(&getContext(), patterns, typeConverter,
+                                  numStreamBuffers, enableMulticast);
 
     // Apply full conversion
     //
@@ -68,4 +72,9 @@ std::unique_ptr<OperationPass<ModuleOp>> createConvertTTIRToTTMetalPass() {
   return std::make_unique<ConvertTTIRToTTMetal>();
 }
 
+std::unique_ptr<OperationPass<ModuleOp>> createConvertTTIRToTTMetalPass(
+    const ttir::ConvertTTIRToTTMetalOptions &options) {
+  return std::make_unique<ConvertTTIRToTTMetal>(options);
+}
+
 } // namespace mlir::tt
@@ -597,6 +597,72 @@ public:
 };
 } // namespace
 
+namespace {
+class PagedUpdateCacheOpConversionPattern
+    : public OpConversionPattern<ttir::PagedUpdateCacheOp> {
+public:
+  using OpConversionPattern<ttir::PagedUpdateCacheOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(ttir::PagedUpdateCacheOp op, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    // Like UpdateCacheOp, this op is in-place in TTNN and has to be the last
+    // use of the cache tensor.
+    if (!op.getCache().hasOneUse()) {
+      return rewriter.notifyMatchFailure(
+          op, "PagedUpdateCacheOp must have exactly one user");
+    }
+
+    rewriter.create<ttnn::PagedUpdateCacheOp>(
+        op.getLoc(), adaptor.getCache(), adaptor.getInput(),
+        adaptor.getUpdateIndex(), adaptor.getPageTable());
+
+    rewriter.replaceOp(op, adaptor.getCache());
+    return success();
+  }
+};
+} // namespace
+
+namespace {
+class ScaledDotProductAttentionOpConversionPattern
+    : public OpConversionPattern<ttir::ScaledDotProductAttentionOp> {
+public:
+  using OpConversionPattern<
+      ttir::ScaledDotProductAttentionOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(ttir::ScaledDotProductAttentionOp op, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    rewriter.replaceOpWithNewOp<ttnn::ScaledDotProductAttentionOp>(
+        op, this->getTypeConverter()->convertType(op.getType()),
+        adaptor.getQuery(), adaptor.getKey(), adaptor.getValue(),
+        adaptor.getAttentionMask(), adaptor.getIsCausalAttr(),
+        adaptor.getScaleAttr());
+    return success();
+  }
+};
+} // namespace
+
+namespace {
+class PagedScaledDotProductAttentionDecodeOpConversionPattern
+    : public OpConversionPattern<ttir::PagedScaledDotProductAttentionDecodeOp> {
+public:
+  using OpConversionPattern<
+      ttir::PagedScaledDotProductAttentionDecodeOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(ttir::PagedScaledDotProductAttentionDecodeOp op,
+                  OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    rewriter.replaceOpWithNewOp<ttnn::PagedScaledDotProductAttentionDecodeOp>(
+        op, this->getTypeConverter()->convertType(op.getType()),
+        adaptor.getQuery(), adaptor.getKeyCache(), adaptor.getValueCache(),
+        adaptor.getPageTable(), adaptor.getCurPos(), adaptor.getScaleAttr());
+    return success();
+  }
+};
+} // namespace
+
 namespace {
 template <typename TTIROpTy, typename TTNNOpTy,
           typename OpAdaptor = typename TTIROpTy::Adaptor>
@@ -867,9 +933,38 @@ public:
           fillValueAttr);
 
     } else {
-      return rewriter.notifyMatchFailure(
-          op, "TTNN doesn't currently support tensor creation from multiple "
-              "given values (issue #685)");
+      // Non-splat values are materialized from the tensor-data section of the
+      // binary. Device and memory config only exist if the result lives on
+      // device.
+      //
+      ttnn::TTNNLayoutAttr layoutAttr = mlir::cast<ttnn::TTNNLayoutAttr>(
+          mlir::cast<RankedTensorType>(
+              this->getTypeConverter()->convertType(op.getType()))
+              .getEncoding());
+      ttnn::TensorMemoryLayoutAttr memLayout = layoutAttr.getMemLayout();
+
+      auto device =
+          memLayout
+              ? mlir::Value(::ttnn::utils::getOrInsertDevice(rewriter, op))
+              : nullptr;
+
+      ttnn::MemoryConfigAttr memoryConfigAttr =
+          memLayout
+              ? ttnn::MemoryConfigAttr::get(
+                    op.getContext(),
+                    ttnn::BufferTypeAttr::get(op.getContext(),
+                                              layoutAttr.getBufferType()),
+                    ttnn::ShardSpecAttr::get(
+                        op.getContext(),
+                        ttnn::ShapeAttr::get(
+                            op.getContext(),
+                            layoutAttr.getMemref().getShape())),
+                    memLayout)
+              : nullptr;
+
+      rewriter.replaceOpWithNewOp<ttnn::ConstantOp>(
+          op, this->getTypeConverter()->convertType(op.getType()), valueAttr,
+          device, memoryConfigAttr);
     }
 
     return success();
@@ -1299,20 +1394,51 @@ public:
   matchAndRewrite(ttir::AllReduceOp op, OpAdaptor adaptor,
                   ConversionPatternRewriter &rewriter) const override {
 
-    auto replicaGroupsShape = adaptor.getReplicaGroups().getType().getShape();
+    auto replicaGroups = adaptor.getReplicaGroups();
     size_t scatter_dim = adaptor.getDim();
-    // scatter_num is needed when determining the output shape of workaround
-    // pass of reduce_scatter output and all_gather input
-    int32_t scatter_num =
-        replicaGroupsShape[scatter_dim % replicaGroupsShape.size()];
+    // Every replica group reduces over scatter_num devices, which is also the
+    // number of pieces the input is scattered into when the all_reduce is
+    // lowered to reduce_scatter and all_gather.
+    int32_t scatter_num = replicaGroups.getType().getShape()[1];
+    std::optional<int32_t> clusterAxis =
+        getClusterAxis(replicaGroups, getCurrentScopeDevice(op));
     auto device = ::ttnn::utils::getOrInsertDevice(rewriter, op);
     rewriter.replaceOpWithNewOp<ttnn::AllReduceOp>(
         op, this->getTypeConverter()->convertType(op.getType(0)),
         adaptor.getInputs().front(), device, scatter_dim, scatter_num,
-        adaptor.getReduceType());
+        adaptor.getReduceType(), /*num_links=*/1,
+        clusterAxis ? rewriter.getSI32IntegerAttr(*clusterAxis)
+                    : IntegerAttr());
 
     return success();
   }
+
+private:
+  // Finds the mesh axis the replica groups reduce along. Groups of
+  // consecutive device ids lie along axis 1 and groups strided by a mesh row
+  // lie along axis 0. A single group spanning a 2D mesh reduces along both
+  // axes, which is represented by leaving the axis unset.
+  static std::optional<int32_t>
+  getClusterAxis(DenseIntElementsAttr replicaGroups, DeviceAttr deviceAttr) {
+    llvm::SmallVector<int64_t> meshShape{deviceAttr.getMeshShape()};
+    if (meshShape.size() != 2) {
+      return 1;
+    }
+    int64_t groupSize = replicaGroups.getType().getShape()[1];
+    if (meshShape[0] > 1 && meshShape[1] > 1 &&
+        groupSize == meshShape[0] * meshShape[1]) {
+      return std::nullopt;
+    }
+    if (meshShape[0] > 1 && meshShape[1] == 1) {
+      return 0;
+    }
+    auto deviceIds = replicaGroups.getValues<int64_t>();
+    if (groupSize > 1 && meshShape[1] > 1 &&
+        deviceIds[1] - deviceIds[0] == meshShape[1]) {
+      return 0;
+    }
+    return 1;
+  }
 };
 } // namespace
 
@@ -1351,7 +1477,8 @@ public:
     auto device = ::ttnn::utils::getOrInsertDevice(rewriter, op);
     rewriter.replaceOpWithNewOp<ttnn::AllGatherOp>(
         op, this->getTypeConverter()->convertType(op.getType()),
-        adaptor.getInput(), device, adaptor.getDim());
+        adaptor.getInput(), device, adaptor.getDim(), /*num_links=*/1,
+        adaptor.getClusterAxis());
     return success();
   }
 };
@@ -1542,6 +1669,9 @@ void populateTTIRToTTNNPatterns(MLIRContext *ctx, RewritePatternSet &patterns,
            ArangeOpConversionPattern,
            UpdateCacheOpConversionPattern,
            FillCacheOpConversionPattern,
+           PagedUpdateCacheOpConversionPattern,
+           ScaledDotProductAttentionOpConversionPattern,
+           PagedScaledDotProductAttentionDecodeOpConversionPattern,
            ScatterOpConversionPattern,
            PermuteOpConversionPattern,
            UpsampleOpConversionPattern
@@ -596,6 +596,9 @@ public:
           TTMetalToEmitCOpaqueRewriter<ttkernel::AddTilesOp>,
           TTMetalToEmitCOpaqueRewriter<ttkernel::MulTilesOp>,
           TTMetalToEmitCOpaqueRewriter<ttkernel::MaxTilesOp>,
+          TTMetalToEmitCOpaqueRewriter<ttkernel::MatmulInitOp>,
+          TTMetalToEmitCOpaqueRewriter<ttkernel::MatmulInitShortOp>,
+          TTMetalToEmitCOpaqueRewriter<ttkernel::MatmulTilesOp>,
           TTMetalToEmitCOpaqueRewriter<ttkernel::ReduceInitOp>,
           TTMetalToEmitCOpaqueRewriter<ttkernel::ReduceTileOp>,
           TTMetalToEmitCOpaqueRewriter<ttkernel::GetNocAddrOp>,
@@ -681,6 +684,8 @@ public:
       builder->create<emitc::IncludeOp>(loc,
                                         "compute_kernel_api/tile_move_copy.h",
                                         /*isStandard=*/false);
+      builder->create<emitc::IncludeOp>(loc, "compute_kernel_api/matmul.h",
+                                        /*isStandard=*/false);
       builder->create<emitc::IncludeOp>(
           loc, "compute_kernel_api/eltwise_unary/eltwise_unary.h",
           /*isStandard=*/false);
@@ -1367,6 +1367,16 @@ void populateTTNNToEmitCPatterns(mlir::MLIRContext *ctx,
                                                                 ctx);
   patterns.add<DefaultOpConversionPattern<ttnn::FillCacheOp>>(typeConverter,
                                                               ctx);
+  patterns.add<DefaultOpConversionPattern<ttnn::PagedUpdateCacheOp>>(
+      typeConverter, ctx);
+
+  // Transformer ops
+  //
+  patterns.add<DefaultOpConversionPattern<ttnn::ScaledDotProductAttentionOp>>(
+      typeConverter, ctx);
+  patterns.add<
+      DefaultOpConversionPattern<ttnn::PagedScaledDotProductAttentionDecodeOp>>(
+      typeConverter, ctx);
 
   // Arith ops
   //
@@ -4,10 +4,12 @@
 
 #include "ttmlir/Conversion/TTNNToEmitC/TTNNToEmitC.h"
 
+#include "ttmlir/Conversion/TTNNToEmitC/Utils.h"
 #include "ttmlir/Dialect/TTNN/IR/TTNN.h"
 #include "ttmlir/Dialect/TTNN/IR/TTNNOps.h"
 #include "ttmlir/Dialect/TTNN/IR/TTNNOpsAttrs.h"
 #include "ttmlir/Dialect/TTNN/IR/TTNNOpsTypes.h"
+#include "ttmlir/Dialect/TTNN/Utils/Utils.h"
 
 #include "mlir/Dialect/EmitC/IR/EmitC.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
@@ -15,8 +17,13 @@
 #include "mlir/IR/BuiltinOps.h"
 #include "mlir/IR/BuiltinTypes.h"
 #include "mlir/IR/MLIRContext.h"
+#include "mlir/IR/SymbolTable.h"
 #include "mlir/Support/LogicalResult.h"
 #include "mlir/Transforms/DialectConversion.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/ADT/StringMap.h"
 
 using namespace mlir;
 using namespace mlir::tt;
@@ -47,6 +54,268 @@ public:
   }
 };
 
+// Returns whether values of `type` are passed into functions by const
+// reference rather than copied.
+//
+bool isPassedByConstRef(Type type) {
+  auto opaqueType = mlir::dyn_cast<emitc::OpaqueType>(type);
+  return opaqueType && (opaqueType.getValue() == "ttnn::Tensor" ||
+                        opaqueType.getValue() == "std::vector<ttnn::Tensor>");
+}
+
+emitc::OpaqueType getConstRefType(Type type) {
+  return emitc::OpaqueType::get(
+      type.getContext(),
+      "const " + mlir::cast<emitc::OpaqueType>(type).getValue().str() + " &");
+}
+
+// Casts the operands of `op` whose types differ from `types`.
+//
+void castOperands(Operation *op, TypeRange types) {
+  OpBuilder builder(op);
+  for (auto [operand, type] : llvm::zip(op->getOpOperands(), types)) {
+    if (operand.get().getType() != type) {
+      operand.set(builder.create<emitc::CastOp>(op->getLoc(), type,
+                                                operand.get()));
+    }
+  }
+}
+
+// Returns the C++ expression constructing the object created by `callOp`, or
+// an empty string if one of its arguments isn't an opaque attribute.
+//
+std::string getConstructorExpression(emitc::CallOpaqueOp callOp) {
+  llvm::SmallVector<StringRef> args;
+  if (ArrayAttr argsAttr = callOp.getArgsAttr()) {
+    for (Attribute arg : argsAttr) {
+      auto opaqueArg = mlir::dyn_cast<emitc::OpaqueAttr>(arg);
+      if (!opaqueArg) {
+        return "";
+      }
+      args.push_back(opaqueArg.getValue());
+    }
+  }
+  return (callOp.getCallee() + "(" + llvm::join(args, ", ") + ")").str();
+}
+
+// Constructs each distinct ttnn::Shape and ttnn::MemoryConfig used in the
+// module only once per program, as a static global, instead of before every
+// op that uses it. Each use binds a const reference to the global in place
+// of the construction. The global is itself declared as a const reference
+// to the constructed temporary, whose lifetime it extends, since the value
+// type of `emitc.get_global` must match the type of the global.
+//
+void hoistConstantObjects(ModuleOp moduleOp) {
+  SymbolTable symbolTable(moduleOp);
+  OpBuilder moduleBuilder(moduleOp.getContext());
+  Block *moduleBody = moduleOp.getBody();
+  moduleBuilder.setInsertionPointToStart(moduleBody);
+  for (Operation &op : *moduleBody) {
+    if (!mlir::isa<emitc::IncludeOp>(op)) {
+      moduleBuilder.setInsertionPoint(&op);
+      break;
+    }
+  }
+
+  llvm::StringMap<emitc::GlobalOp> globals;
+  for (func::FuncOp funcOp : llvm::to_vector(moduleOp.getOps<func::FuncOp>())) {
+    if (funcOp.isDeclaration()) {
+      continue;
+    }
+
+    llvm::SmallVector<emitc::CallOpaqueOp> callOps;
+    funcOp.walk([&](emitc::CallOpaqueOp callOp) {
+      if ((callOp.getCallee() == "ttnn::Shape" ||
+           callOp.getCallee() == "ttnn::MemoryConfig") &&
+          callOp.getNumOperands() == 0 && !callOp.getTemplateArgsAttr()) {
+        callOps.push_back(callOp);
+      }
+    });
+
+    for (emitc::CallOpaqueOp callOp : callOps) {
+      std::string initializer = getConstructorExpression(callOp);
+      if (initializer.empty()) {
+        continue;
+      }
+
+      emitc::OpaqueType refType =
+          getConstRefType(callOp.getResult(0).getType());
+      auto [globalIt, inserted] = globals.try_emplace(initializer);
+      if (inserted) {
+        StringRef prefix =
+            callOp.getCallee() == "ttnn::Shape" ? "shape_" : "memory_config_";
+        globalIt->second = moduleBuilder.create<emitc::GlobalOp>(
+            callOp.getLoc(),
+            moduleBuilder.getStringAttr(prefix + Twine(globals.size() - 1)),
+            refType, emitc::OpaqueAttr::get(moduleOp.getContext(), initializer),
+            /*extern_specifier=*/false, /*static_specifier=*/true,
+            /*const_specifier=*/false);
+        symbolTable.insert(globalIt->second);
+      }
+
+      OpBuilder builder(callOp);
+      auto getGlobalOp = builder.create<emitc::GetGlobalOp>(
+          callOp.getLoc(), emitc::LValueType::get(refType),
+          globalIt->second.getSymName());
+      auto loadOp = builder.create<emitc::LoadOp>(callOp.getLoc(), refType,
+                                                  getGlobalOp.getResult());
+      callOp.getResult(0).replaceAllUsesWith(loadOp.getResult());
+      callOp.erase();
+    }
+  }
+}
+
+// Passes tensors and vectors of tensors into functions by const reference.
+// Elements of such vectors are bound to const references instead of being
+// copied out, and casts are inserted where values passed to or returned
+// from functions no longer match their signatures.
+//
+void passTensorsByConstRef(ModuleOp moduleOp) {
+  for (func::FuncOp funcOp : moduleOp.getOps<func::FuncOp>()) {
+    FunctionType funcType = funcOp.getFunctionType();
+    llvm::SmallVector<Type> inputTypes;
+    for (Type type : funcType.getInputs()) {
+      inputTypes.push_back(isPassedByConstRef(type) ? getConstRefType(type)
+                                                    : type);
+    }
+    funcOp.setFunctionType(FunctionType::get(
+        moduleOp.getContext(), inputTypes, funcType.getResults()));
+    if (funcOp.isDeclaration()) {
+      continue;
+    }
+    for (BlockArgument arg : funcOp.getArguments()) {
+      arg.setType(inputTypes[arg.getArgNumber()]);
+    }
+  }
+
+  moduleOp.walk([&](emitc::LoadOp loadOp) {
+    auto subscriptOp = loadOp.getOperand().getDefiningOp<emitc::SubscriptOp>();
+    if (!subscriptOp || !isPassedByConstRef(loadOp.getType())) {
+      return;
+    }
+    auto valueType =
+        mlir::dyn_cast<emitc::OpaqueType>(subscriptOp.getValue().getType());
+    if (!valueType || !valueType.getValue().starts_with("const ")) {
+      return;
+    }
+    emitc::OpaqueType elementType = getConstRefType(loadOp.getType());
+    subscriptOp.getResult().setType(emitc::LValueType::get(elementType));
+    loadOp.getResult().setType(elementType);
+  });
+
+  moduleOp.walk([&](func::CallOp callOp) {
+    auto calleeOp = SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(
+        callOp, callOp.getCalleeAttr());
+    castOperands(callOp, calleeOp.getFunctionType().getInputs());
+  });
+  moduleOp.walk([&](func::ReturnOp returnOp) {
+    auto funcOp = returnOp->getParentOfType<func::FuncOp>();
+    castOperands(returnOp, funcOp.getFunctionType().getResults());
+  });
+}
+
+// Times the calls of model run entry points from benchmark driver functions
+// by routing them through `ttnn::benchmark`, which runs the callee the given
+// number of times and reports the latency of each run.
+//
+void createBenchmarkCalls(ModuleOp moduleOp) {
+  MLIRContext *context = moduleOp.getContext();
+  for (func::FuncOp funcOp : moduleOp.getOps<func::FuncOp>()) {
+    auto iterationsAttr = funcOp->getAttrOfType<IntegerAttr>(
+        ttnn::utils::kBenchmarkIterationsAttrName);
+    if (!iterationsAttr) {
+      continue;
+    }
+    funcOp->removeAttr(ttnn::utils::kBenchmarkIterationsAttrName);
+
+    llvm::SmallVector<func::CallOp> callOps;
+    funcOp.walk([&](func::CallOp callOp) {
+      auto calleeOp = SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(
+          callOp, callOp.getCalleeAttr());
+      if (calleeOp->hasAttr(ttnn::utils::kModelRunAttrName) &&
+          callOp->use_empty()) {
+        callOps.push_back(callOp);
+      }
+    });
+    for (func::CallOp callOp : callOps) {
+      llvm::SmallVector<Attribute> args = {
+          emitc::OpaqueAttr::get(context,
+                                 ("\"" + callOp.getCallee() + "\"").str()),
+          iterationsAttr, emitc::OpaqueAttr::get(context, callOp.getCallee())};
+      for (unsigned i = 0; i < callOp.getNumOperands(); i++) {
+        args.push_back(IntegerAttr::get(IndexType::get(context), i));
+      }
+      OpBuilder builder(callOp);
+      builder.create<emitc::CallOpaqueOp>(
+          callOp.getLoc(), TypeRange(), "ttnn::benchmark",
+          builder.getArrayAttr(args), nullptr, callOp.getOperands());
+      callOp.erase();
+    }
+  }
+
+  for (func::FuncOp funcOp : moduleOp.getOps<func::FuncOp>()) {
+    funcOp->removeAttr(ttnn::utils::kModelRunAttrName);
+  }
+}
+
+// Returns whether `user` is the last op to use `value`. Only uses in the block
+// defining `value` qualify: a use nested in a region, e.g. a loop body, may
+// run more than once.
+//
+bool isLastUse(Value value, Operation *user) {
+  Block *block = user->getBlock();
+  if (value.getParentBlock() != block) {
+    return false;
+  }
+  return llvm::all_of(value.getUsers(), [&](Operation *otherUser) {
+    return otherUser == user ||
+           (otherUser->getBlock() == block && otherUser->isBeforeInBlock(user));
+  });
+}
+
+// Moves tensors into the vectors created by the vector creation utility
+// function at their last use instead of copying them.
+//
+void moveLastUses(emitc::CallOpaqueOp callOp) {
+  auto tensorType =
+      emitc::OpaqueType::get(callOp.getContext(), "ttnn::Tensor");
+  llvm::SmallVector<bool> shouldMove;
+  for (Value operand : callOp.getOperands()) {
+    shouldMove.push_back(operand.getType() == tensorType &&
+                         llvm::count(callOp.getOperands(), operand) == 1 &&
+                         isLastUse(operand, callOp));
+  }
+  if (llvm::none_of(shouldMove, [](bool move) { return move; })) {
+    return;
+  }
+
+  // Wrap the call in an expression so that std::move is inlined into it.
+  //
+  OpBuilder builder(callOp);
+  Type resultType = callOp.getResult(0).getType();
+  auto expressionOp = builder.create<emitc::ExpressionOp>(
+      callOp.getLoc(), resultType, /*do_not_inline=*/false);
+  builder.createBlock(&expressionOp.getRegion());
+  llvm::SmallVector<Value> operands;
+  for (auto [operand, move] : llvm::zip(callOp.getOperands(), shouldMove)) {
+    if (!move) {
+      operands.push_back(operand);
+      continue;
+    }
+    operands.push_back(builder
+                           .create<emitc::CallOpaqueOp>(
+                               callOp.getLoc(), tensorType, "std::move",
+                               nullptr, nullptr, ValueRange(operand))
+                           .getResult(0));
+  }
+  emitc::CallOpaqueOp newCallOp = builder.create<emitc::CallOpaqueOp>(
+      callOp.getLoc(), resultType, callOp.getCalleeAttr(), nullptr, nullptr,
+      operands);
+  builder.create<emitc::YieldOp>(callOp.getLoc(), newCallOp.getResult(0));
+  callOp.getResult(0).replaceAllUsesWith(expressionOp.getResult());
+  callOp.erase();
+}
+
 struct ConvertTTNNToEmitCPass
     : public ttnn::impl::ConvertTTNNToEmitCBase<ConvertTTNNToEmitCPass> {
   void runOnOperation() override {
@@ -117,6 +386,27 @@ struct ConvertTTNNToEmitCPass
         return;
       }
     }
+
+    // Cut host-side copies and allocations in the generated code
+    //
+    {
+      mlir::ModuleOp module = getOperation();
+      hoistConstantObjects(module);
+      createBenchmarkCalls(module);
+      passTensorsByConstRef(module);
+
+      llvm::SmallVector<emitc::CallOpaqueOp> createVectorOps;
+      module.walk([&](emitc::CallOpaqueOp callOp) {
+        if (callOp.getCallee() ==
+                ttnn_to_emitc::utils::kCreateVectorFunctionName &&
+            !callOp.getArgsAttr()) {
+          createVectorOps.push_back(callOp);
+        }
+      });
+      for (emitc::CallOpaqueOp callOp : createVectorOps) {
+        moveLastUses(callOp);
+      }
+    }
   }
 };
 
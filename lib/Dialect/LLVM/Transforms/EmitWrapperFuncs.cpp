@@ -12,9 +12,13 @@
 #include "mlir/Pass/Pass.h"
 #include "mlir/Support/LogicalResult.h"
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/Casting.h"
 
+#include <optional>
+
 #include "ttmlir/Dialect/LLVM/Transforms/Passes.h"
 #include "ttmlir/Dialect/TT/IR/TTOps.h"
 
@@ -22,14 +26,284 @@ namespace mlir::tt::llvm_util {
 #define GEN_PASS_DEF_LLVMEMITCALLINGCONVENTIONWRAPPERFUNCS
 #include "ttmlir/Dialect/LLVM/Transforms/Passes.h.inc"
 
-// Generate wrapper func which
-void generateLLVMWrappersForArgRanks(ModuleOp moduleOp) {
-  auto *context = moduleOp.getContext();
-  OpBuilder builder(context);
+// Read the optional `arg_shapes` attribute attached by the hoist transform.
+// Returns std::nullopt if the attribute is absent or inconsistent with
+// `arg_ranks`, in which case sizes and strides must be read at runtime.
+static std::optional<SmallVector<SmallVector<int64_t>>>
+getStaticArgShapes(LLVM::LLVMFuncOp func, ArrayAttr argRanksAttr) {
+  auto argShapesAttr = func->getAttrOfType<ArrayAttr>("arg_shapes");
+  if (!argShapesAttr || argShapesAttr.size() != argRanksAttr.size()) {
+    return std::nullopt;
+  }
+
+  SmallVector<SmallVector<int64_t>> shapes;
+  for (auto [shapeAttr, rankAttr] : llvm::zip(argShapesAttr, argRanksAttr)) {
+    auto shape = dyn_cast<DenseI64ArrayAttr>(shapeAttr);
+    if (!shape || static_cast<int64_t>(shape.size()) !=
+                      mlir::cast<IntegerAttr>(rankAttr).getInt()) {
+      return std::nullopt;
+    }
+    shapes.emplace_back(shape.asArrayRef());
+  }
+  return shapes;
+}
+
+// Append sizes followed by row-major (contiguous) strides for `shape` as
+// constants, matching the order of a memref descriptor's trailing fields.
+static void appendStaticSizesAndStrides(OpBuilder &builder, Location loc,
+                                        ArrayRef<int64_t> shape,
+                                        SmallVectorImpl<Value> &callArgs) {
+  SmallVector<int64_t> strides(shape.size(), 1);
+  for (int64_t i = static_cast<int64_t>(shape.size()) - 2; i >= 0; --i) {
+    strides[i] = strides[i + 1] * shape[i + 1];
+  }
+  for (ArrayRef<int64_t> values : {shape, ArrayRef<int64_t>(strides)}) {
+    for (int64_t value : values) {
+      callArgs.push_back(builder.create<LLVM::ConstantOp>(
+          loc, builder.getI64Type(), builder.getI64IntegerAttr(value)));
+    }
+  }
+}
+
+// Unpack an array of bare data pointers (one per tensor) starting at
+// `ptrArray` into the full memref descriptor argument list of the original
+// func.  Only valid for contiguous tensors with statically known shapes.
+static SmallVector<Value>
+unpackBarePtrArgs(OpBuilder &builder, Location loc, Value ptrArray,
+                  ArrayRef<SmallVector<int64_t>> shapes) {
+  auto ptrTy = LLVM::LLVMPointerType::get(builder.getContext());
+  SmallVector<Value> callArgs;
+
+  Value zero = builder.create<LLVM::ConstantOp>(loc, builder.getI64Type(),
+                                                builder.getI64IntegerAttr(0));
+  for (auto [tensorIdx, shape] : llvm::enumerate(shapes)) {
+    Value idx = builder.create<LLVM::ConstantOp>(
+        loc, builder.getI64Type(), builder.getI64IntegerAttr(tensorIdx));
+    Value elementPtr = builder.create<LLVM::GEPOp>(
+        loc, ptrTy, ptrTy, ptrArray, ValueRange(idx), /*inbounds=*/true);
+    Value dataPtr = builder.create<LLVM::LoadOp>(loc, ptrTy, elementPtr);
+
+    // Allocated and aligned pointers are the same, and offset is always 0.
+    callArgs.push_back(dataPtr);
+    callArgs.push_back(dataPtr);
+    callArgs.push_back(zero);
+    appendStaticSizesAndStrides(builder, loc, shape, callArgs);
+  }
 
+  return callArgs;
+}
+
+// Generate `<func>_helper(ptr)` which unpacks an array of wrapped tensors
+// (start, aligned_start, start_idx, sizes_and_strides) into the expected call
+// signature.  If shapes are statically known, sizes are folded into constants.
+// Strides are always loaded from the sizes_and_strides array, since the caller
+// may pass strided views of a statically shaped tensor.
+static void generateHelperWrapper(
+    OpBuilder &builder, LLVM::LLVMFuncOp func, ArrayAttr argRanksAttr,
+    const std::optional<SmallVector<SmallVector<int64_t>>> &staticShapes) {
+  auto *context = func.getContext();
   auto ptrTy = LLVM::LLVMPointerType::get(context);
 
-  for (auto func : moduleOp.getOps<LLVM::LLVMFuncOp>()) {
+  llvm::SmallString<32> helperName(func.getName());
+  helperName.append("_helper");
+
+  auto helperFuncType = LLVM::LLVMFunctionType::get(
+      LLVM::LLVMVoidType::get(context), {LLVM::LLVMPointerType::get(context)},
+      false);
+
+  auto helperFunc = builder.create<LLVM::LLVMFuncOp>(func.getLoc(), helperName,
+                                                     helperFuncType);
+
+  Block *entryBlock = helperFunc.addEntryBlock(builder);
+  builder.setInsertionPointToStart(entryBlock);
+
+  Value structArrayPtr = entryBlock->getArgument(0);
+  SmallVector<Value, 16> originalCallArgs;
+
+  // Note we can't create typed pointer types, which is annoying.
+  auto wrappedTensorTy = LLVM::LLVMStructType::getLiteral(
+      context, {
+                   LLVM::LLVMPointerType::get(context), // start
+                   LLVM::LLVMPointerType::get(context), // aligned_start
+                   builder.getI64Type(),                // start_idx
+                   LLVM::LLVMPointerType::get(context)  // sizes_and_strides
+               });
+
+  // Iterate over arg_ranks to unpack tensors.
+  int tensorIdx = 0;
+  for (auto rankAttr : argRanksAttr) {
+    const int currentTensorIdx = tensorIdx;
+
+    // Compute the offset for the current tensor (as index * size of
+    // wrapped_tensor).
+    Value tensorIndex = builder.create<LLVM::ConstantOp>(
+        func.getLoc(), builder.getI64Type(),
+        builder.getI64IntegerAttr(tensorIdx++));
+
+    // Calculate the ptr-width offset for the tensor; 3 pointers and one i64
+    // = 4.
+    constexpr auto wrappedTensorSize = 4;
+
+    Value offset = builder.create<LLVM::MulOp>(
+        func.getLoc(), tensorIndex,
+        builder.create<LLVM::ConstantOp>(
+            func.getLoc(), builder.getI64Type(),
+            builder.getI64IntegerAttr(wrappedTensorSize)));
+
+    // Get pointer to the struct for this offset-th tensor in input array.
+    Value structPtr = builder.create<LLVM::GEPOp>(
+        func.getLoc(), ptrTy, ptrTy, structArrayPtr, ValueRange(offset),
+        /*inbounds=*/true);
+
+    // Load actual tensor object from pointer so we can extract its members.
+    Value tensorStruct =
+        builder.create<LLVM::LoadOp>(func.getLoc(), wrappedTensorTy, structPtr);
+
+    Value tensorBase = builder.create<LLVM::ExtractValueOp>(
+        func.getLoc(), ptrTy, tensorStruct, builder.getDenseI64ArrayAttr({0}));
+    originalCallArgs.push_back(tensorBase);
+
+    Value alignedBase = builder.create<LLVM::ExtractValueOp>(
+        func.getLoc(), LLVM::LLVMPointerType::get(context), tensorStruct,
+        builder.getDenseI64ArrayAttr({1}));
+    originalCallArgs.push_back(alignedBase);
+
+    Value startIdx = builder.create<LLVM::ExtractValueOp>(
+        func.getLoc(), builder.getI64Type(), tensorStruct,
+        builder.getDenseI64ArrayAttr({2}));
+    originalCallArgs.push_back(startIdx);
+
+    Value sizesAndStrides = builder.create<LLVM::ExtractValueOp>(
+        func.getLoc(), LLVM::LLVMPointerType::get(context), tensorStruct,
+        builder.getDenseI64ArrayAttr({3}));
+    // The sizesAndStrides field is an array itself, so we need to step into
+    // it and extract elements.
+    int64_t rank = mlir::cast<IntegerAttr>(rankAttr).getInt();
+    for (int i = 0; i < 2 * rank; i++) {
+      if (staticShapes && i < rank) {
+        originalCallArgs.push_back(builder.create<LLVM::ConstantOp>(
+            func.getLoc(), builder.getI64Type(),
+            builder.getI64IntegerAttr((*staticShapes)[currentTensorIdx][i])));
+        continue;
+      }
+
+      Value idx = builder.create<LLVM::ConstantOp>(
+          func.getLoc(), builder.getI64Type(), builder.getI64IntegerAttr(i));
+
+      Value elementPtr = builder.create<LLVM::GEPOp>(
+          func.getLoc(), ptrTy, ptrTy, sizesAndStrides, ValueRange{idx});
+
+      Value strideOrSize = builder.create<LLVM::LoadOp>(
+          func.getLoc(), builder.getI64Type(), elementPtr);
+
+      originalCallArgs.push_back(strideOrSize);
+    }
+  }
+
+  // Call the original functions with the unpacked args.
+  builder.create<LLVM::CallOp>(func.getLoc(), TypeRange(), func.getName(),
+                               originalCallArgs);
+
+  builder.create<LLVM::ReturnOp>(func.getLoc(), ValueRange());
+}
+
+// Generate `<func>_bare(ptr)` which takes an array of bare data pointers, one
+// per tensor.  The runtime doesn't need to build wrapped tensor structs or
+// sizes_and_strides arrays for this entry point.
+static void generateBarePtrWrapper(OpBuilder &builder, LLVM::LLVMFuncOp func,
+                                   ArrayRef<SmallVector<int64_t>> shapes) {
+  auto *context = func.getContext();
+  auto ptrTy = LLVM::LLVMPointerType::get(context);
+
+  llvm::SmallString<32> bareName(func.getName());
+  bareName.append("_bare");
+
+  auto bareFuncType = LLVM::LLVMFunctionType::get(
+      LLVM::LLVMVoidType::get(context), {ptrTy}, false);
+  auto bareFunc =
+      builder.create<LLVM::LLVMFuncOp>(func.getLoc(), bareName, bareFuncType);
+
+  Block *entryBlock = bareFunc.addEntryBlock(builder);
+  builder.setInsertionPointToStart(entryBlock);
+
+  SmallVector<Value> callArgs = unpackBarePtrArgs(
+      builder, func.getLoc(), entryBlock->getArgument(0), shapes);
+  builder.create<LLVM::CallOp>(func.getLoc(), TypeRange(), func.getName(),
+                               callArgs);
+
+  builder.create<LLVM::ReturnOp>(func.getLoc(), ValueRange());
+}
+
+// Generate `<func>_batched(ptr, i64 n)` which performs n invocations of the
+// original func in a single call.  The first argument is a row-major table of
+// n x numTensors bare data pointers, i.e. row i holds the pointers for
+// invocation i.
+static void generateBatchedWrapper(OpBuilder &builder, LLVM::LLVMFuncOp func,
+                                   ArrayRef<SmallVector<int64_t>> shapes) {
+  auto *context = func.getContext();
+  auto ptrTy = LLVM::LLVMPointerType::get(context);
+  auto i64Ty = builder.getI64Type();
+  Location loc = func.getLoc();
+
+  llvm::SmallString<32> batchedName(func.getName());
+  batchedName.append("_batched");
+
+  auto batchedFuncType = LLVM::LLVMFunctionType::get(
+      LLVM::LLVMVoidType::get(context), {ptrTy, i64Ty}, false);
+  auto batchedFunc =
+      builder.create<LLVM::LLVMFuncOp>(loc, batchedName, batchedFuncType);
+
+  Block *entryBlock = batchedFunc.addEntryBlock(builder);
+  Value ptrTable = entryBlock->getArgument(0);
+  Value numInvocations = entryBlock->getArgument(1);
+
+  // Build a simple counted loop:
+  //   entry -> header(i) -> body -> header(i + 1)
+  //                      -> exit
+  Region &body = batchedFunc.getBody();
+  Block *headerBlock = builder.createBlock(&body, body.end(), {i64Ty}, {loc});
+  Block *bodyBlock = builder.createBlock(&body, body.end());
+  Block *exitBlock = builder.createBlock(&body, body.end());
+
+  builder.setInsertionPointToEnd(entryBlock);
+  Value zero = builder.create<LLVM::ConstantOp>(loc, i64Ty,
+                                                builder.getI64IntegerAttr(0));
+  builder.create<LLVM::BrOp>(loc, ValueRange{zero}, headerBlock);
+
+  builder.setInsertionPointToEnd(headerBlock);
+  Value iv = headerBlock->getArgument(0);
+  Value cond = builder.create<LLVM::ICmpOp>(loc, LLVM::ICmpPredicate::slt, iv,
+                                            numInvocations);
+  builder.create<LLVM::CondBrOp>(loc, cond, bodyBlock, exitBlock);
+
+  builder.setInsertionPointToEnd(bodyBlock);
+  Value numTensors = builder.create<LLVM::ConstantOp>(
+      loc, i64Ty, builder.getI64IntegerAttr(shapes.size()));
+  Value rowOffset = builder.create<LLVM::MulOp>(loc, iv, numTensors);
+  Value rowPtr = builder.create<LLVM::GEPOp>(
+      loc, ptrTy, ptrTy, ptrTable, ValueRange(rowOffset), /*inbounds=*/true);
+  SmallVector<Value> callArgs =
+      unpackBarePtrArgs(builder, loc, rowPtr, shapes);
+  builder.create<LLVM::CallOp>(loc, TypeRange(), func.getName(), callArgs);
+  Value one = builder.create<LLVM::ConstantOp>(loc, i64Ty,
+                                               builder.getI64IntegerAttr(1));
+  Value next = builder.create<LLVM::AddOp>(loc, iv, one);
+  builder.create<LLVM::BrOp>(loc, ValueRange{next}, headerBlock);
+
+  builder.setInsertionPointToEnd(exitBlock);
+  builder.create<LLVM::ReturnOp>(loc, ValueRange());
+}
+
+// Generate wrapper funcs which unpack tensors into the expected call signature
+// for every func carrying an `arg_ranks` attribute.
+void generateLLVMWrappersForArgRanks(ModuleOp moduleOp, bool emitBarePtr,
+                                     bool emitBatched) {
+  auto *context = moduleOp.getContext();
+  OpBuilder builder(context);
+
+  // Collect first, since we insert new funcs into the module while iterating.
+  SmallVector<LLVM::LLVMFuncOp> funcs(moduleOp.getOps<LLVM::LLVMFuncOp>());
+  for (auto func : funcs) {
     if (!func->hasAttr("arg_ranks")) {
       continue;
     }
@@ -39,101 +313,26 @@ void generateLLVMWrappersForArgRanks(ModuleOp moduleOp) {
       continue;
     }
 
+    auto staticShapes = getStaticArgShapes(func, argRanksAttr);
+
     builder.setInsertionPointToEnd(moduleOp.getBody());
+    generateHelperWrapper(builder, func, argRanksAttr, staticShapes);
 
-    llvm::SmallString<32> helperName(func.getName());
-    helperName.append("_helper");
-
-    auto helperFuncType = LLVM::LLVMFunctionType::get(
-        LLVM::LLVMVoidType::get(context), {LLVM::LLVMPointerType::get(context)},
-        false);
-
-    auto helperFunc = builder.create<LLVM::LLVMFuncOp>(
-        func.getLoc(), helperName, helperFuncType);
-
-    Block *entryBlock = helperFunc.addEntryBlock(builder);
-    builder.setInsertionPointToStart(entryBlock);
-
-    Value structArrayPtr = entryBlock->getArgument(0);
-    SmallVector<Value, 16> originalCallArgs;
-
-    // Note we can't create typed pointer types, which is annoying.
-    auto wrappedTensorTy = LLVM::LLVMStructType::getLiteral(
-        context, {
-                     LLVM::LLVMPointerType::get(context), // start
-                     LLVM::LLVMPointerType::get(context), // aligned_start
-                     builder.getI64Type(),                // start_idx
-                     LLVM::LLVMPointerType::get(context)  // sizes_and_strides
-                 });
-
-    // Iterate over arg_ranks to unpack tensors.
-    int tensorIdx = 0;
-    for (auto rankAttr : argRanksAttr) {
-      // Compute the offset for the current tensor (as index * size of
-      // wrapped_tensor).
-      Value tensorIndex = builder.create<LLVM::ConstantOp>(
-          func.getLoc(), builder.getI64Type(),
-          builder.getI64IntegerAttr(tensorIdx++));
-
-      // Calculate the ptr-width offset for the tensor; 3 pointers and one i64
-      // = 4.
-      constexpr auto wrappedTensorSize = 4;
-
-      Value offset = builder.create<LLVM::MulOp>(
-          func.getLoc(), tensorIndex,
-          builder.create<LLVM::ConstantOp>(
-              func.getLoc(), builder.getI64Type(),
-              builder.getI64IntegerAttr(wrappedTensorSize)));
-
-      // Get pointer to the struct for this offset-th tensor in input array.
-      Value structPtr = builder.create<LLVM::GEPOp>(
-          func.getLoc(), ptrTy, ptrTy, structArrayPtr, ValueRange(offset),
-          /*inbounds=*/true);
-
-      // Load actual tensor object from pointer so we can extract its members.
-      Value tensorStruct = builder.create<LLVM::LoadOp>(
-          func.getLoc(), wrappedTensorTy, structPtr);
-
-      Value tensorBase = builder.create<LLVM::ExtractValueOp>(
-          func.getLoc(), ptrTy, tensorStruct,
-          builder.getDenseI64ArrayAttr({0}));
-      originalCallArgs.push_back(tensorBase);
-
-      Value alignedBase = builder.create<LLVM::ExtractValueOp>(
-          func.getLoc(), LLVM::LLVMPointerType::get(context), tensorStruct,
-          builder.getDenseI64ArrayAttr({1}));
-      originalCallArgs.push_back(alignedBase);
-
-      Value startIdx = builder.create<LLVM::ExtractValueOp>(
-          func.getLoc(), builder.getI64Type(), tensorStruct,
-          builder.getDenseI64ArrayAttr({2}));
-      originalCallArgs.push_back(startIdx);
-
-      Value sizesAndStrides = builder.create<LLVM::ExtractValueOp>(
-          func.getLoc(), LLVM::LLVMPointerType::get(context), tensorStruct,
-          builder.getDenseI64ArrayAttr({3}));
-      // The sizesAndStrides field is an array itself, so we need to step into
-      // it and extract elements.
-      int64_t rank = mlir::cast<IntegerAttr>(rankAttr).getInt();
-      for (int i = 0; i < 2 * rank; i++) {
-        Value idx = builder.create<LLVM::ConstantOp>(
-            func.getLoc(), builder.getI64Type(), builder.getI64IntegerAttr(i));
-
-        Value elementPtr = builder.create<LLVM::GEPOp>(
-            func.getLoc(), ptrTy, ptrTy, sizesAndStrides, ValueRange{idx});
-
-        Value strideOrSize = builder.create<LLVM::LoadOp>(
-            func.getLoc(), builder.getI64Type(), elementPtr);
-
-        originalCallArgs.push_back(strideOrSize);
-      }
+    // Bare pointer and batched entry points require statically known,
+    // contiguous shapes.
+    if (!staticShapes) {
+      continue;
     }
 
-    // Call the original functions with the unpacked args.
-    builder.create<LLVM::CallOp>(func.getLoc(), TypeRange(), func.getName(),
-                                 originalCallArgs);
+    if (emitBarePtr) {
+      builder.setInsertionPointToEnd(moduleOp.getBody());
+      generateBarePtrWrapper(builder, func, *staticShapes);
+    }
 
-    builder.create<LLVM::ReturnOp>(func.getLoc(), ValueRange());
+    if (emitBatched) {
+      builder.setInsertionPointToEnd(moduleOp.getBody());
+      generateBatchedWrapper(builder, func, *staticShapes);
+    }
   }
 
   builder.setInsertionPointToEnd(moduleOp.getBody());
@@ -147,7 +346,8 @@ class LLVMEmitCallingConventionWrapperFuncs
       LLVMEmitCallingConventionWrapperFuncsBase;
 
   void runOnOperation() final {
-    generateLLVMWrappersForArgRanks(getOperation());
+    generateLLVMWrappersForArgRanks(getOperation(), emitBarePtrWrappers,
+                                    emitBatchedWrappers);
   }
 };
 
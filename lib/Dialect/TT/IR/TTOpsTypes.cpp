@@ -69,6 +69,8 @@ mlir::tt::SystemDescAttr::getDefault(MLIRContext *context) {
       tt::DataTypeAttr::get(context, tt::DataType::UInt16));
   supported_data_types.push_back(
       tt::DataTypeAttr::get(context, tt::DataType::UInt8));
+  supported_data_types.push_back(
+      tt::DataTypeAttr::get(context, tt::DataType::Int32));
 
   // populate a placeholder for supported tile sizes
   SmallVector<tt::TileSizeAttr> supported_tile_sizes;
@@ -262,6 +264,10 @@ mlir::tt::SystemDescAttr::getFromPath(MLIRContext *context, std::string &path) {
         supported_data_types_attr.push_back(
             tt::DataTypeAttr::get(context, tt::DataType::UInt8));
         break;
+      case ::tt::target::DataType::Int32:
+        supported_data_types_attr.push_back(
+            tt::DataTypeAttr::get(context, tt::DataType::Int32));
+        break;
       }
     }
 
@@ -1206,6 +1212,8 @@ uint64_t TileType::getSizeBytes() const {
     return getHeight() * getWidth() * 2;
   case DataType::UInt8:
     return getHeight() * getWidth();
+  case DataType::Int32:
+    return getHeight() * getWidth() * 4;
   }
 }
 
@@ -1238,6 +1246,9 @@ mlir::Type TileType::getElementType() const {
   case DataType::UInt8:
     return IntegerType::get(getContext(), 8,
                             IntegerType::SignednessSemantics::Unsigned);
+  case DataType::Int32:
+    return IntegerType::get(getContext(), 32,
+                            IntegerType::SignednessSemantics::Signed);
   }
 }
 
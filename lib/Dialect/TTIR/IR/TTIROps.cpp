@@ -156,6 +156,11 @@ void mlir::tt::ttir::BitwiseXorOp::getCanonicalizationPatterns(
 mlir::tt::ttir::GetDimensionSizeOp::fold(FoldAdaptor adaptor) {
   RankedTensorType inputTensorType = getOperand().getType();
   uint32_t dimensionIndex = getDimension();
+  // Dynamic dimensions are only known once the function is specialized for a
+  // shape bucket.
+  if (inputTensorType.isDynamicDim(dimensionIndex)) {
+    return nullptr;
+  }
   int32_t dimSize = inputTensorType.getShape()[dimensionIndex];
 
   return mlir::DenseElementsAttr::get<int32_t>(getType(), dimSize);
@@ -563,8 +568,10 @@ mlir::LogicalResult mlir::tt::ttir::ConvTranspose2dOp::verify() {
     return emitOpError("Shape attribute must be non-empty");
   }
 
-  // Cardinality of the input and output tensors must be the same
-  if (inputType.getNumElements() != outputType.getNumElements()) {
+  // Cardinality of the input and output tensors must be the same, which is
+  // only known for static shapes.
+  if (inputType.hasStaticShape() && outputType.hasStaticShape() &&
+      inputType.getNumElements() != outputType.getNumElements()) {
     return emitOpError(
         "Input and output tensors must have the same number of elements");
   }
@@ -601,7 +608,8 @@ mlir::LogicalResult mlir::tt::ttir::ConvTranspose2dOp::verify() {
   }
 
   // If there's a -1, ensure that it can be inferred correctly
-  if (has_negative && inputType.getNumElements() % known_dim_product != 0) {
+  if (has_negative && inputType.hasStaticShape() &&
+      inputType.getNumElements() % known_dim_product != 0) {
     return emitOpError("Invalid shape: the dimensions do not multiply to the "
                        "total number of elements in the tensor");
   }
@@ -658,6 +666,11 @@ mlir::LogicalResult mlir::tt::ttir::ConvTranspose2dOp::verify() {
   // broadcast dimension is equal to the outputShape dimension.
   for (size_t i = 0; i < broadcastDimensions.size(); i++) {
     int64_t dimValue = broadcastDimensions[i];
+    // The broadcast value of a dynamic dimension is set once the function is
+    // specialized for a shape bucket.
+    if (outputType.isDynamicDim(i)) {
+      continue;
+    }
     if (inputShape[i] * dimValue != outputShape[i]) {
       return emitOpError() << "Input tensor shape ("
                            << ttmlir::utils::join(inputShape, ",") << ") index "
@@ -1617,6 +1630,19 @@ mlir::tt::ttir::LinearOp::canonicalize(ttir::LinearOp op,
 }
 // ANCHOR_END: adding_an_op_matmul_ttir_verify
 
+// MatmulOp generic region builder.
+void mlir::tt::ttir::MatmulOp::buildGenericRegion(::mlir::OpBuilder &opBuilder,
+                                                  ::mlir::Block *block) {
+  assert(block->getNumArguments() == 3 &&
+         "Matmul op block expects two input and one output argument.");
+
+  auto kernelOp = opBuilder.create<mlir::tt::ttir::KernelOp>(
+      getLoc(), block->getArgument(2).getType(), "matmul", "tile",
+      ::mlir::ValueRange({block->getArgument(0), block->getArgument(1)}),
+      block->getArgument(2));
+  opBuilder.create<mlir::tt::ttir::YieldOp>(getLoc(), kernelOp->getResults());
+}
+
 //===----------------------------------------------------------------------===//
 // UpsampleOp
 //===----------------------------------------------------------------------===//
@@ -2076,6 +2102,150 @@ bool matchSimpleBlock(mlir::Region &region) {
   return success();
 }
 
+//===----------------------------------------------------------------------===//
+// PagedUpdateCacheOp
+//===----------------------------------------------------------------------===//
+
+::mlir::LogicalResult mlir::tt::ttir::PagedUpdateCacheOp::verify() {
+  const ::mlir::RankedTensorType cacheType = getCache().getType();
+  const ::mlir::RankedTensorType inputType = getInput().getType();
+  const ::mlir::RankedTensorType updateIndexType = getUpdateIndex().getType();
+  const ::mlir::RankedTensorType pageTableType = getPageTable().getType();
+
+  if (cacheType.getElementType() != inputType.getElementType()) {
+    return emitOpError("Cache and input tensors must have the same dtype");
+  }
+
+  if (cacheType.getRank() != 4 || inputType.getRank() != 4) {
+    return emitOpError("Cache and input tensors must be 4D tensors");
+  }
+
+  if (inputType.getDimSize(0) != 1 ||
+      inputType.getDimSize(2) != cacheType.getDimSize(1) ||
+      inputType.getDimSize(3) != cacheType.getDimSize(3)) {
+    return emitOpError() << "Input tensor must be of the shape (1, batch, "
+                         << cacheType.getDimSize(1) << ", "
+                         << cacheType.getDimSize(3)
+                         << ") to match the cache tensor";
+  }
+
+  const int64_t batchSize = inputType.getDimSize(1);
+  if (updateIndexType.getRank() != 1 ||
+      updateIndexType.getDimSize(0) != batchSize) {
+    return emitOpError() << "Update index tensor must be of the shape ("
+                         << batchSize << ")";
+  }
+
+  if (pageTableType.getRank() != 2 ||
+      pageTableType.getDimSize(0) != batchSize) {
+    return emitOpError() << "Page table tensor must have " << batchSize
+                         << " rows, one per sequence";
+  }
+
+  return success();
+}
+
+//===----------------------------------------------------------------------===//
+// ScaledDotProductAttentionOp
+//===----------------------------------------------------------------------===//
+
+::mlir::LogicalResult mlir::tt::ttir::ScaledDotProductAttentionOp::verify() {
+  const ::mlir::RankedTensorType queryType = getQuery().getType();
+  const ::mlir::RankedTensorType keyType = getKey().getType();
+  const ::mlir::RankedTensorType valueType = getValue().getType();
+
+  if (queryType.getRank() != 4 || keyType.getRank() != 4 ||
+      valueType.getRank() != 4) {
+    return emitOpError("Query, key and value tensors must be 4D tensors");
+  }
+
+  if (keyType.getShape() != valueType.getShape()) {
+    return emitOpError("Key and value tensors must have the same shape");
+  }
+
+  llvm::ArrayRef<int64_t> queryShape = queryType.getShape();
+  llvm::ArrayRef<int64_t> keyShape = keyType.getShape();
+  if (queryShape[0] != keyShape[0] || queryShape[3] != keyShape[3]) {
+    return emitOpError("Query and key tensors must have the same batch size "
+                       "and head size");
+  }
+
+  if (queryShape[1] % keyShape[1] != 0) {
+    return emitOpError("Number of query heads must be a multiple of the "
+                       "number of key and value heads");
+  }
+
+  if (getAttentionMask()) {
+    if (getIsCausal()) {
+      return emitOpError("Attention mask must be absent for causal attention");
+    }
+    llvm::ArrayRef<int64_t> maskShape =
+        getAttentionMask().getType().getShape();
+    if (maskShape.size() != 4 ||
+        (maskShape[0] != 1 && maskShape[0] != queryShape[0]) ||
+        (maskShape[1] != 1 && maskShape[1] != queryShape[1]) ||
+        maskShape[2] != queryShape[2] || maskShape[3] != keyShape[2]) {
+      return emitOpError() << "Attention mask must be of the shape (batch or "
+                              "1, num_heads or 1, "
+                           << queryShape[2] << ", " << keyShape[2] << ")";
+    }
+  }
+
+  if (getResult().getType().getShape() != queryShape) {
+    return emitOpError("Output tensor must have the shape of the query");
+  }
+
+  return success();
+}
+
+//===----------------------------------------------------------------------===//
+// PagedScaledDotProductAttentionDecodeOp
+//===----------------------------------------------------------------------===//
+
+::mlir::LogicalResult
+mlir::tt::ttir::PagedScaledDotProductAttentionDecodeOp::verify() {
+  const ::mlir::RankedTensorType queryType = getQuery().getType();
+  const ::mlir::RankedTensorType keyCacheType = getKeyCache().getType();
+  const ::mlir::RankedTensorType valueCacheType = getValueCache().getType();
+  const ::mlir::RankedTensorType pageTableType = getPageTable().getType();
+  const ::mlir::RankedTensorType curPosType = getCurPos().getType();
+
+  if (queryType.getRank() != 4 || queryType.getDimSize(0) != 1) {
+    return emitOpError("Query tensor must be of the shape (1, batch, "
+                       "num_heads, head_dim)");
+  }
+
+  if (keyCacheType.getRank() != 4 ||
+      keyCacheType.getShape() != valueCacheType.getShape()) {
+    return emitOpError("Key and value caches must be 4D tensors of the same "
+                       "shape");
+  }
+
+  if (queryType.getDimSize(3) != keyCacheType.getDimSize(3) ||
+      queryType.getDimSize(2) % keyCacheType.getDimSize(1) != 0) {
+    return emitOpError("Query tensor must have the head size of the caches "
+                       "and a multiple of their number of heads");
+  }
+
+  const int64_t batchSize = queryType.getDimSize(1);
+  if (pageTableType.getRank() != 2 ||
+      pageTableType.getDimSize(0) != batchSize) {
+    return emitOpError() << "Page table tensor must have " << batchSize
+                         << " rows, one per sequence";
+  }
+
+  if (curPosType.getRank() != 1 || curPosType.getDimSize(0) != batchSize) {
+    return emitOpError() << "Current position tensor must be of the shape ("
+                         << batchSize << ")";
+  }
+
+  if (getResult().getType().getShape() != queryType.getShape()) {
+    return emitOpError("Output tensor must have the shape of the query");
+  }
+
+  return success();
+}
+
 //===----------------------------------------------------------------------===//
 // ReverseOp
 //===----------------------------------------------------------------------===//
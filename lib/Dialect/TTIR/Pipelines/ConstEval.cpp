@@ -0,0 +1,351 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Conversion/TTIRToLinalg/TTIRToLinalg.h"
+#include "ttmlir/Dialect/TTIR/IR/TTIROps.h"
+#include "ttmlir/Dialect/TTIR/Pipelines/Passes.h"
+#include "ttmlir/Dialect/TTIR/Pipelines/TTIRPipelines.h"
+
+#include "mlir/Dialect/Affine/IR/AffineOps.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Bufferization/IR/Bufferization.h"
+#include "mlir/Dialect/ControlFlow/IR/ControlFlow.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/LLVMIR/LLVMDialect.h"
+#include "mlir/Dialect/Linalg/IR/Linalg.h"
+#include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/Dialect/UB/IR/UBOps.h"
+#include "mlir/ExecutionEngine/ExecutionEngine.h"
+#include "mlir/ExecutionEngine/OptUtils.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/IR/IRMapping.h"
+#include "mlir/Interfaces/DestinationStyleOpInterface.h"
+#include "mlir/Pass/PassManager.h"
+#include "mlir/Target/LLVMIR/Dialect/Builtin/BuiltinToLLVMIRTranslation.h"
+#include "mlir/Target/LLVMIR/Dialect/LLVMIR/LLVMToLLVMIRTranslation.h"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/TargetSelect.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace mlir::tt::ttir {
+#define GEN_PASS_DEF_TTIRCONSTEVALHOST
+#include "ttmlir/Dialect/TTIR/Pipelines/Passes.h.inc"
+
+//===----------------------------------------------------------------------===//
+// Host constant evaluation pass
+//===----------------------------------------------------------------------===//
+
+namespace {
+// Ops which have a TTIR to Linalg lowering, and hence can be evaluated on host
+// through the Linalg -> LLVM path.
+bool isHostEvaluable(Operation *op) {
+  return isa<AddOp, SubtractOp, MultiplyOp, DivOp, ReshapeOp, TransposeOp,
+             PermuteOp>(op);
+}
+
+// Element types which can be read back from the JIT'd function into a
+// DenseElementsAttr byte for byte.
+bool isSupportedResultType(Type type) {
+  auto tensorType = dyn_cast<RankedTensorType>(type);
+  if (!tensorType || !tensorType.hasStaticShape() ||
+      !tensorType.getElementType().isIntOrFloat()) {
+    return false;
+  }
+  return tensorType.getElementType().getIntOrFloatBitWidth() % 8 == 0;
+}
+
+// Constant-only subgraph within a single function.
+struct ConstSubgraph {
+  // Evaluable ops, in program order.
+  llvm::SetVector<Operation *> ops;
+  // Results of `ops` which are consumed outside of the subgraph, and hence have
+  // to be materialized as constants.
+  SmallVector<Value> roots;
+};
+
+ConstSubgraph collectConstSubgraph(func::FuncOp funcOp) {
+  ConstSubgraph subgraph;
+
+  auto isConstInput = [&](Value value) {
+    Operation *producer = value.getDefiningOp();
+    return producer &&
+           (isa<ConstantOp>(producer) || subgraph.ops.contains(producer));
+  };
+
+  funcOp.walk([&](Operation *op) {
+    if (!isHostEvaluable(op) ||
+        !llvm::all_of(op->getResultTypes(), isSupportedResultType)) {
+      return;
+    }
+
+    auto dpsOp = dyn_cast<DestinationStyleOpInterface>(op);
+    if (!dpsOp) {
+      return;
+    }
+    bool inputsAreConst = llvm::all_of(
+        dpsOp.getDpsInputOperands(),
+        [&](OpOperand *operand) { return isConstInput(operand->get()); });
+    bool initsAreEmpty = llvm::all_of(dpsOp.getDpsInits(), [](Value init) {
+      return init.getDefiningOp<tensor::EmptyOp>() != nullptr;
+    });
+    if (inputsAreConst && initsAreEmpty) {
+      subgraph.ops.insert(op);
+    }
+  });
+
+  for (Operation *op : subgraph.ops) {
+    for (Value result : op->getResults()) {
+      if (llvm::any_of(result.getUsers(), [&](Operation *user) {
+            return !subgraph.ops.contains(user);
+          })) {
+        subgraph.roots.push_back(result);
+      }
+    }
+  }
+
+  return subgraph;
+}
+
+// Collect all ops needed to compute `value`, in topological order.
+void collectSlice(Value value, llvm::SetVector<Operation *> &slice) {
+  Operation *op = value.getDefiningOp();
+  if (!op || slice.contains(op)) {
+    return;
+  }
+  for (Value operand : op->getOperands()) {
+    collectSlice(operand, slice);
+  }
+  slice.insert(op);
+}
+
+std::string getEvalFuncName(size_t rootIdx) {
+  return "const_eval_" + std::to_string(rootIdx);
+}
+
+// Build a standalone module with one function per root; each function
+// recomputes its root from the subgraph's constants.
+OwningOpRef<ModuleOp> buildEvalModule(MLIRContext *context,
+                                      ArrayRef<Value> roots) {
+  OpBuilder builder(context);
+  OwningOpRef<ModuleOp> module = ModuleOp::create(builder.getUnknownLoc());
+
+  for (auto [rootIdx, root] : llvm::enumerate(roots)) {
+    builder.setInsertionPointToEnd(module->getBody());
+    auto funcType = builder.getFunctionType({}, {root.getType()});
+    auto funcOp = builder.create<func::FuncOp>(
+        root.getLoc(), getEvalFuncName(rootIdx), funcType);
+    funcOp->setAttr(LLVM::LLVMDialect::getEmitCWrapperAttrName(),
+                    builder.getUnitAttr());
+
+    Block *block = funcOp.addEntryBlock();
+    builder.setInsertionPointToStart(block);
+
+    llvm::SetVector<Operation *> slice;
+    collectSlice(root, slice);
+
+    IRMapping mapping;
+    for (Operation *op : slice) {
+      // TTIR constants are materialized as arith constants, which bufferize to
+      // globals.
+      if (auto constantOp = dyn_cast<ConstantOp>(op)) {
+        auto arithConstant = builder.create<arith::ConstantOp>(
+            op->getLoc(), cast<TypedAttr>(constantOp.getValue()));
+        mapping.map(constantOp.getResult(), arithConstant.getResult());
+        continue;
+      }
+      builder.clone(*op, mapping);
+    }
+
+    // Return a copy of the root in a fresh buffer. Otherwise the result could
+    // alias a constant global of the JIT'd module (e.g. a reshape of a
+    // constant), and couldn't be freed once it's been read back.
+    auto rootType = cast<RankedTensorType>(root.getType());
+    Value init = builder.create<tensor::EmptyOp>(
+        root.getLoc(), rootType.getShape(), rootType.getElementType());
+    auto copyOp = builder.create<linalg::CopyOp>(root.getLoc(),
+                                                 mapping.lookup(root), init);
+    builder.create<func::ReturnOp>(root.getLoc(), copyOp.getResult(0));
+  }
+
+  return module;
+}
+
+// Copy the (possibly strided) contents of a returned memref descriptor into a
+// DenseElementsAttr.  The descriptor is laid out as
+// {allocated, aligned, offset, sizes[rank], strides[rank]}.
+DenseElementsAttr readResult(RankedTensorType type,
+                             ArrayRef<int64_t> descriptor) {
+  const int64_t rank = type.getRank();
+  const auto *aligned = reinterpret_cast<const char *>(descriptor[1]);
+  const int64_t offset = descriptor[2];
+  ArrayRef<int64_t> sizes = descriptor.slice(3, rank);
+  ArrayRef<int64_t> strides = descriptor.slice(3 + rank, rank);
+
+  const size_t elementBytes = type.getElementType().getIntOrFloatBitWidth() / 8;
+  const int64_t numElements = type.getNumElements();
+  std::vector<char> data(numElements * elementBytes);
+
+  SmallVector<int64_t> index(rank, 0);
+  for (int64_t linearIdx = 0; linearIdx < numElements; ++linearIdx) {
+    int64_t sourceIdx = offset;
+    for (int64_t dim = 0; dim < rank; ++dim) {
+      sourceIdx += index[dim] * strides[dim];
+    }
+    std::memcpy(data.data() + linearIdx * elementBytes,
+                aligned + sourceIdx * elementBytes, elementBytes);
+
+    for (int64_t dim = rank - 1; dim >= 0; --dim) {
+      if (++index[dim] < sizes[dim]) {
+        break;
+      }
+      index[dim] = 0;
+    }
+  }
+
+  return DenseElementsAttr::getFromRawBuffer(type, data);
+}
+
+class TTIRConstEvalHost
+    : public impl::TTIRConstEvalHostBase<TTIRConstEvalHost> {
+public:
+  using impl::TTIRConstEvalHostBase<TTIRConstEvalHost>::TTIRConstEvalHostBase;
+
+  void runOnOperation() final {
+    getOperation()->walk([&](func::FuncOp funcOp) {
+      // Skip function declarations, e.g. hoisted op prototypes.
+      if (funcOp.isDeclaration()) {
+        return WalkResult::advance();
+      }
+      if (failed(constEvalFunc(funcOp))) {
+        signalPassFailure();
+        return WalkResult::interrupt();
+      }
+      return WalkResult::advance();
+    });
+  }
+
+  void getDependentDialects(mlir::DialectRegistry &registry) const override {
+    // The Linalg -> LLVM pipeline is run on a standalone module while this pass
+    // is running, so every dialect it may create has to be loaded upfront.
+    registry.insert<mlir::tt::ttir::TTIRDialect, mlir::affine::AffineDialect,
+                    mlir::arith::ArithDialect,
+                    mlir::bufferization::BufferizationDialect,
+                    mlir::cf::ControlFlowDialect, mlir::func::FuncDialect,
+                    mlir::LLVM::LLVMDialect, mlir::linalg::LinalgDialect,
+                    mlir::memref::MemRefDialect, mlir::scf::SCFDialect,
+                    mlir::tensor::TensorDialect, mlir::ub::UBDialect>();
+    mlir::registerBuiltinDialectTranslation(registry);
+    mlir::registerLLVMDialectTranslation(registry);
+  }
+
+private:
+  LogicalResult constEvalFunc(func::FuncOp funcOp) {
+    ConstSubgraph subgraph = collectConstSubgraph(funcOp);
+    if (subgraph.roots.empty()) {
+      return success();
+    }
+
+    FailureOr<SmallVector<DenseElementsAttr>> results =
+        evaluate(funcOp, subgraph.roots);
+    if (failed(results)) {
+      return failure();
+    }
+
+    // Replace each root with a constant holding its folded value.
+    OpBuilder builder(funcOp.getContext());
+    for (auto [root, value] : llvm::zip(subgraph.roots, *results)) {
+      builder.setInsertionPoint(root.getDefiningOp());
+      auto constantOp =
+          builder.create<ConstantOp>(root.getLoc(), root.getType(), value);
+      root.replaceAllUsesWith(constantOp.getResult());
+    }
+
+    // Erase the now dead subgraph, along with any constants and empty tensors
+    // which only fed into it.
+    llvm::SmallPtrSet<Operation *, 16> maybeDead;
+    for (Operation *op : llvm::reverse(subgraph.ops)) {
+      if (!op->use_empty()) {
+        continue;
+      }
+      for (Value operand : op->getOperands()) {
+        if (Operation *producer = operand.getDefiningOp();
+            producer && isa<ConstantOp, tensor::EmptyOp>(producer)) {
+          maybeDead.insert(producer);
+        }
+      }
+      op->erase();
+    }
+    for (Operation *op : maybeDead) {
+      if (op->use_empty()) {
+        op->erase();
+      }
+    }
+
+    return success();
+  }
+
+  FailureOr<SmallVector<DenseElementsAttr>> evaluate(func::FuncOp funcOp,
+                                                     ArrayRef<Value> roots) {
+    OwningOpRef<ModuleOp> evalModule =
+        buildEvalModule(funcOp.getContext(), roots);
+
+    // Lower through the same path used for hoisted CPU ops.
+    PassManager pm(funcOp.getContext(), ModuleOp::getOperationName());
+    pm.addPass(createConvertTTIRToLinalgPass());
+    LinalgToLLVMPipelineOptions linalgToLLVMOptions;
+    createLinalgToLLVMPipeline(pm, linalgToLLVMOptions);
+    if (failed(pm.run(*evalModule))) {
+      funcOp.emitError("failed to lower constant subgraph to LLVM");
+      return failure();
+    }
+
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+
+    ExecutionEngineOptions engineOptions;
+    engineOptions.transformer = makeOptimizingTransformer(
+        /*optLevel=*/optLevel, /*sizeLevel=*/0, /*targetMachine=*/nullptr);
+    auto maybeEngine = ExecutionEngine::create(*evalModule, engineOptions);
+    if (!maybeEngine) {
+      funcOp.emitError("failed to JIT constant subgraph: ")
+          << llvm::toString(maybeEngine.takeError());
+      return failure();
+    }
+    std::unique_ptr<ExecutionEngine> engine = std::move(*maybeEngine);
+
+    SmallVector<DenseElementsAttr> results;
+    for (auto [rootIdx, root] : llvm::enumerate(roots)) {
+      auto type = cast<RankedTensorType>(root.getType());
+
+      // Returned memrefs are written through a pointer to their descriptor;
+      // pointers and i64s are both 8 bytes on supported hosts.
+      SmallVector<int64_t> descriptor(3 + 2 * type.getRank(), 0);
+      void *descriptorPtr = descriptor.data();
+      SmallVector<void *, 1> args = {&descriptorPtr};
+
+      std::string funcName = "_mlir_ciface_" + getEvalFuncName(rootIdx);
+      if (llvm::Error error = engine->invokePacked(funcName, args)) {
+        funcOp.emitError("failed to evaluate constant subgraph: ")
+            << llvm::toString(std::move(error));
+        return failure();
+      }
+
+      // Each result is returned in a buffer of its own, allocated by the JIT'd
+      // code with malloc.
+      results.push_back(readResult(type, descriptor));
+      std::free(reinterpret_cast<void *>(descriptor[0]));
+    }
+
+    return results;
+  }
+};
+} // namespace
+
+} // namespace mlir::tt::ttir
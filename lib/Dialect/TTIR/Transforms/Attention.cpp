@@ -0,0 +1,311 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TT/IR/TT.h"
+#include "ttmlir/Dialect/TTIR/IR/TTIROps.h"
+#include "ttmlir/Dialect/TTIR/Transforms/Passes.h"
+#include "ttmlir/Utils.h"
+
+#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+#include "llvm/ADT/Sequence.h"
+
+#include <optional>
+
+namespace mlir::tt::ttir {
+#define GEN_PASS_DEF_TTIRFUSEATTENTION
+#include "ttmlir/Dialect/TTIR/Transforms/Passes.h.inc"
+
+namespace {
+
+int64_t normalizeDim(int64_t dim, int64_t rank) {
+  return dim < 0 ? dim + rank : dim;
+}
+
+Value skipBroadcasts(Value value) {
+  while (auto broadcast = value.getDefiningOp<BroadcastOp>()) {
+    value = broadcast.getInput();
+  }
+  return value;
+}
+
+// Returns the reduction of a single dimension that `value` is broadcast from,
+// as long as the reduced dimension stays in place, either kept by the
+// reduction or added back by a reshape.
+template <typename ReductionOpTy>
+ReductionOpTy getBroadcastReduction(Value value) {
+  value = skipBroadcasts(value);
+  auto reshape = value.getDefiningOp<ReshapeOp>();
+  Value reduced = reshape ? reshape.getInput() : value;
+  auto reduction = reduced.getDefiningOp<ReductionOpTy>();
+  if (!reduction || !reduction.getDimArgAttr() ||
+      reduction.getDimArgAttr().size() != 1) {
+    return nullptr;
+  }
+
+  RankedTensorType inputType = reduction.getInput().getType();
+  int64_t dim = normalizeDim(
+      mlir::cast<IntegerAttr>(reduction.getDimArgAttr()[0]).getInt(),
+      inputType.getRank());
+  llvm::SmallVector<int64_t> keptShape(inputType.getShape());
+  keptShape[dim] = 1;
+  if (mlir::cast<RankedTensorType>(value.getType()).getShape() !=
+      llvm::ArrayRef<int64_t>(keptShape)) {
+    return nullptr;
+  }
+  return reduction;
+}
+
+template <typename ReductionOpTy>
+int64_t getReductionDim(ReductionOpTy reduction) {
+  return normalizeDim(
+      mlir::cast<IntegerAttr>(reduction.getDimArgAttr()[0]).getInt(),
+      reduction.getInput().getType().getRank());
+}
+
+// Returns the value of a float constant that `value` is splat or broadcast
+// from.
+std::optional<float> getSplatConstant(Value value) {
+  value = skipBroadcasts(value);
+  if (auto reshape = value.getDefiningOp<ReshapeOp>()) {
+    value = skipBroadcasts(reshape.getInput());
+  }
+  auto constant = value.getDefiningOp<ConstantOp>();
+  if (!constant) {
+    return std::nullopt;
+  }
+  ElementsAttr valueAttr = constant.getValue();
+  if (!valueAttr.isSplat() ||
+      !mlir::isa<FloatType>(valueAttr.getElementType())) {
+    return std::nullopt;
+  }
+  return valueAttr.getSplatValue<APFloat>().convertToFloat();
+}
+
+// Returns the value `value` is a transpose of in its last two dimensions.
+Value getTransposeInput(Value value) {
+  auto type = mlir::cast<RankedTensorType>(value.getType());
+  int64_t rank = type.getRank();
+  if (rank < 2) {
+    return nullptr;
+  }
+  if (auto transpose = value.getDefiningOp<TransposeOp>()) {
+    int64_t dim0 = normalizeDim(transpose.getDim0(), rank);
+    int64_t dim1 = normalizeDim(transpose.getDim1(), rank);
+    if (std::min(dim0, dim1) == rank - 2 && std::max(dim0, dim1) == rank - 1) {
+      return transpose.getInput();
+    }
+    return nullptr;
+  }
+  if (auto permute = value.getDefiningOp<PermuteOp>()) {
+    llvm::SmallVector<int64_t> permutation =
+        llvm::to_vector(llvm::seq<int64_t>(0, rank));
+    std::swap(permutation[rank - 2], permutation[rank - 1]);
+    if (permute.getPermutation() == llvm::ArrayRef<int64_t>(permutation)) {
+      return permute.getInput();
+    }
+  }
+  return nullptr;
+}
+
+// Fuses exp(x - max(x)) / sum(exp(x - max(x))), with the reductions over the
+// same dimension, into softmax(x).
+class SoftmaxFusionPattern : public OpRewritePattern<DivOp> {
+public:
+  using OpRewritePattern<DivOp>::OpRewritePattern;
+
+  LogicalResult matchAndRewrite(DivOp op,
+                                PatternRewriter &rewriter) const override {
+    auto exp = op.getInputs()[0].getDefiningOp<ExpOp>();
+    if (!exp) {
+      return failure();
+    }
+    auto subtract = exp.getInputs()[0].getDefiningOp<SubtractOp>();
+    if (!subtract) {
+      return failure();
+    }
+
+    Value input = subtract.getInputs()[0];
+    auto max = getBroadcastReduction<MaxOp>(subtract.getInputs()[1]);
+    if (!max || max.getInput() != input) {
+      return failure();
+    }
+    auto sum = getBroadcastReduction<SumOp>(op.getInputs()[1]);
+    if (!sum || sum.getInput() != exp->getResult(0) ||
+        getReductionDim(sum) != getReductionDim(max)) {
+      return failure();
+    }
+
+    auto resultType = mlir::cast<RankedTensorType>(op->getResult(0).getType());
+    if (input.getType() != resultType) {
+      return failure();
+    }
+
+    ttmlir::utils::replaceOpWithNewDPSOp<SoftmaxOp>(
+        rewriter, op, resultType, input,
+        rewriter.getSI32IntegerAttr(getReductionDim(max)));
+    return success();
+  }
+};
+
+// Fuses softmax(matmul(Q, transpose(K)) * scale [+ mask]) * V into a scaled
+// dot product attention.
+class AttentionFusionPattern : public OpRewritePattern<MatmulOp> {
+public:
+  using OpRewritePattern<MatmulOp>::OpRewritePattern;
+
+  LogicalResult matchAndRewrite(MatmulOp op,
+                                PatternRewriter &rewriter) const override {
+    auto softmax = op.getA().getDefiningOp<SoftmaxOp>();
+    if (!softmax || !softmax->hasOneUse()) {
+      return failure();
+    }
+    RankedTensorType scoresType = softmax.getResult().getType();
+    if (scoresType.getRank() != 4 ||
+        normalizeDim(softmax.getDimension(), 4) != 3) {
+      return failure();
+    }
+
+    Value scores = softmax.getInput();
+    Value mask;
+    Value query;
+    Value key;
+    float scale = 1.0f;
+    if (!matchScaledScores(scores, query, key, scale)) {
+      auto add = scores.getDefiningOp<AddOp>();
+      if (!add || !add->hasOneUse()) {
+        return failure();
+      }
+      for (unsigned i = 0; i < 2 && !mask; ++i) {
+        if (matchScaledScores(add.getInputs()[i], query, key, scale)) {
+          mask = add.getInputs()[1 - i];
+        }
+      }
+      if (!mask) {
+        return failure();
+      }
+    }
+
+    Value value = op.getB();
+    RankedTensorType resultType = op.getResult().getType();
+    if (!isValidAttention(query, key, value, resultType)) {
+      return failure();
+    }
+    if (mask) {
+      mask = getAttentionMask(mask, scoresType);
+      if (!mask) {
+        return failure();
+      }
+    }
+
+    ttmlir::utils::replaceOpWithNewDPSOp<ScaledDotProductAttentionOp>(
+        rewriter, op, resultType, query, key, value, mask,
+        rewriter.getBoolAttr(false), rewriter.getF32FloatAttr(scale));
+    return success();
+  }
+
+private:
+  // Matches matmul(Q, transpose(K)), optionally multiplied or divided by a
+  // splat constant.
+  static bool matchScaledScores(Value scores, Value &query, Value &key,
+                                float &scale) {
+    float scoresScale = 1.0f;
+    if (auto multiply = scores.getDefiningOp<MultiplyOp>();
+        multiply && multiply->hasOneUse()) {
+      for (unsigned i = 0; i < 2; ++i) {
+        if (auto constant = getSplatConstant(multiply.getInputs()[1 - i])) {
+          scores = multiply.getInputs()[i];
+          scoresScale = *constant;
+          break;
+        }
+      }
+    } else if (auto div = scores.getDefiningOp<DivOp>();
+               div && div->hasOneUse()) {
+      if (auto constant = getSplatConstant(div.getInputs()[1]);
+          constant && *constant != 0.0f) {
+        scores = div.getInputs()[0];
+        scoresScale = 1.0f / *constant;
+      }
+    }
+
+    auto matmul = scores.getDefiningOp<MatmulOp>();
+    if (!matmul || !matmul->hasOneUse()) {
+      return false;
+    }
+    Value transposedKey = getTransposeInput(matmul.getB());
+    if (!transposedKey) {
+      return false;
+    }
+    query = matmul.getA();
+    key = transposedKey;
+    scale = scoresScale;
+    return true;
+  }
+
+  // Checks the shapes ttir.scaled_dot_product_attention takes.
+  static bool isValidAttention(Value query, Value key, Value value,
+                               RankedTensorType resultType) {
+    auto queryType = mlir::cast<RankedTensorType>(query.getType());
+    auto keyType = mlir::cast<RankedTensorType>(key.getType());
+    auto valueType = mlir::cast<RankedTensorType>(value.getType());
+    if (queryType.getRank() != 4 ||
+        keyType.getShape() != valueType.getShape()) {
+      return false;
+    }
+    llvm::ArrayRef<int64_t> queryShape = queryType.getShape();
+    llvm::ArrayRef<int64_t> keyShape = keyType.getShape();
+    return queryShape[0] == keyShape[0] && queryShape[3] == keyShape[3] &&
+           queryShape[1] % keyShape[1] == 0 &&
+           resultType.getShape() == queryShape;
+  }
+
+  // Returns the mask to attend with, preferring the value it is broadcast
+  // from, as the attention op broadcasts it over batch and heads itself.
+  static Value getAttentionMask(Value mask, RankedTensorType scoresType) {
+    auto isValidMask = [&](Value value) {
+      auto type = mlir::cast<RankedTensorType>(value.getType());
+      if (type.getRank() != 4) {
+        return false;
+      }
+      for (int64_t dim = 0; dim < 4; ++dim) {
+        int64_t size = type.getDimSize(dim);
+        if (size != scoresType.getDimSize(dim) && (dim >= 2 || size != 1)) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    Value broadcastInput = skipBroadcasts(mask);
+    if (isValidMask(broadcastInput)) {
+      return broadcastInput;
+    }
+    return isValidMask(mask) ? mask : nullptr;
+  }
+};
+
+} // namespace
+
+class TTIRFuseAttention
+    : public impl::TTIRFuseAttentionBase<TTIRFuseAttention> {
+public:
+  using impl::TTIRFuseAttentionBase<TTIRFuseAttention>::TTIRFuseAttentionBase;
+
+  void runOnOperation() final {
+    RewritePatternSet patterns(&getContext());
+    patterns.add<SoftmaxFusionPattern, AttentionFusionPattern>(&getContext());
+    FrozenRewritePatternSet patternSet(std::move(patterns));
+
+    if (failed(applyPatternsAndFoldGreedily(getOperation(), patternSet))) {
+      signalPassFailure();
+      return;
+    }
+  }
+
+  void getDependentDialects(mlir::DialectRegistry &registry) const override {
+    registry.insert<mlir::tt::ttir::TTIRDialect>();
+    registry.insert<mlir::tt::TTDialect>();
+  }
+};
+
+} // namespace mlir::tt::ttir
@@ -217,6 +217,78 @@ class TTIRGenericOpCBsRewriter : public OpRewritePattern<GenericOp> {
 public:
   using OpRewritePattern<GenericOp>::OpRewritePattern;
 
+  static bool isMatmul(GenericOp generic) {
+    auto kernelOp =
+        mlir::dyn_cast<KernelOp>(generic.getRegion().front().front());
+    if (!kernelOp || kernelOp.getOp() != "matmul") {
+      return false;
+    }
+    return llvm::all_of(generic->getOperandTypes(), [](Type type) {
+      return mlir::cast<RankedTensorType>(type).getRank() == 2;
+    });
+  }
+
+  // Returns the number of K tiles in a matmul block. Operand CBs are double
+  // buffered so that the next K block can be read while the current one is
+  // being multiplied; the four buffers are kept within a quarter of the usable
+  // L1. If the whole K dim fits into the same budget single buffered, K is not
+  // blocked at all.
+  static int64_t getMatmulKBlockTiles(int64_t mTiles, int64_t nTiles,
+                                      int64_t kTiles, int64_t tileSizeBytes,
+                                      int64_t budgetBytes) {
+    if ((mTiles + nTiles) * kTiles * tileSizeBytes <= budgetBytes) {
+      return kTiles;
+    }
+    int64_t kBlockTiles = 1;
+    for (int64_t tiles = 2; tiles < kTiles; ++tiles) {
+      if (kTiles % tiles == 0 &&
+          2 * (mTiles + nTiles) * tiles * tileSizeBytes <= budgetBytes) {
+        kBlockTiles = tiles;
+      }
+    }
+    return kBlockTiles;
+  }
+
+  // Creates the CBs for the matmul inputs. Core (y, x) of the grid needs row
+  // block y of A and column block x of B, but only a few K tiles of them at a
+  // time, so the CB tensors are shaped such that their shard is exactly that:
+  // A's CB is laid out on a <Gy x 1> grid with (numBuffers * kBlockTiles) K
+  // tiles per shard and B's CB on a <1 x Gx> grid with as many K tiles. A K
+  // extent equal to the whole K dim means a single, unblocked buffer.
+  SmallVector<Value> createMatmulCBs(GenericOp generic,
+                                     PatternRewriter &rewriter) const {
+    auto lhsTy = mlir::cast<RankedTensorType>(generic.getInputs()[0].getType());
+    auto rhsTy = mlir::cast<RankedTensorType>(generic.getInputs()[1].getType());
+    auto tileType = rewriter.getType<TileType>(lhsTy.getElementType());
+    ArrayRef<int64_t> gridShape = generic.getGrid().getShape();
+    assert(gridShape.size() == 2 && "Expected a 2D grid");
+
+    int64_t mTiles = lhsTy.getShape()[0] / tileType.getHeight() / gridShape[0];
+    int64_t kTiles = lhsTy.getShape()[1] / tileType.getWidth();
+    int64_t nTiles = rhsTy.getShape()[1] / tileType.getWidth() / gridShape[1];
+    int64_t budgetBytes =
+        generic.getSystemDesc().getChipDescs()[0].getUsableL1Size() / 4;
+    int64_t kBlockTiles = getMatmulKBlockTiles(
+        mTiles, nTiles, kTiles, tileType.getSizeBytes(), budgetBytes);
+    int64_t kExtent = kBlockTiles == kTiles ? kTiles : 2 * kBlockTiles;
+
+    auto createCB = [&](RankedTensorType ty, ArrayRef<int64_t> shape,
+                        ArrayRef<int64_t> grid) -> Value {
+      auto cbTy = RankedTensorType::get(shape, ty.getElementType());
+      auto layout = rewriter.getAttr<MetalLayoutAttr>(
+          cbTy, MemorySpace::DeviceL1, rewriter.getAttr<GridAttr>(grid),
+          tileType);
+      return rewriter.create<tensor::EmptyOp>(generic->getLoc(), shape,
+                                              ty.getElementType(), layout);
+    };
+    return {createCB(lhsTy,
+                     {lhsTy.getShape()[0], kExtent * tileType.getWidth()},
+                     {gridShape[0], 1}),
+            createCB(rhsTy,
+                     {kExtent * tileType.getHeight(), rhsTy.getShape()[1]},
+                     {1, gridShape[1]})};
+  }
+
   LogicalResult matchAndRewrite(GenericOp generic,
                                 PatternRewriter &rewriter) const final {
     if (!generic.getOperandCbMapping().empty()) {
@@ -229,7 +301,15 @@ public:
     SmallVector<Value> cbValues;
     SmallVector<int64_t> operandCBMapping;
 
-    for (auto operand : generic->getOperands()) {
+    // Matmul inputs are always streamed, even if they are already on the op
+    // grid, since every core reads a whole row (column) of A (B).
+    if (isMatmul(generic)) {
+      cbValues = createMatmulCBs(generic, rewriter);
+      operandCBMapping = {0, 1};
+    }
+
+    for (auto operand :
+         generic->getOperands().drop_front(operandCBMapping.size())) {
       auto ty = mlir::cast<RankedTensorType>(operand.getType());
 
       // Enforcing tiled layout as in kernel we always want to work with tiles.
@@ -42,6 +42,26 @@ getOperandTensorRanks(mlir::Operation *op) {
   return ranks;
 }
 
+// Helper function to get static shapes of an op's operands.  These let the
+// calling convention wrappers fold sizes and strides into constants, and emit
+// bare-pointer entry points.  Returns an empty ArrayAttr if any operand shape
+// is dynamic.
+static mlir::ArrayAttr getOperandTensorShapes(mlir::Operation *op,
+                                              mlir::OpBuilder &builder) {
+  llvm::SmallVector<mlir::Attribute, 4> shapes;
+
+  for (auto operand : op->getOperands()) {
+    if (auto tensorType = dyn_cast<mlir::RankedTensorType>(operand.getType())) {
+      if (!tensorType.hasStaticShape()) {
+        return builder.getArrayAttr({});
+      }
+      shapes.push_back(builder.getDenseI64ArrayAttr(tensorType.getShape()));
+    }
+  }
+
+  return builder.getArrayAttr(shapes);
+}
+
 // Generate unique name base on operation type + argument tensors dims & types.
 static llvm::SmallString<16> generateHoistedFuncName(mlir::Operation *op) {
   // Start building the unique function name
@@ -145,6 +165,10 @@ static void hoistOperationToFunction(mlir::Operation *opToHoist,
     sourceModule.push_back(localFunc);
 
     hoistedFunc->setAttr("arg_ranks", builder.getI64ArrayAttr(ranks));
+    mlir::ArrayAttr shapes = getOperandTensorShapes(opToHoist, builder);
+    if (!shapes.empty()) {
+      hoistedFunc->setAttr("arg_shapes", shapes);
+    }
   }
 
   // Replace the original operation with a call to the hoisted function.
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "ttmlir/Dialect/TT/IR/TT.h"
+#include "ttmlir/Dialect/TT/Utils/GridSelection.h"
 #include "ttmlir/Dialect/TTIR/IR/TTIROps.h"
 #include "ttmlir/Dialect/TTIR/Transforms/Passes.h"
 #include "ttmlir/Utils.h"
@@ -37,23 +38,25 @@ inline Location appendInputSuffix(Location loc, int64_t operandIndex) {
 class TTIRLayoutTensorTypeConverter : public TypeConverter {
 public:
   TTIRLayoutTensorTypeConverter(MLIRContext *ctx, MemorySpace initMemorySpace,
-                                GridAttr deviceGrid) {
+                                bool selectGrid, GridAttr deviceGrid) {
     addConversion([](Type type) { return type; });
-    addConversion(
-        [ctx, initMemorySpace, deviceGrid](RankedTensorType type) -> Type {
-          auto layout = type.getEncoding();
-          if (layout) {
-            return type;
-          }
-          std::int64_t deviceGridRank = deviceGrid.getShape().size();
-          // Default to single core grid
-          auto tensorGrid = GridAttr::get(ctx, deviceGridRank);
-          // Default to initMemorySpace, the optimizer might decide otherwise
-          auto newLayout =
-              MetalLayoutAttr::get(ctx, type, initMemorySpace, tensorGrid);
-          return RankedTensorType::get(type.getShape(), type.getElementType(),
-                                       newLayout);
-        });
+    addConversion([ctx, initMemorySpace, selectGrid,
+                   deviceGrid](RankedTensorType type) -> Type {
+      auto layout = type.getEncoding();
+      if (layout) {
+        return type;
+      }
+      std::int64_t deviceGridRank = deviceGrid.getShape().size();
+      // Spread over the worker grid, or default to single core grid
+      auto tensorGrid = selectGrid
+                            ? utils::selectTensorGrid(ctx, type, deviceGrid)
+                            : GridAttr::get(ctx, deviceGridRank);
+      // Default to initMemorySpace, the optimizer might decide otherwise
+      auto newLayout =
+          MetalLayoutAttr::get(ctx, type, initMemorySpace, tensorGrid);
+      return RankedTensorType::get(type.getShape(), type.getElementType(),
+                                   newLayout);
+    });
   }
 };
 
@@ -278,7 +281,7 @@ public:
       auto device = getCurrentScopeDevice(getOperation());
       assert(device && "Device not found");
       TTIRLayoutTensorTypeConverter typeConverter(
-          &getContext(), initMemorySpace, device.getWorkerGrid());
+          &getContext(), initMemorySpace, selectGrid, device.getWorkerGrid());
       RewritePatternSet patterns(&getContext());
       patterns.add<TTIRLayoutTensorTypeRewriter>(typeConverter, &getContext());
       FrozenRewritePatternSet patternSet(std::move(patterns));
@@ -0,0 +1,294 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TT/IR/TT.h"
+#include "ttmlir/Dialect/TT/IR/TTOpsTypes.h"
+#include "ttmlir/Dialect/TTIR/IR/TTIROps.h"
+#include "ttmlir/Dialect/TTIR/Transforms/Passes.h"
+
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/IR/BuiltinAttributes.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/IR/SymbolTable.h"
+#include "mlir/IR/Verifier.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/Sequence.h"
+#include "llvm/ADT/SmallVector.h"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+
+namespace mlir::tt::ttir {
+#define GEN_PASS_DEF_TTIRSHAPEBUCKETS
+#include "ttmlir/Dialect/TTIR/Transforms/Passes.h.inc"
+
+//===----------------------------------------------------------------------===//
+// Shape buckets pass
+//===----------------------------------------------------------------------===//
+
+namespace {
+
+// Function argument attribute holding the value an input is padded with.
+constexpr llvm::StringLiteral kBucketPadValueAttrName =
+    "ttir.bucket_pad_value";
+
+bool hasDynamicDims(Type type) {
+  auto tensorType = mlir::dyn_cast<RankedTensorType>(type);
+  return tensorType && !tensorType.hasStaticShape();
+}
+
+Type specializeType(Type type, int64_t size) {
+  if (!hasDynamicDims(type)) {
+    return type;
+  }
+  auto tensorType = mlir::cast<RankedTensorType>(type);
+  llvm::SmallVector<int64_t> shape(tensorType.getShape());
+  for (int64_t &dim : shape) {
+    if (ShapedType::isDynamic(dim)) {
+      dim = size;
+    }
+  }
+  return tensorType.clone(shape);
+}
+
+// Returns true if dimension `dim` of `value`, possibly negative, is dynamic,
+// i.e. padded up to the bucket size.
+bool isBucketedDim(Value value, int64_t dim) {
+  auto tensorType = mlir::cast<RankedTensorType>(value.getType());
+  if (dim < 0) {
+    dim += tensorType.getRank();
+  }
+  return dim >= 0 && dim < tensorType.getRank() && tensorType.isDynamicDim(dim);
+}
+
+// Returns the first bucketed dimension reduced by `op`, if it is a reduction.
+std::optional<int64_t> getReducedBucketedDim(Operation *op) {
+  if (!mlir::isa<SumOp, MeanOp, MaxOp, MinOp, ProdOp, ReduceAndOp>(op)) {
+    return std::nullopt;
+  }
+  Value input = op->getOperand(0);
+  int64_t rank = mlir::cast<RankedTensorType>(input.getType()).getRank();
+  llvm::SmallVector<int64_t> reducedDims;
+  if (auto dimArg = op->getAttrOfType<ArrayAttr>("dim_arg")) {
+    for (auto dim : dimArg.getAsValueRange<IntegerAttr>()) {
+      reducedDims.push_back(dim.getSExtValue());
+    }
+  } else {
+    // All dimensions are reduced.
+    reducedDims = llvm::to_vector(llvm::seq<int64_t>(0, rank));
+  }
+  for (int64_t dim : reducedDims) {
+    if (isBucketedDim(input, dim)) {
+      return dim < 0 ? dim + rank : dim;
+    }
+  }
+  return std::nullopt;
+}
+
+// Returns true if `op` contracts over a bucketed dimension.
+bool contractsBucketedDim(Operation *op) {
+  if (!mlir::isa<MatmulOp, LinearOp>(op)) {
+    return false;
+  }
+  Value b = op->getOperand(1);
+  int64_t bContractDim =
+      mlir::cast<RankedTensorType>(b.getType()).getRank() == 1 ? 0 : -2;
+  return isBucketedDim(op->getOperand(0), -1) ||
+         isBucketedDim(b, bContractDim);
+}
+
+// Padding is only harmless for ops that are independent per position. Ops
+// that combine the positions of a bucketed dimension see the padding too:
+// reductions are rejected, as their results are wrong whatever the padding.
+// Softmax and matmul contractions are fine if the padded positions are masked
+// out, which can't be checked here, so they are only warned about.
+LogicalResult checkBucketedDims(func::FuncOp func) {
+  WalkResult result = func.walk([](Operation *op) {
+    if (std::optional<int64_t> dim = getReducedBucketedDim(op)) {
+      op->emitOpError() << "reduces over dimension " << *dim
+                        << ", which is padded for shape buckets";
+      return WalkResult::interrupt();
+    }
+    if (auto softmax = mlir::dyn_cast<SoftmaxOp>(op);
+        softmax && isBucketedDim(softmax.getInput(), softmax.getDimension())) {
+      op->emitWarning() << "normalizes over dimension "
+                        << softmax.getDimension()
+                        << ", which is padded for shape buckets; the padded "
+                           "positions must be masked out, e.g. by an "
+                           "additive mask padded with a large negative "
+                           "ttir.bucket_pad_value";
+    } else if (contractsBucketedDim(op)) {
+      op->emitWarning() << "contracts over a dimension which is padded for "
+                           "shape buckets; the padded positions must be zero "
+                           "in one of the operands";
+    }
+    return WalkResult::advance();
+  });
+  return failure(result.wasInterrupted());
+}
+
+// Returns, per type, the dimensions that are dynamic.
+ArrayAttr getDynamicDims(Builder &builder, TypeRange types) {
+  llvm::SmallVector<Attribute> dims;
+  for (Type type : types) {
+    llvm::SmallVector<int64_t> typeDims;
+    if (auto tensorType = mlir::dyn_cast<RankedTensorType>(type)) {
+      for (int64_t dim = 0; dim < tensorType.getRank(); ++dim) {
+        if (tensorType.isDynamicDim(dim)) {
+          typeDims.push_back(dim);
+        }
+      }
+    }
+    dims.push_back(builder.getDenseI64ArrayAttr(typeDims));
+  }
+  return builder.getArrayAttr(dims);
+}
+
+// Rewrites the shapes `op` carries in attributes, or as the sizes of an empty
+// tensor, to match its specialized result type.
+void specializeOp(IRRewriter &rewriter, Operation *op) {
+  if (auto empty = mlir::dyn_cast<tensor::EmptyOp>(op);
+      empty && !empty.getDynamicSizes().empty()) {
+    RankedTensorType type = empty.getType();
+    rewriter.setInsertionPoint(empty);
+    rewriter.replaceOpWithNewOp<tensor::EmptyOp>(
+        empty, type.getShape(), type.getElementType(), type.getEncoding());
+    return;
+  }
+  if (auto reshape = mlir::dyn_cast<ReshapeOp>(op)) {
+    llvm::SmallVector<int32_t> shape(reshape.getResult().getType().getShape());
+    reshape.setShapeAttr(rewriter.getI32ArrayAttr(shape));
+    return;
+  }
+  if (auto broadcast = mlir::dyn_cast<BroadcastOp>(op)) {
+    llvm::ArrayRef<int64_t> inputShape =
+        broadcast.getInput().getType().getShape();
+    llvm::ArrayRef<int64_t> outputShape =
+        broadcast.getResult().getType().getShape();
+    llvm::SmallVector<int64_t> dimensions;
+    for (auto [inputDim, outputDim] : llvm::zip(inputShape, outputShape)) {
+      dimensions.push_back(inputDim == outputDim ? 1 : outputDim / inputDim);
+    }
+    broadcast.setBroadcastDimensions(dimensions);
+  }
+}
+
+// Specializes `func` in place for dynamic dimensions of the size `size`.
+LogicalResult specializeFunc(func::FuncOp func, int64_t size) {
+  IRRewriter rewriter(func.getContext());
+  func.walk([&](Block *block) {
+    for (BlockArgument arg : block->getArguments()) {
+      arg.setType(specializeType(arg.getType(), size));
+    }
+  });
+  func.walk([&](Operation *op) {
+    for (OpResult result : op->getResults()) {
+      result.setType(specializeType(result.getType(), size));
+    }
+    specializeOp(rewriter, op);
+  });
+
+  func.setType(rewriter.getFunctionType(
+      func.getArgumentTypes(),
+      llvm::map_to_vector(func.getResultTypes(), [size](Type type) {
+        return specializeType(type, size);
+      })));
+
+  if (failed(mlir::verify(func))) {
+    return func.emitOpError()
+           << "could not be specialized for shape bucket " << size;
+  }
+  return success();
+}
+
+} // namespace
+
+class TTIRShapeBuckets : public impl::TTIRShapeBucketsBase<TTIRShapeBuckets> {
+public:
+  using impl::TTIRShapeBucketsBase<TTIRShapeBuckets>::TTIRShapeBucketsBase;
+
+  void runOnOperation() final {
+    ModuleOp module = getOperation();
+    llvm::SmallVector<int64_t> sizes(bucketSizes.begin(), bucketSizes.end());
+    llvm::sort(sizes);
+    sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+    if (sizes.empty() || sizes.front() <= 0) {
+      module.emitError() << "shape buckets need at least one positive size";
+      signalPassFailure();
+      return;
+    }
+
+    llvm::SmallVector<func::FuncOp> funcs;
+    for (func::FuncOp func : module.getOps<func::FuncOp>()) {
+      if (llvm::any_of(func.getArgumentTypes(), hasDynamicDims) ||
+          llvm::any_of(func.getResultTypes(), hasDynamicDims)) {
+        funcs.push_back(func);
+      }
+    }
+
+    SymbolTable symbolTable(module);
+    for (func::FuncOp func : funcs) {
+      if (func.isPrivate() || func.isDeclaration()) {
+        func.emitOpError() << "with dynamic dimensions must be public and "
+                              "defined to be specialized for shape buckets";
+        signalPassFailure();
+        return;
+      }
+      if (failed(checkBucketedDims(func)) ||
+          failed(createBuckets(symbolTable, func, sizes))) {
+        signalPassFailure();
+        return;
+      }
+      symbolTable.erase(func);
+    }
+  }
+
+private:
+  LogicalResult createBuckets(SymbolTable &symbolTable, func::FuncOp func,
+                              llvm::ArrayRef<int64_t> sizes) {
+    Builder builder(func.getContext());
+    ArrayAttr inputDims = getDynamicDims(builder, func.getArgumentTypes());
+    ArrayAttr outputDims = getDynamicDims(builder, func.getResultTypes());
+    llvm::SmallVector<float> padValues;
+    for (unsigned i = 0; i < func.getNumArguments(); ++i) {
+      auto padValue =
+          func.getArgAttrOfType<FloatAttr>(i, kBucketPadValueAttrName);
+      padValues.push_back(padValue ? padValue.getValue().convertToFloat()
+                                   : 0.0f);
+    }
+
+    Operation *insertionPoint = func;
+    for (int64_t size : sizes) {
+      std::string name =
+          (func.getSymName() + "_bucket_" + llvm::Twine(size)).str();
+      if (symbolTable.lookup(name)) {
+        return func.emitOpError()
+               << "shape bucket name '" << name << "' is already taken";
+      }
+
+      func::FuncOp bucket = func.clone();
+      bucket.setSymName(name);
+      for (unsigned i = 0; i < bucket.getNumArguments(); ++i) {
+        bucket.removeArgAttr(i, kBucketPadValueAttrName);
+      }
+      bucket->setAttr(ShapeBucketAttr::name,
+                      ShapeBucketAttr::get(
+                          func.getContext(), func.getSymNameAttr(), size,
+                          inputDims, outputDims,
+                          builder.getDenseF32ArrayAttr(padValues)));
+      symbolTable.insert(bucket, std::next(insertionPoint->getIterator()));
+      insertionPoint = bucket;
+
+      if (failed(specializeFunc(bucket, size))) {
+        return failure();
+      }
+    }
+    return success();
+  }
+};
+
+} // namespace mlir::tt::ttir
@@ -0,0 +1,761 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TT/IR/TT.h"
+#include "ttmlir/Dialect/TTIR/Transforms/Passes.h"
+
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/IR/BuiltinAttributes.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/TypeSwitch.h"
+
+#include <functional>
+#include <optional>
+
+namespace mlir::tt::ttir {
+#define GEN_PASS_DEF_TTIRAUTOMATICSHARDING
+#include "ttmlir/Dialect/TTIR/Transforms/Passes.h.inc"
+
+//===----------------------------------------------------------------------===//
+// Automatic sharding pass
+//===----------------------------------------------------------------------===//
+
+namespace {
+
+// Function argument attribute seeding the sharding of an argument.
+constexpr llvm::StringLiteral kShardDimsAttrName = "ttir.shard_dims";
+
+// Tensor dimension sharded along each mesh axis, or kReplicated if the tensor
+// is replicated along that axis.
+using Sharding = llvm::SmallVector<int64_t, 2>;
+constexpr int64_t kReplicated = -1;
+
+// How an op runs on the mesh: the shardings its inputs are resharded to, the
+// sharding of its local result and the mesh axes along which the local
+// results are partial and have to be all_reduced with `reduceType`.
+struct ShardingPlan {
+  llvm::SmallVector<Sharding> operandShardings;
+  Sharding resultSharding;
+  llvm::SmallVector<int64_t> partialAxes;
+  ReduceType reduceType = ReduceType::Sum;
+};
+
+int64_t getNumElements(llvm::ArrayRef<int64_t> shape) {
+  int64_t numElements = 1;
+  for (int64_t dim : shape) {
+    numElements *= dim;
+  }
+  return numElements;
+}
+
+// Returns the dimension of `outputShape` that holds exactly the elements of
+// dimension `dim` of `inputShape` after a reshape, if there is one.
+std::optional<int64_t> getReshapedDim(llvm::ArrayRef<int64_t> inputShape,
+                                      llvm::ArrayRef<int64_t> outputShape,
+                                      int64_t dim) {
+  int64_t inputPrefix = getNumElements(inputShape.take_front(dim));
+  int64_t outputPrefix = 1;
+  for (size_t i = 0; i < outputShape.size(); ++i) {
+    if (outputPrefix == inputPrefix && outputShape[i] == inputShape[dim]) {
+      return i;
+    }
+    outputPrefix *= outputShape[i];
+  }
+  return std::nullopt;
+}
+
+// Partitions the body of a function over a 2D mesh.
+class FuncPartitioner {
+public:
+  FuncPartitioner(func::FuncOp func, llvm::ArrayRef<int64_t> meshShape)
+      : func(func), meshShape(meshShape), builder(func.getContext()) {}
+
+  LogicalResult run() {
+    if (failed(seedArguments())) {
+      return failure();
+    }
+
+    Block &body = func.getBody().front();
+    llvm::SmallVector<Operation *> ops = llvm::to_vector(
+        llvm::make_pointer_range(body.without_terminator()));
+    for (Operation *op : ops) {
+      partition(op);
+    }
+    partitionReturn(mlir::cast<func::ReturnOp>(body.getTerminator()));
+
+    for (Value init : replacedInits) {
+      if (init.use_empty() && init.getDefiningOp<tensor::EmptyOp>()) {
+        init.getDefiningOp()->erase();
+      }
+    }
+    return success();
+  }
+
+private:
+  Sharding getReplicated() const {
+    return Sharding(meshShape.size(), kReplicated);
+  }
+
+  static bool isReplicated(const Sharding &sharding) {
+    return llvm::all_of(sharding,
+                        [](int64_t dim) { return dim == kReplicated; });
+  }
+
+  Sharding getSharding(Value value) const {
+    auto it = shardings.find(value);
+    return it == shardings.end() ? getReplicated() : it->second;
+  }
+
+  bool isOpenArgument(Value value) const { return openArgs.contains(value); }
+
+  llvm::SmallVector<int64_t> getLocalShape(llvm::ArrayRef<int64_t> fullShape,
+                                           const Sharding &sharding) const {
+    llvm::SmallVector<int64_t> shape(fullShape);
+    for (size_t axis = 0; axis < meshShape.size(); ++axis) {
+      if (sharding[axis] != kReplicated) {
+        shape[sharding[axis]] /= meshShape[axis];
+      }
+    }
+    return shape;
+  }
+
+  llvm::SmallVector<int64_t> getFullShape(Value value) const {
+    llvm::SmallVector<int64_t> shape(
+        mlir::cast<RankedTensorType>(value.getType()).getShape());
+    Sharding sharding = getSharding(value);
+    for (size_t axis = 0; axis < meshShape.size(); ++axis) {
+      if (sharding[axis] != kReplicated) {
+        shape[sharding[axis]] *= meshShape[axis];
+      }
+    }
+    return shape;
+  }
+
+  double getLocalBytes(Value value, llvm::ArrayRef<int64_t> fullShape,
+                       const Sharding &sharding) const {
+    auto type = mlir::cast<RankedTensorType>(value.getType());
+    return getNumElements(getLocalShape(fullShape, sharding)) *
+           type.getElementTypeBitWidth() / 8.0;
+  }
+
+  // Whether every sharded dimension of `shape` splits evenly over its mesh
+  // axis.
+  bool isDivisible(llvm::ArrayRef<int64_t> shape,
+                   const Sharding &sharding) const {
+    for (size_t axis = 0; axis < meshShape.size(); ++axis) {
+      if (sharding[axis] != kReplicated &&
+          shape[sharding[axis]] % meshShape[axis] != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Whether an argument of `shape` can be distributed with `sharding` by a
+  // mesh_shard.
+  bool isValidArgumentSharding(llvm::ArrayRef<int64_t> shape,
+                               const Sharding &sharding) const {
+    if (sharding.size() != meshShape.size()) {
+      return false;
+    }
+    if (isReplicated(sharding)) {
+      return true;
+    }
+    if (shape.size() < 2) {
+      return false;
+    }
+    for (size_t axis = 0; axis < meshShape.size(); ++axis) {
+      int64_t dim = sharding[axis];
+      if (dim == kReplicated) {
+        continue;
+      }
+      if (dim < 0 || dim >= static_cast<int64_t>(shape.size()) ||
+          meshShape[axis] == 1 ||
+          llvm::count(sharding, dim) != 1) {
+        return false;
+      }
+    }
+    return isDivisible(shape, sharding);
+  }
+
+  // Calls `fn` with every sharding of a rank `rank` tensor, i.e. every
+  // assignment of a distinct dimension or kReplicated to each mesh axis of
+  // more than one device.
+  void forEachSharding(int64_t rank,
+                       llvm::function_ref<void(const Sharding &)> fn) const {
+    Sharding sharding = getReplicated();
+    std::function<void(size_t)> assign = [&](size_t axis) {
+      if (axis == meshShape.size()) {
+        fn(sharding);
+        return;
+      }
+      for (int64_t dim = kReplicated; dim < rank; ++dim) {
+        if (dim != kReplicated &&
+            (meshShape[axis] == 1 ||
+             llvm::is_contained(llvm::ArrayRef(sharding).take_front(axis),
+                                dim))) {
+          continue;
+        }
+        sharding[axis] = dim;
+        assign(axis + 1);
+      }
+      sharding[axis] = kReplicated;
+    };
+    assign(0);
+  }
+
+  // Bytes moved to reshard `value` to `target`, or std::nullopt if that takes
+  // more than all_gathers. Open arguments are distributed from the host and
+  // take any sharding for free.
+  std::optional<double> getReshardCost(Value value,
+                                       const Sharding &target) const {
+    if (isOpenArgument(value)) {
+      auto type = mlir::cast<RankedTensorType>(value.getType());
+      if (!isValidArgumentSharding(type.getShape(), target)) {
+        return std::nullopt;
+      }
+      return 0.0;
+    }
+
+    llvm::SmallVector<int64_t> fullShape = getFullShape(value);
+    Sharding sharding = getSharding(value);
+    double cost = 0.0;
+    for (size_t axis = 0; axis < meshShape.size(); ++axis) {
+      if (sharding[axis] == target[axis]) {
+        continue;
+      }
+      if (target[axis] != kReplicated) {
+        return std::nullopt;
+      }
+      // Every device receives the (n - 1) / n of the gathered tensor it
+      // does not hold.
+      sharding[axis] = kReplicated;
+      cost += getLocalBytes(value, fullShape, sharding) *
+              (meshShape[axis] - 1) / meshShape[axis];
+    }
+    return cost;
+  }
+
+  // Picks the cheapest plan for `op` over all shardings of its iteration
+  // space of `iterShape`, as mapped to plans by `getPlan`.
+  std::optional<ShardingPlan> selectPlan(
+      DestinationStyleOpInterface op, llvm::ArrayRef<int64_t> iterShape,
+      llvm::function_ref<std::optional<ShardingPlan>(const Sharding &)>
+          getPlan) const {
+    Value result = op->getResult(0);
+    llvm::ArrayRef<int64_t> resultShape =
+        mlir::cast<RankedTensorType>(result.getType()).getShape();
+
+    std::optional<ShardingPlan> bestPlan;
+    double bestCost = 0.0;
+    int64_t bestVolume = 0;
+    forEachSharding(iterShape.size(), [&](const Sharding &iterSharding) {
+      if (!isDivisible(iterShape, iterSharding)) {
+        return;
+      }
+      std::optional<ShardingPlan> plan = getPlan(iterSharding);
+      if (!plan) {
+        return;
+      }
+
+      double cost = 0.0;
+      for (auto [operand, sharding] :
+           llvm::zip(op.getDpsInputOperands(), plan->operandShardings)) {
+        std::optional<double> reshardCost =
+            getReshardCost(operand->get(), sharding);
+        if (!reshardCost) {
+          return;
+        }
+        cost += *reshardCost;
+      }
+      // An all_reduce is a reduce_scatter and an all_gather, each moving
+      // (n - 1) / n of the tensor.
+      for (int64_t axis : plan->partialAxes) {
+        cost += getLocalBytes(result, resultShape, plan->resultSharding) *
+                2 * (meshShape[axis] - 1) / meshShape[axis];
+      }
+      int64_t volume =
+          getNumElements(getLocalShape(iterShape, iterSharding));
+
+      if (!bestPlan || cost < bestCost ||
+          (cost == bestCost && volume < bestVolume)) {
+        bestPlan = std::move(plan);
+        bestCost = cost;
+        bestVolume = volume;
+      }
+    });
+    return bestPlan;
+  }
+
+  // Elementwise ops iterate over their result. Broadcast operand
+  // dimensions stay replicated.
+  std::optional<ShardingPlan>
+  planElementwise(DestinationStyleOpInterface op) const {
+    llvm::ArrayRef<int64_t> resultShape =
+        mlir::cast<RankedTensorType>(op->getResult(0).getType()).getShape();
+    int64_t rank = resultShape.size();
+    llvm::SmallVector<llvm::SmallVector<int64_t>> inputShapes;
+    for (OpOperand *operand : op.getDpsInputOperands()) {
+      inputShapes.push_back(getFullShape(operand->get()));
+    }
+
+    return selectPlan(op, resultShape, [&](const Sharding &iterSharding) {
+      ShardingPlan plan;
+      plan.resultSharding = iterSharding;
+      for (llvm::ArrayRef<int64_t> inputShape : inputShapes) {
+        Sharding sharding = getReplicated();
+        int64_t offset = rank - inputShape.size();
+        for (size_t axis = 0; axis < meshShape.size(); ++axis) {
+          int64_t dim = iterSharding[axis];
+          if (dim != kReplicated && dim >= offset &&
+              inputShape[dim - offset] == resultShape[dim]) {
+            sharding[axis] = dim - offset;
+          }
+        }
+        plan.operandShardings.push_back(sharding);
+      }
+      return std::optional<ShardingPlan>(std::move(plan));
+    });
+  }
+
+  // Matmuls iterate over (batch..., m, n, k). Sharding k leaves partial sums
+  // on every device.
+  std::optional<ShardingPlan> planMatmul(MatmulOp op) const {
+    llvm::SmallVector<int64_t> aShape = getFullShape(op.getA());
+    llvm::SmallVector<int64_t> bShape = getFullShape(op.getB());
+    llvm::ArrayRef<int64_t> resultShape = op.getResult().getType().getShape();
+    int64_t rank = resultShape.size();
+    if (rank < 2 || static_cast<int64_t>(aShape.size()) != rank ||
+        static_cast<int64_t>(bShape.size()) != rank) {
+      return std::nullopt;
+    }
+    llvm::SmallVector<int64_t> iterShape(resultShape);
+    iterShape.push_back(aShape[rank - 1]);
+
+    return selectPlan(op, iterShape, [&](const Sharding &iterSharding) {
+      ShardingPlan plan;
+      plan.operandShardings = {getReplicated(), getReplicated()};
+      plan.resultSharding = getReplicated();
+      Sharding &aSharding = plan.operandShardings[0];
+      Sharding &bSharding = plan.operandShardings[1];
+      for (size_t axis = 0; axis < meshShape.size(); ++axis) {
+        int64_t dim = iterSharding[axis];
+        if (dim == kReplicated) {
+          continue;
+        }
+        if (dim == rank) {
+          aSharding[axis] = rank - 1;
+          bSharding[axis] = rank - 2;
+          plan.partialAxes.push_back(axis);
+          continue;
+        }
+        plan.resultSharding[axis] = dim;
+        if (dim != rank - 1 && aShape[dim] == iterShape[dim]) {
+          aSharding[axis] = dim;
+        }
+        if (dim != rank - 2 && bShape[dim] == iterShape[dim]) {
+          bSharding[axis] = dim;
+        }
+      }
+      return std::optional<ShardingPlan>(std::move(plan));
+    });
+  }
+
+  // Reductions iterate over their input. Sharding a reduced dimension leaves
+  // partial results on every device, which only reductions matching an
+  // all_reduce, given by `partialReduceType`, can finish.
+  template <typename ReductionOpTy>
+  std::optional<ShardingPlan>
+  planReduction(ReductionOpTy op,
+                std::optional<ReduceType> partialReduceType) const {
+    llvm::SmallVector<int64_t> inputShape = getFullShape(op.getInput());
+    int64_t rank = inputShape.size();
+    llvm::SmallVector<bool> isReduced(rank, !op.getDimArg());
+    if (std::optional<ArrayAttr> dimArg = op.getDimArg()) {
+      for (Attribute dim : *dimArg) {
+        isReduced[(mlir::cast<IntegerAttr>(dim).getInt() + rank) % rank] =
+            true;
+      }
+    }
+    bool keepDim = op.getKeepDim();
+    int64_t resultRank = op.getResult().getType().getRank();
+
+    return selectPlan(
+        op, inputShape,
+        [&](const Sharding &iterSharding) -> std::optional<ShardingPlan> {
+          ShardingPlan plan;
+          plan.operandShardings = {iterSharding};
+          plan.resultSharding = getReplicated();
+          for (size_t axis = 0; axis < meshShape.size(); ++axis) {
+            int64_t dim = iterSharding[axis];
+            if (dim == kReplicated) {
+              continue;
+            }
+            if (isReduced[dim]) {
+              if (!partialReduceType || resultRank == 0) {
+                return std::nullopt;
+              }
+              plan.reduceType = *partialReduceType;
+              plan.partialAxes.push_back(axis);
+              continue;
+            }
+            plan.resultSharding[axis] =
+                keepDim ? dim
+                        : dim - llvm::count(llvm::ArrayRef(isReduced)
+                                                .take_front(dim),
+                                            true);
+          }
+          return plan;
+        });
+  }
+
+  // Reshapes iterate over their input. A sharded dimension has to map to a
+  // single result dimension, anything else is gathered first.
+  std::optional<ShardingPlan> planReshape(ReshapeOp op) const {
+    llvm::SmallVector<int64_t> inputShape = getFullShape(op.getInput());
+    llvm::ArrayRef<int64_t> resultShape = op.getResult().getType().getShape();
+
+    return selectPlan(
+        op, inputShape,
+        [&](const Sharding &iterSharding) -> std::optional<ShardingPlan> {
+          ShardingPlan plan;
+          plan.operandShardings = {iterSharding};
+          plan.resultSharding = getReplicated();
+          for (size_t axis = 0; axis < meshShape.size(); ++axis) {
+            int64_t dim = iterSharding[axis];
+            if (dim == kReplicated) {
+              continue;
+            }
+            std::optional<int64_t> resultDim =
+                getReshapedDim(inputShape, resultShape, dim);
+            if (!resultDim) {
+              return std::nullopt;
+            }
+            plan.resultSharding[axis] = *resultDim;
+          }
+          return plan;
+        });
+  }
+
+  void partition(Operation *op) {
+    auto dpsOp = mlir::dyn_cast<DestinationStyleOpInterface>(op);
+    if (dpsOp && dpsOp.getNumDpsInits() == 1 && op->getNumResults() == 1) {
+      std::optional<ShardingPlan> plan =
+          llvm::TypeSwitch<Operation *, std::optional<ShardingPlan>>(op)
+              .Case([&](MatmulOp matmulOp) { return planMatmul(matmulOp); })
+              .Case([&](ReshapeOp reshapeOp) {
+                return planReshape(reshapeOp);
+              })
+              .Case([&](SumOp sumOp) {
+                return planReduction(sumOp, ReduceType::Sum);
+              })
+              .Case([&](MaxOp maxOp) {
+                return planReduction(maxOp, ReduceType::Max);
+              })
+              .Case([&](MinOp minOp) {
+                return planReduction(minOp, ReduceType::Min);
+              })
+              .Case([&](MeanOp meanOp) {
+                return planReduction(meanOp, std::nullopt);
+              })
+              .Case([&](Broadcastable) { return planElementwise(dpsOp); })
+              .Default([](Operation *) { return std::nullopt; });
+      if (plan) {
+        applyPlan(dpsOp, *plan);
+        return;
+      }
+    }
+    replicateOperands(op);
+  }
+
+  void applyPlan(DestinationStyleOpInterface op, const ShardingPlan &plan) {
+    builder.setInsertionPoint(op);
+    for (auto [operand, sharding] :
+         llvm::zip(op.getDpsInputOperands(), plan.operandShardings)) {
+      operand->set(reshard(operand->get(), sharding));
+    }
+
+    OpResult result = op->getResult(0);
+    auto resultType = mlir::cast<RankedTensorType>(result.getType());
+    llvm::SmallVector<int64_t> localShape =
+        getLocalShape(resultType.getShape(), plan.resultSharding);
+    if (localShape != resultType.getShape()) {
+      OpOperand *init = op.getDpsInitOperand(0);
+      replacedInits.push_back(init->get());
+      init->set(builder.create<tensor::EmptyOp>(
+          op.getLoc(), localShape, resultType.getElementType(),
+          resultType.getEncoding()));
+      result.setType(RankedTensorType::get(
+          localShape, resultType.getElementType(), resultType.getEncoding()));
+      if (auto reshapeOp = mlir::dyn_cast<ReshapeOp>(op.getOperation())) {
+        llvm::SmallVector<int32_t> shape(localShape.begin(),
+                                         localShape.end());
+        reshapeOp.setShapeAttr(builder.getI32ArrayAttr(shape));
+      }
+    }
+    shardings[result] = plan.resultSharding;
+
+    if (plan.partialAxes.empty()) {
+      return;
+    }
+    builder.setInsertionPointAfter(op);
+    Value reduced = result;
+    Operation *firstAllReduce = nullptr;
+    for (int64_t axis : plan.partialAxes) {
+      Operation *allReduce = createAllReduce(reduced, axis, plan.reduceType);
+      firstAllReduce = firstAllReduce ? firstAllReduce : allReduce;
+      reduced = allReduce->getResult(0);
+    }
+    result.replaceAllUsesExcept(reduced, firstAllReduce);
+    shardings[reduced] = plan.resultSharding;
+  }
+
+  // Gathers every sharded tensor `op` or the ops nested in it use.
+  void replicateOperands(Operation *op) {
+    builder.setInsertionPoint(op);
+    op->walk([&](Operation *nestedOp) {
+      for (OpOperand &operand : nestedOp->getOpOperands()) {
+        if (operand.get().getParentBlock() != op->getBlock() ||
+            !mlir::isa<RankedTensorType>(operand.get().getType())) {
+          continue;
+        }
+        operand.set(reshard(operand.get(), getReplicated()));
+      }
+    });
+  }
+
+  void partitionReturn(func::ReturnOp returnOp) {
+    builder.setInsertionPoint(returnOp);
+    for (OpOperand &operand : returnOp->getOpOperands()) {
+      auto type = mlir::dyn_cast<RankedTensorType>(
+          func.getResultTypes()[operand.getOperandNumber()]);
+      if (!type) {
+        continue;
+      }
+      Sharding sharding = getSharding(operand.get());
+      if (type.getRank() < 2) {
+        sharding = getReplicated();
+      }
+      Value local = reshard(operand.get(), sharding);
+      operand.set(createMeshShard(local, type, sharding,
+                                  MeshShardDirection::ShardToFull)
+                      .getResult());
+    }
+  }
+
+  LogicalResult seedArguments() {
+    for (BlockArgument arg : func.getArguments()) {
+      auto type = mlir::dyn_cast<RankedTensorType>(arg.getType());
+      if (!type) {
+        continue;
+      }
+      auto seed = func.getArgAttrOfType<DenseI64ArrayAttr>(
+          arg.getArgNumber(), kShardDimsAttrName);
+      if (!seed) {
+        openArgs.insert(arg);
+        continue;
+      }
+      Sharding sharding(seed.asArrayRef());
+      if (!isValidArgumentSharding(type.getShape(), sharding)) {
+        return func.emitOpError()
+               << "has an invalid " << kShardDimsAttrName << " on argument "
+               << arg.getArgNumber() << " for a mesh of shape "
+               << meshShape[0] << "x" << meshShape[1];
+      }
+      func.removeArgAttr(arg.getArgNumber(), kShardDimsAttrName);
+      shardArgument(arg, sharding);
+    }
+    return success();
+  }
+
+  // Distributes `arg` from the host with `sharding` at the start of the
+  // function.
+  Value shardArgument(BlockArgument arg, const Sharding &sharding) {
+    OpBuilder::InsertionGuard guard(builder);
+    if (lastArgShardOp) {
+      builder.setInsertionPointAfter(lastArgShardOp);
+    } else {
+      builder.setInsertionPointToStart(arg.getOwner());
+    }
+    auto type = mlir::cast<RankedTensorType>(arg.getType());
+    RankedTensorType localType =
+        RankedTensorType::get(getLocalShape(type.getShape(), sharding),
+                              type.getElementType(), type.getEncoding());
+    MeshShardOp shardOp = createMeshShard(arg, localType, sharding,
+                                          MeshShardDirection::FullToShard);
+    lastArgShardOp = shardOp;
+    arg.replaceAllUsesExcept(shardOp.getResult(), shardOp);
+    openArgs.erase(arg);
+    shardings[shardOp.getResult()] = sharding;
+    return shardOp.getResult();
+  }
+
+  // Returns `value` resharded to `target` with all_gathers.
+  Value reshard(Value value, const Sharding &target) {
+    if (isOpenArgument(value)) {
+      value = shardArgument(mlir::cast<BlockArgument>(value), target);
+    }
+    Sharding sharding = getSharding(value);
+    if (sharding == target) {
+      return value;
+    }
+    for (const auto &[cachedSharding, cachedValue] : reshardCache[value]) {
+      if (cachedSharding == target) {
+        return cachedValue;
+      }
+    }
+
+    Value gathered = value;
+    for (size_t axis = 0; axis < meshShape.size(); ++axis) {
+      if (sharding[axis] == target[axis]) {
+        continue;
+      }
+      assert(target[axis] == kReplicated && "resharding can only gather");
+      gathered = createAllGather(gathered, sharding[axis], axis);
+      sharding[axis] = kReplicated;
+      shardings[gathered] = sharding;
+    }
+    reshardCache[value].emplace_back(target, gathered);
+    return gathered;
+  }
+
+  Value createAllGather(Value input, int64_t dim, int64_t axis) {
+    auto inputType = mlir::cast<RankedTensorType>(input.getType());
+    llvm::SmallVector<int64_t> shape(inputType.getShape());
+    shape[dim] *= meshShape[axis];
+    auto type = RankedTensorType::get(shape, inputType.getElementType(),
+                                      inputType.getEncoding());
+    auto output = builder.create<tensor::EmptyOp>(
+        input.getLoc(), shape, type.getElementType(), type.getEncoding());
+    return builder
+        .create<AllGatherOp>(input.getLoc(), type, input, output,
+                             builder.getSI32IntegerAttr(dim),
+                             builder.getSI32IntegerAttr(axis))
+        .getResult();
+  }
+
+  Operation *createAllReduce(Value input, int64_t axis,
+                             ReduceType reduceType) {
+    auto type = mlir::cast<RankedTensorType>(input.getType());
+    // Devices along axis 1 form the rows of the mesh and devices along axis
+    // 0 its columns.
+    int64_t numCols = meshShape[1];
+    int64_t groupSize = meshShape[axis];
+    int64_t numGroups = meshShape[1 - axis];
+    llvm::SmallVector<int64_t> deviceIds;
+    for (int64_t group = 0; group < numGroups; ++group) {
+      for (int64_t i = 0; i < groupSize; ++i) {
+        deviceIds.push_back(axis == 0 ? i * numCols + group
+                                      : group * numCols + i);
+      }
+    }
+    auto replicaGroups = DenseIntElementsAttr::get(
+        RankedTensorType::get({numGroups, groupSize}, builder.getI64Type()),
+        deviceIds);
+
+    auto output = builder.create<tensor::EmptyOp>(
+        input.getLoc(), type.getShape(), type.getElementType(),
+        type.getEncoding());
+    llvm::SmallVector<Type> resultTypes = {type};
+    return builder.create<AllReduceOp>(
+        input.getLoc(), resultTypes, ValueRange(input), output, replicaGroups,
+        builder.getSI32IntegerAttr(type.getRank() - 1),
+        /*channel_handle=*/IntegerAttr(),
+        /*use_global_device_ids=*/UnitAttr(),
+        builder.getAttr<ReduceTypeAttr>(reduceType));
+  }
+
+  MeshShardOp createMeshShard(Value input, RankedTensorType type,
+                              const Sharding &sharding,
+                              MeshShardDirection direction) {
+    auto output = builder.create<tensor::EmptyOp>(
+        input.getLoc(), type.getShape(), type.getElementType(),
+        type.getEncoding());
+    if (isReplicated(sharding)) {
+      llvm::SmallVector<int64_t> shardShape = {1};
+      llvm::SmallVector<int64_t> shardDims = {kReplicated};
+      return builder.create<MeshShardOp>(input.getLoc(), type, input, output,
+                                         MeshShardType::Replicate, direction,
+                                         shardShape, shardDims);
+    }
+
+    int64_t rank = type.getRank();
+    llvm::SmallVector<int64_t> shardShape(rank, 1);
+    for (size_t axis = 0; axis < meshShape.size(); ++axis) {
+      if (sharding[axis] != kReplicated) {
+        shardShape[sharding[axis]] = meshShape[axis];
+      }
+    }
+    return builder.create<MeshShardOp>(input.getLoc(), type, input, output,
+                                       MeshShardType::Devices, direction,
+                                       shardShape, sharding);
+  }
+
+  func::FuncOp func;
+  llvm::SmallVector<int64_t, 2> meshShape;
+  OpBuilder builder;
+  // Sharding of every sharded value. Values missing are replicated.
+  llvm::DenseMap<Value, Sharding> shardings;
+  // Arguments without a seed not distributed from the host yet.
+  llvm::DenseSet<Value> openArgs;
+  // All_gathered copies of values, by the sharding they were gathered to.
+  llvm::DenseMap<Value, llvm::SmallVector<std::pair<Sharding, Value>, 1>>
+      reshardCache;
+  // DPS inits replaced by inits of the local result shape.
+  llvm::SmallVector<Value> replacedInits;
+  Operation *lastArgShardOp = nullptr;
+};
+
+} // namespace
+
+class TTIRAutomaticSharding
+    : public impl::TTIRAutomaticShardingBase<TTIRAutomaticSharding> {
+public:
+  using impl::TTIRAutomaticShardingBase<
+      TTIRAutomaticSharding>::TTIRAutomaticShardingBase;
+
+  void runOnOperation() final {
+    // Meshes are 2D, lines are 1xN and unit axes beyond the second are
+    // dropped.
+    llvm::SmallVector<int64_t, 2> mesh(meshShape.begin(), meshShape.end());
+    while (mesh.size() > 2 && llvm::is_contained(mesh, 1)) {
+      mesh.erase(llvm::find(mesh, 1));
+    }
+    if (mesh.size() == 1) {
+      mesh.insert(mesh.begin(), 1);
+    }
+    if (mesh.empty()) {
+      return;
+    }
+    if (mesh.size() != 2) {
+      getOperation()->emitOpError()
+          << "automatic sharding only supports 1D and 2D meshes";
+      signalPassFailure();
+      return;
+    }
+
+    for (func::FuncOp func : getOperation().getOps<func::FuncOp>()) {
+      if (func.isDeclaration() || !func.getBody().hasOneBlock()) {
+        continue;
+      }
+      bool hasSeeds = llvm::any_of(func.getArguments(), [&](BlockArgument arg) {
+        return func.getArgAttr(arg.getArgNumber(), kShardDimsAttrName);
+      });
+      if (!hasSeeds) {
+        continue;
+      }
+      if (failed(FuncPartitioner(func, mesh).run())) {
+        signalPassFailure();
+        return;
+      }
+    }
+  }
+};
+
+} // namespace mlir::tt::ttir
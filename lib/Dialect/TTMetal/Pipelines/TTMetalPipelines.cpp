@@ -31,6 +31,7 @@ void createTTIRToTTMetalBackendPipeline(
     // TODO(vroubtsovTT): 'options.version' is WIP until once StreamLayout is ok
     // to use end-to-end
     attachMetalLayoutOptions.useStreamLayout = options.version > 0;
+    attachMetalLayoutOptions.selectGrid = options.selectGrid;
   }
   pm.addPass(
       mlir::tt::ttir::createTTIRAttachMetalLayout(attachMetalLayoutOptions));
@@ -46,7 +47,12 @@ void createTTIRToTTMetalBackendPipeline(
   pm.addPass(mlir::tt::ttir::createTTIRGenericOpCBs());
   pm.addPass(mlir::tt::ttir::createTTIRGenericRegionOperandsToMemref());
   pm.addPass(mlir::tt::ttir::createTTIRAllocate());
-  pm.addPass(createConvertTTIRToTTMetalPass());
+  ttir::ConvertTTIRToTTMetalOptions convertOptions;
+  {
+    convertOptions.numStreamBuffers = options.numStreamBuffers;
+    convertOptions.enableMulticast = options.enableMulticast;
+  }
+  pm.addPass(createConvertTTIRToTTMetalPass(convertOptions));
 }
 
 //===----------------------------------------------------------------------===//
@@ -10,6 +10,7 @@
 #include "ttmlir/Dialect/TTNN/Utils/OptimizerOverrides.h"
 #include "ttmlir/Dialect/TTNN/Utils/Utils.h"
 #include "ttmlir/Dialect/TTNN/Utils/VirtualToPhysicalAffineMap.h"
+#include "ttmlir/Support/CompileReport.h"
 
 namespace mlir::tt::ttnn {
 
@@ -299,6 +300,9 @@ void LegalLayoutAnalysis::analysisImplementation() {
     }
   }
 
+  compile_report::addCounter("legal-layout-analysis.candidates",
+                             analysisResult.size() + shardedResults.size());
+
   // Filter layouts based on output tensor legality for current op.
   shardedResults.erase(
       std::remove_if(shardedResults.begin(), shardedResults.end(),
@@ -333,6 +337,9 @@ void LegalLayoutAnalysis::analysisImplementation() {
                          analysisResult.end());
   }
 
+  compile_report::addCounter("legal-layout-analysis.legal-layouts",
+                             analysisResult.size());
+
   if (analysisResult.empty()) {
     op->emitError("No legal layout found for the operation.");
     assert(false && "At least one legal layout must be found.");
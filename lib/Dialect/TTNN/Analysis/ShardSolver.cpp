@@ -5,6 +5,7 @@
 #include "ttmlir/Dialect/TTNN/Analysis/ShardSolver.h"
 #include "ttmlir/Dialect/TTNN/Analysis/L1ChainConfig.h"
 #include "ttmlir/Dialect/TTNN/IR/TTNNOps.h"
+#include "ttmlir/Support/CompileReport.h"
 #include <mlir/Interfaces/DestinationStyleOpInterface.h>
 #include <mlir/Support/LLVM.h>
 #include <unordered_set>
@@ -271,6 +272,7 @@ void ShardSolver::resolve() {
     //
     resolved = resolveStep();
     retry_step++;
+    compile_report::addCounter("shard-solver.resolve-iterations");
   } while (!resolved && retry_step <= max_retry_step);
 
   assert(resolved);
@@ -567,6 +569,7 @@ bool ShardSolver::checkShardCompatible(
     }
 
     auto l1UsageExp = backend.getOpConstraints(inputLayouts, consumerLayout);
+    compile_report::addCounter("op-model.constraint-queries");
 
     constexpr bool debug = false;
     if (!l1UsageExp) {
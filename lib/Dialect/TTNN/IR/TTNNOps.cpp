@@ -372,6 +372,47 @@ namespace mlir::tt::ttnn {
   return success();
 }
 
+//===----------------------------------------------------------------------===//
+// ConstantOp
+//===----------------------------------------------------------------------===//
+
+// ConstantOp verification
+::mlir::LogicalResult mlir::tt::ttnn::ConstantOp::verify() {
+  RankedTensorType output = mlir::cast<RankedTensorType>(getResult().getType());
+  ::mlir::ElementsAttr value = getValue();
+
+  if (value.getShapedType().getShape() != output.getShape()) {
+    return emitOpError() << "Value shape " << value.getShapedType().getShape()
+                         << " must match the output shape "
+                         << output.getShape();
+  }
+
+  if (!value.getElementType().isIntOrFloat()) {
+    return emitOpError()
+           << "Value must have integer or floating point element type";
+  }
+
+  // The values are serialized in the data type of the output, and TTNN has no
+  // f16 data type to load them in.
+  auto layout = mlir::dyn_cast_or_null<TTNNLayoutAttr>(output.getEncoding());
+  if (layout ? layout.getDataType() == DataType::Float16
+             : output.getElementType().isF16()) {
+    return emitOpError() << "Output data type f16 is not supported";
+  }
+
+  if (getDevice() && !getMemoryConfig()) {
+    return emitOpError()
+           << "Memory config must be provided when device is provided";
+  }
+
+  if (!getDevice() && getMemoryConfig()) {
+    return emitOpError()
+           << "Memory config is only supported for tensors on device";
+  }
+
+  return success();
+}
+
 //===----------------------------------------------------------------------===//
 // ConcatOp
 //===----------------------------------------------------------------------===//
@@ -1343,6 +1384,10 @@ mlir::tt::ttnn::ToLayoutOp::canonicalize(ToLayoutOp toLayoutOp,
     return emitOpError("Invalid dimension for all gather op.");
   }
 
+  if (getClusterAxis() != 0 && getClusterAxis() != 1) {
+    return emitOpError("Invalid cluster axis for all gather op.");
+  }
+
   return success();
 }
 
@@ -1367,6 +1412,10 @@ mlir::tt::ttnn::ToLayoutOp::canonicalize(ToLayoutOp toLayoutOp,
     return emitOpError("Invalid reduction op for reduce scatter op.");
   }
 
+  if (getClusterAxis() != 0 && getClusterAxis() != 1) {
+    return emitOpError("Invalid cluster axis for reduce scatter op.");
+  }
+
   return success();
 }
 
@@ -1390,6 +1439,11 @@ mlir::tt::ttnn::ToLayoutOp::canonicalize(ToLayoutOp toLayoutOp,
     return emitOpError("Invalid reduction op for all reduce op.");
   }
 
+  std::optional<int32_t> clusterAxis = getClusterAxis();
+  if (clusterAxis && *clusterAxis != 0 && *clusterAxis != 1) {
+    return emitOpError("Invalid cluster axis for all reduce op.");
+  }
+
   return success();
 }
 
@@ -1565,6 +1619,149 @@ mlir::tt::ttnn::ToLayoutOp::canonicalize(ToLayoutOp toLayoutOp,
   return success();
 }
 
+//===----------------------------------------------------------------------===//
+// PagedUpdateCacheOp
+//===----------------------------------------------------------------------===//
+
+::mlir::LogicalResult PagedUpdateCacheOp::verify() {
+  const ::mlir::RankedTensorType cacheType = getCache().getType();
+  const ::mlir::RankedTensorType inputType = getInput().getType();
+  const ::mlir::RankedTensorType updateIndexType = getUpdateIndex().getType();
+  const ::mlir::RankedTensorType pageTableType = getPageTable().getType();
+
+  if (cacheType.getElementType() != inputType.getElementType()) {
+    return emitOpError("Cache and input tensors must have the same dtype");
+  }
+
+  if (cacheType.getRank() != 4 || inputType.getRank() != 4) {
+    return emitOpError("Cache and input tensors must be 4D tensors");
+  }
+
+  if (inputType.getDimSize(0) != 1 ||
+      inputType.getDimSize(2) != cacheType.getDimSize(1) ||
+      inputType.getDimSize(3) != cacheType.getDimSize(3)) {
+    return emitOpError() << "Input tensor must be of the shape (1, batch, "
+                         << cacheType.getDimSize(1) << ", "
+                         << cacheType.getDimSize(3)
+                         << ") to match the cache tensor";
+  }
+
+  const int64_t batchSize = inputType.getDimSize(1);
+  if (updateIndexType.getRank() != 1 ||
+      updateIndexType.getDimSize(0) != batchSize) {
+    return emitOpError() << "Update index tensor must be of the shape ("
+                         << batchSize << ")";
+  }
+
+  if (pageTableType.getRank() != 2 ||
+      pageTableType.getDimSize(0) != batchSize) {
+    return emitOpError() << "Page table tensor must have " << batchSize
+                         << " rows, one per sequence";
+  }
+
+  return success();
+}
+
+//===----------------------------------------------------------------------===//
+// ScaledDotProductAttentionOp
+//===----------------------------------------------------------------------===//
+
+::mlir::LogicalResult ScaledDotProductAttentionOp::verify() {
+  const ::mlir::RankedTensorType queryType = getQuery().getType();
+  const ::mlir::RankedTensorType keyType = getKey().getType();
+  const ::mlir::RankedTensorType valueType = getValue().getType();
+
+  if (queryType.getRank() != 4 || keyType.getRank() != 4 ||
+      valueType.getRank() != 4) {
+    return emitOpError("Query, key and value tensors must be 4D tensors");
+  }
+
+  if (keyType.getShape() != valueType.getShape()) {
+    return emitOpError("Key and value tensors must have the same shape");
+  }
+
+  llvm::ArrayRef<int64_t> queryShape = queryType.getShape();
+  llvm::ArrayRef<int64_t> keyShape = keyType.getShape();
+  if (queryShape[0] != keyShape[0] || queryShape[3] != keyShape[3]) {
+    return emitOpError("Query and key tensors must have the same batch size "
+                       "and head size");
+  }
+
+  if (queryShape[1] % keyShape[1] != 0) {
+    return emitOpError("Number of query heads must be a multiple of the "
+                       "number of key and value heads");
+  }
+
+  if (getAttentionMask()) {
+    if (getIsCausal()) {
+      return emitOpError("Attention mask must be absent for causal attention");
+    }
+    llvm::ArrayRef<int64_t> maskShape =
+        getAttentionMask().getType().getShape();
+    if (maskShape.size() != 4 ||
+        (maskShape[0] != 1 && maskShape[0] != queryShape[0]) ||
+        (maskShape[1] != 1 && maskShape[1] != queryShape[1]) ||
+        maskShape[2] != queryShape[2] || maskShape[3] != keyShape[2]) {
+      return emitOpError() << "Attention mask must be of the shape (batch or "
+                              "1, num_heads or 1, "
+                           << queryShape[2] << ", " << keyShape[2] << ")";
+    }
+  }
+
+  if (getResult().getType().getShape() != queryShape) {
+    return emitOpError("Output tensor must have the shape of the query");
+  }
+
+  return success();
+}
+
+//===----------------------------------------------------------------------===//
+// PagedScaledDotProductAttentionDecodeOp
+//===----------------------------------------------------------------------===//
+
+::mlir::LogicalResult PagedScaledDotProductAttentionDecodeOp::verify() {
+  const ::mlir::RankedTensorType queryType = getQuery().getType();
+  const ::mlir::RankedTensorType keyCacheType = getKeyCache().getType();
+  const ::mlir::RankedTensorType valueCacheType = getValueCache().getType();
+  const ::mlir::RankedTensorType pageTableType = getPageTable().getType();
+  const ::mlir::RankedTensorType curPosType = getCurPos().getType();
+
+  if (queryType.getRank() != 4 || queryType.getDimSize(0) != 1) {
+    return emitOpError("Query tensor must be of the shape (1, batch, "
+                       "num_heads, head_dim)");
+  }
+
+  if (keyCacheType.getRank() != 4 ||
+      keyCacheType.getShape() != valueCacheType.getShape()) {
+    return emitOpError("Key and value caches must be 4D tensors of the same "
+                       "shape");
+  }
+
+  if (queryType.getDimSize(3) != keyCacheType.getDimSize(3) ||
+      queryType.getDimSize(2) % keyCacheType.getDimSize(1) != 0) {
+    return emitOpError("Query tensor must have the head size of the caches "
+                       "and a multiple of their number of heads");
+  }
+
+  const int64_t batchSize = queryType.getDimSize(1);
+  if (pageTableType.getRank() != 2 ||
+      pageTableType.getDimSize(0) != batchSize) {
+    return emitOpError() << "Page table tensor must have " << batchSize
+                         << " rows, one per sequence";
+  }
+
+  if (curPosType.getRank() != 1 || curPosType.getDimSize(0) != batchSize) {
+    return emitOpError() << "Current position tensor must be of the shape ("
+                         << batchSize << ")";
+  }
+
+  if (getResult().getType().getShape() != queryType.getShape()) {
+    return emitOpError("Output tensor must have the shape of the query");
+  }
+
+  return success();
+}
+
 //===----------------------------------------------------------------------===//
 // PermuteOp
 //===----------------------------------------------------------------------===//
@@ -171,6 +171,44 @@ TTNNOperandsWorkaroundsFactory::createUpsampleOpOperandsWorkarounds() {
       .addOutputOperandWorkaround(rowMajorLayoutBF16Workaround);
 }
 
+// Factory method to create a set of workarounds for paged update cache
+// operation operands. The kernel reads the update indices and the page table
+// row by row as int32 values, so they are expected in row-major layout and
+// int32 data type.
+TTNNOperandsWorkarounds
+TTNNOperandsWorkaroundsFactory::createPagedUpdateCacheOpOperandsWorkarounds() {
+  TTNNOperandWorkarounds emptyWorkaround =
+      TTNNOperandWorkarounds::createEmptyTTNNOperandWorkarounds();
+  TTNNOperandWorkarounds rowMajorInt32Workaround;
+  rowMajorInt32Workaround.tensorLayoutWorkaround = Layout::RowMajor;
+  rowMajorInt32Workaround.tensorDataTypeWorkaround = DataType::Int32;
+  return TTNNOperandsWorkarounds::createEmptyTTNNOperandsWorkarounds()
+      .addInputOperandWorkaround(emptyWorkaround)
+      .addInputOperandWorkaround(emptyWorkaround)
+      .addInputOperandWorkaround(rowMajorInt32Workaround)
+      .addInputOperandWorkaround(rowMajorInt32Workaround);
+}
+
+// Factory method to create a set of workarounds for paged scaled dot product
+// attention decode operation operands. As for the paged update cache, the page
+// table and the current positions are expected in row-major layout and int32
+// data type.
+TTNNOperandsWorkarounds TTNNOperandsWorkaroundsFactory::
+    createPagedScaledDotProductAttentionDecodeOpOperandsWorkarounds() {
+  TTNNOperandWorkarounds emptyWorkaround =
+      TTNNOperandWorkarounds::createEmptyTTNNOperandWorkarounds();
+  TTNNOperandWorkarounds rowMajorInt32Workaround;
+  rowMajorInt32Workaround.tensorLayoutWorkaround = Layout::RowMajor;
+  rowMajorInt32Workaround.tensorDataTypeWorkaround = DataType::Int32;
+  return TTNNOperandsWorkarounds::createEmptyTTNNOperandsWorkarounds()
+      .addInputOperandWorkaround(emptyWorkaround)
+      .addInputOperandWorkaround(emptyWorkaround)
+      .addInputOperandWorkaround(emptyWorkaround)
+      .addInputOperandWorkaround(rowMajorInt32Workaround)
+      .addInputOperandWorkaround(rowMajorInt32Workaround)
+      .addOutputOperandWorkaround(emptyWorkaround);
+}
+
 // Factory method to create a set of workarounds for cumsum operation operands.
 // The cumsum op generates incorrect results for integer data types. So input
 // tensor is converted to float32 in case of integer input.
@@ -6,9 +6,11 @@
 
 #include "ttmlir/Conversion/Passes.h"
 #include "ttmlir/Conversion/TTNNToEmitC/TTNNToEmitC.h"
+#include "ttmlir/Dialect/TTIR/Pipelines/Passes.h"
 #include "ttmlir/Dialect/TTIR/Transforms/Passes.h"
 #include "ttmlir/Dialect/TTNN/Transforms/Passes.h"
 
+#include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Pass/PassManager.h"
 #include "mlir/Transforms/Passes.h"
 
@@ -22,6 +24,13 @@ void createTTNNPipelineTTIRPasses(
   ttir::TTIRLoadSystemDescOptions systemDescOptions;
   systemDescOptions.path = options.systemDescPath;
 
+  if (!options.shapeBuckets.empty()) {
+    ttir::TTIRShapeBucketsOptions shapeBucketsOptions;
+    shapeBucketsOptions.bucketSizes = ::llvm::SmallVector<int64_t>(
+        options.shapeBuckets.begin(), options.shapeBuckets.end());
+    pm.addPass(mlir::tt::ttir::createTTIRShapeBuckets(shapeBucketsOptions));
+  }
+
   pm.addPass(mlir::createCanonicalizerPass());
   pm.addPass(mlir::tt::createTTIRToTTIRDecompositionPass());
   pm.addPass(mlir::createCanonicalizerPass());
@@ -30,6 +39,21 @@ void createTTNNPipelineTTIRPasses(
   // function. Removes all private functions.
   pm.addPass(mlir::createInlinerPass());
 
+  if (options.attentionFusionEnabled) {
+    pm.addPass(mlir::tt::ttir::createTTIRFuseAttention());
+  }
+
+  if (options.hostConstEvalEnabled) {
+    pm.addPass(mlir::tt::ttir::createTTIRConstEvalHost());
+  }
+
+  if (options.automaticShardingEnabled) {
+    ttir::TTIRAutomaticShardingOptions shardingOptions;
+    shardingOptions.meshShape = ::llvm::SmallVector<int64_t>(
+        options.meshShape.begin(), options.meshShape.end());
+    pm.addPass(mlir::tt::ttir::createTTIRAutomaticSharding(shardingOptions));
+  }
+
   pm.addPass(mlir::tt::ttir::createTTIRLoadSystemDesc(systemDescOptions));
 
   ttir::TTIRImplicitDeviceOptions implicitDeviceOptions;
@@ -63,6 +87,8 @@ void createTTNNPipelineLoweringPasses(
   pm.addPass(createConvertTTIRToTTNNPass());
   // Add pass to remove unused values.
   pm.addPass(mlir::createRemoveDeadValuesPass());
+  // Add pass to lower collectives that have no runtime op.
+  pm.addNestedPass<func::FuncOp>(createTTNNLowerCCL());
 }
 
 // Create a pass to workaround issues in the TTNN dialect.
@@ -71,18 +97,26 @@ void createTTNNPipelineWorkaroundPass(
   TTNNWorkaroundsOptions workaroundOptions{
       options.layoutWorkaroundsEnabled, options.decompositionWorkaroundsEnabled,
       options.repeatFoldingWorkaroundEnabled};
-  pm.addPass(createTTNNWorkarounds(workaroundOptions));
-  pm.addPass(mlir::createCanonicalizerPass());
+  // Workarounds only rewrite ops within a function, so they run on all
+  // functions of the module in parallel.
+  OpPassManager &funcPm = pm.nest<func::FuncOp>();
+  funcPm.addPass(createTTNNWorkarounds(workaroundOptions));
+  funcPm.addPass(mlir::createCanonicalizerPass());
 }
 
 void createTTNNPipelineLayoutDecompositionPass(
     OpPassManager &pm, const TTIRToTTNNBackendPipelineOptions &options) {
-  pm.addPass(createTTNNDecomposeLayouts());
+  OpPassManager &funcPm = pm.nest<func::FuncOp>();
+  funcPm.addPass(createTTNNDecomposeLayouts());
+  if (options.layoutConversionEliminationEnabled) {
+    funcPm.addPass(createTTNNEliminateLayoutConversions());
+  }
 }
 
 void createTTNNPipelineDeallocPass(
     OpPassManager &pm, const TTIRToTTNNBackendPipelineOptions &options) {
-  pm.addPass(createTTNNDeallocate());
+  OpPassManager &funcPm = pm.nest<func::FuncOp>();
+  funcPm.addPass(createTTNNDeallocate());
 }
 
 void createTTNNPipelineTTIRPassesFromString(OpPassManager &pm,
@@ -148,7 +182,13 @@ void createTTIRToTTNNBackendPipeline(
 void createTTIRToEmitCPipeline(OpPassManager &pm,
                                const TTIRToEmitCPipelineOptions &options) {
   createTTIRToTTNNBackendPipeline(pm, options);
-  pm.addPass(createTTNNCreateInputGenerators());
+  if (options.modelEntryPointsEnabled) {
+    TTNNCreateModelEntryPointsOptions modelEntryPointsOptions;
+    modelEntryPointsOptions.benchmarkIterations = options.benchmarkIterations;
+    pm.addPass(createTTNNCreateModelEntryPoints(modelEntryPointsOptions));
+  } else {
+    pm.addPass(createTTNNCreateInputGenerators());
+  }
   pm.addPass(createConvertTTNNToEmitCPass());
 }
 
@@ -11,6 +11,7 @@
 #include "ttmlir/Dialect/TTNN/IR/TTNNOpsTypes.h"
 #include "ttmlir/Dialect/TTNN/Transforms/Passes.h"
 #include "ttmlir/Dialect/TTNN/Utils/Utils.h"
+#include "ttmlir/Support/CompileReport.h"
 
 namespace mlir::tt::ttnn {
 
@@ -496,6 +497,7 @@ private:
 
         consumerOp->setOperand(edge.operandIndex,
                                memoryReconfigOp->getResult(0));
+        compile_report::addCounter("ttnn-optimizer.reshards-inserted");
       }
     }
   }
@@ -6,6 +6,7 @@
 
 #include "ttmlir/Dialect/TT/IR/TTOps.h"
 #include "ttmlir/Dialect/TT/IR/TTOpsTypes.h"
+#include "ttmlir/Dialect/TTNN/IR/TTNN.h"
 #include "ttmlir/Dialect/TTNN/IR/TTNNOps.h"
 #include "ttmlir/Dialect/TTNN/IR/TTNNOpsAttrs.h"
 #include "ttmlir/Dialect/TTNN/IR/TTNNOpsTypes.h"
@@ -16,9 +17,12 @@
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/IR/BuiltinAttributes.h"
 #include "mlir/IR/BuiltinTypes.h"
+#include "mlir/IR/IRMapping.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/IR/TypeRange.h"
 #include "mlir/IR/ValueRange.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Casting.h"
@@ -26,6 +30,7 @@
 namespace mlir::tt::ttnn {
 #define GEN_PASS_DEF_TTNNDEALLOCATE
 #define GEN_PASS_DEF_TTNNCREATEINPUTGENERATORS
+#define GEN_PASS_DEF_TTNNCREATEMODELENTRYPOINTS
 #define GEN_PASS_DEF_TTNNMODIFYSIGNATURESFORDYLIB
 #include "ttmlir/Dialect/TTNN/Transforms/Passes.h.inc"
 
@@ -63,60 +68,197 @@ public:
   }
 
   void runOnOperation() final {
-    ModuleOp module = getOperation();
+    func::FuncOp func = getOperation();
+    if (func.isDeclaration()) {
+      return;
+    }
+    assert(func.getBody().hasOneBlock() &&
+           "found func that didn't have one block!");
     IRRewriter rewriter(&getContext());
+    Liveness &liveness = getAnalysis<Liveness>();
+    const LivenessBlockInfo *livenessInfo =
+        liveness.getLiveness(&func.getBody().front());
 
-    module->walk([&](func::FuncOp func) {
-      if (func.isDeclaration()) {
+    // Handle non DPS ops which do not store function result and are used to
+    // allocate tensors. DPS ops are handled via ttnn::EmptyOp.
+    //
+    func->walk([&](Operation *op) {
+      if (isa<DestinationStyleOpInterface>(op)) {
         return;
       }
-      assert(func.getBody().hasOneBlock() &&
-             "found func that didn't have one block!");
-      Liveness liveness(func.getOperation());
-      const LivenessBlockInfo *livenessInfo =
-          liveness.getLiveness(&func.getBody().front());
-
-      // Handle non DPS ops which do not store function result and are used to
-      // allocate tensors. DPS ops are handled via ttnn::EmptyOp.
+
+      // Skip ops which do not have results.
       //
-      func->walk([&](Operation *op) {
-        if (isa<DestinationStyleOpInterface>(op)) {
-          return;
-        }
+      if (op->getNumResults() == 0) {
+        return;
+      }
 
-        // Skip ops which do not have results.
+      // Iterate over all results of the op.
+      //
+      for (OpResult result : op->getResults()) {
+        // Check if result is ranked tensor type.
         //
-        if (op->getNumResults() == 0) {
-          return;
+        if (!isa<RankedTensorType>(result.getType())) {
+          continue;
         }
 
-        // Iterate over all results of the op.
-        //
-        for (OpResult result : op->getResults()) {
-          // Check if result is ranked tensor type.
-          //
-          if (!isa<RankedTensorType>(result.getType())) {
-            continue;
-          }
-
-          RankedTensorType resultTy =
-              mlir::cast<RankedTensorType>(result.getType());
-          assert(resultTy.getEncoding());
+        RankedTensorType resultTy =
+            mlir::cast<RankedTensorType>(result.getType());
+        assert(resultTy.getEncoding());
 
-          Operation *lastOp = getLastValueUsageOp(livenessInfo, result);
-
-          if (isa<func::ReturnOp>(lastOp)) {
-            continue;
-          }
+        Operation *lastOp = getLastValueUsageOp(livenessInfo, result);
 
-          rewriter.setInsertionPointAfter(lastOp);
-          rewriter.create<DeallocateOp>(lastOp->getLoc(), result);
+        if (isa<func::ReturnOp>(lastOp)) {
+          continue;
         }
-      });
+
+        rewriter.setInsertionPointAfter(lastOp);
+        rewriter.create<DeallocateOp>(lastOp->getLoc(), result);
+      }
     });
   }
 };
 
+// Returns the func.func ops in the module that are "forward" functions
+//
+static SmallVector<func::FuncOp, 1> getForwardFuncOps(ModuleOp module) {
+  // Ensure that the module has a single region and a single block within that
+  // region
+  assert(module->getRegions().size() == 1);
+  assert(module->getRegion(0).getBlocks().size() == 1);
+
+  SmallVector<func::FuncOp, 1> forwardFuncOps;
+  for (mlir::Operation &op : module.getBody(0)->getOperations()) {
+    if (mlir::func::FuncOp funcOp = dyn_cast<func::FuncOp>(op)) {
+
+      // Skip functions that are called elsewhere in the IR
+      //
+      // This will skip utility functions that are used by other functions,
+      // only top-level "forward" functions should be considered
+      //
+      if (!funcOp->getUses().empty()) {
+        continue;
+      }
+
+      forwardFuncOps.push_back(funcOp);
+    }
+  }
+  return forwardFuncOps;
+}
+
+// Creates a function at the end of the module that generates input tensors
+// for `forwardFuncOp`
+//
+static func::FuncOp createInputGenerator(IRRewriter &rewriter,
+                                         ModuleOp module,
+                                         func::FuncOp forwardFuncOp) {
+  MLIRContext *context = rewriter.getContext();
+
+  // Create a new function that will generate the input tensors
+  //
+  std::string inputGenFuncName =
+      "createInputsFor_" + forwardFuncOp.getName().str();
+
+  // Create function type
+  //
+  mlir::TypeRange returnTypeRange =
+      mlir::TypeRange(forwardFuncOp.getFunctionType().getInputs());
+  FunctionType functionType =
+      mlir::FunctionType::get(context, {}, returnTypeRange);
+
+  // Set insertion point to end of first block
+  //
+  rewriter.setInsertionPointToEnd(module.getBody(0));
+
+  // Create the function
+  //
+  func::FuncOp inputGenFuncOp = rewriter.create<mlir::func::FuncOp>(
+      module->getLoc(), inputGenFuncName, functionType);
+
+  // Add a Block to func op and set insertion point to the beginning of the
+  // Block
+  //
+  ::mlir::Block *currFnBlock = inputGenFuncOp.addEntryBlock();
+  rewriter.setInsertionPointToStart(currFnBlock);
+
+  // Create the input tensors
+  //
+  SmallVector<Value, 2> generatedTensors;
+  for (Type tensorType : returnTypeRange) {
+    assert(llvm::isa<mlir::RankedTensorType>(tensorType));
+
+    RankedTensorType tensor = llvm::cast<mlir::RankedTensorType>(tensorType);
+
+    // Get the layout attribute
+    //
+    ttnn::TTNNLayoutAttr layoutAttr =
+        mlir::cast<ttnn::TTNNLayoutAttr>(tensor.getEncoding());
+
+    // Get the shape of the tensor, tensor layout, and data type
+    //
+    ShapeAttr shapeAttr = ttnn::ShapeAttr::get(context, tensor.getShape());
+    ttnn::LayoutAttr tensorLayoutAttr =
+        ttnn::LayoutAttr::get(context, layoutAttr.getLayout());
+    DataTypeAttr dTypeAttr =
+        DataTypeAttr::get(context, layoutAttr.getDataType());
+
+    // Create a new tensor
+    //
+    mlir::Value tensorValue = rewriter.create<ttnn::OnesOp>(
+        forwardFuncOp->getLoc(), tensorType, shapeAttr, dTypeAttr,
+        tensorLayoutAttr, nullptr, nullptr);
+
+    generatedTensors.push_back(tensorValue);
+  }
+
+  // Return the generated tensors
+  //
+  rewriter.create<func::ReturnOp>(forwardFuncOp->getLoc(), generatedTensors);
+
+  return inputGenFuncOp;
+}
+
+// Creates a main function at the end of the module that returns 0, and sets
+// the insertion point right before its return
+//
+static func::FuncOp createMainFunc(IRRewriter &rewriter, ModuleOp module) {
+  // Create function type
+  //
+  mlir::TypeRange returnTypeRange = mlir::TypeRange(rewriter.getI32Type());
+  FunctionType functionType =
+      mlir::FunctionType::get(rewriter.getContext(), {}, returnTypeRange);
+
+  // Set insertion point to end of first block
+  //
+  rewriter.setInsertionPointToEnd(module.getBody(0));
+
+  // Create the function
+  //
+  func::FuncOp mainFuncOp = rewriter.create<mlir::func::FuncOp>(
+      module->getLoc(), "main", functionType);
+
+  ::mlir::Block *currFnBlock = mainFuncOp.addEntryBlock();
+
+  // Set insertion point to the beginning of the block
+  //
+  rewriter.setInsertionPointToStart(currFnBlock);
+
+  // Return 0
+  //
+  // func::ReturnOp requires a Value to be returned, which means that an SSA
+  // needs to be returned, hence create a constant 0 via arith::ConstantOp
+  //
+  Value constantZero = rewriter.create<arith::ConstantOp>(
+      rewriter.getUnknownLoc(), rewriter.getI32Type(),
+      rewriter.getI32IntegerAttr(0));
+  func::ReturnOp returnOp =
+      rewriter.create<func::ReturnOp>(mainFuncOp->getLoc(), constantZero);
+
+  rewriter.setInsertionPoint(returnOp);
+
+  return mainFuncOp;
+}
+
 class TTNNCreateInputGenerators
     : public impl::TTNNCreateInputGeneratorsBase<TTNNCreateInputGenerators> {
 
@@ -128,168 +270,201 @@ public:
     ModuleOp module = getOperation();
     IRRewriter rewriter(&getContext());
 
-    // Ensure that the module has a single region and a single block within that
-    // region
-    assert(module->getRegions().size() == 1);
-    assert(module->getRegion(0).getBlocks().size() == 1);
-
-    // Get the first block of the region at index 0
-    //
-    Block *firstBlock = module.getBody(0);
-
     // Find all the func.func ops in the module that are "forward" functions
     //
-    SmallVector<func::FuncOp, 1> forwardFuncOps;
-    for (mlir::Operation &op : firstBlock->getOperations()) {
-      if (mlir::func::FuncOp funcOp = dyn_cast<func::FuncOp>(op)) {
-
-        // Skip functions that are called elsewhere in the IR
-        //
-        // This will skip utility functions that are used by other functions,
-        // only top-level "forward" functions should be considered
-        //
-        if (!funcOp->getUses().empty()) {
-          continue;
-        }
-
-        forwardFuncOps.push_back(funcOp);
-      }
-    }
+    SmallVector<func::FuncOp, 1> forwardFuncOps = getForwardFuncOps(module);
 
     // Iterate over all the func ops and add input tensor generator functions
     //
+    SmallVector<func::FuncOp, 1> inputGenFuncOps;
     for (mlir::func::FuncOp forwardFuncOp : forwardFuncOps) {
-      // Get all the input tensors for the current forward func
-      //
-      llvm::SmallVector<mlir::RankedTensorType, 2> inputTensors;
-      for (auto input : forwardFuncOp.getFunctionType().getInputs()) {
-        inputTensors.push_back(llvm::cast<mlir::RankedTensorType>(input));
-      }
-
-      // Create a new function that will generate the input tensors
-      //
-      std::string inputGenFuncName =
-          "createInputsFor_" + forwardFuncOp.getName().str();
-
-      // Create function type
-      //
-      mlir::TypeRange returnTypeRange =
-          mlir::TypeRange(forwardFuncOp.getFunctionType().getInputs());
-      FunctionType functionType =
-          mlir::FunctionType::get(&getContext(), {}, returnTypeRange);
-
-      // Set insertion point to end of first block
-      //
-      rewriter.setInsertionPointToEnd(firstBlock);
-
-      // Create the function
-      //
-      func::FuncOp inputGenFuncOp = rewriter.create<mlir::func::FuncOp>(
-          module->getLoc(), inputGenFuncName, functionType);
+      inputGenFuncOps.push_back(
+          createInputGenerator(rewriter, module, forwardFuncOp));
+    }
 
-      // Add a Block to func op and set insertion point to the beginning of the
-      // Block
+    // Create a main function to call input generators and forward funcs
+    //
+    createMainFunc(rewriter, module);
+    for (size_t i = 0; i < forwardFuncOps.size(); i++) {
+      // Call the input generator function
       //
-      ::mlir::Block *currFnBlock = inputGenFuncOp.addEntryBlock();
-      rewriter.setInsertionPointToStart(currFnBlock);
+      func::CallOp createdTensors = rewriter.create<mlir::func::CallOp>(
+          forwardFuncOps[i]->getLoc(), inputGenFuncOps[i], ValueRange());
 
-      // Create the input tensors
-      //
-      SmallVector<Value, 2> generatedTensors;
-      for (Type tensorType : returnTypeRange) {
-        assert(llvm::isa<mlir::RankedTensorType>(tensorType));
+      rewriter.create<mlir::func::CallOp>(forwardFuncOps[i]->getLoc(),
+                                          forwardFuncOps[i],
+                                          createdTensors->getResults());
+    }
+  }
+};
 
-        RankedTensorType tensor =
-            llvm::cast<mlir::RankedTensorType>(tensorType);
+class TTNNCreateModelEntryPoints
+    : public impl::TTNNCreateModelEntryPointsBase<TTNNCreateModelEntryPoints> {
 
-        // Get the layout attribute
-        //
-        ttnn::TTNNLayoutAttr layoutAttr =
-            mlir::cast<ttnn::TTNNLayoutAttr>(tensor.getEncoding());
+public:
+  using impl::TTNNCreateModelEntryPointsBase<
+      TTNNCreateModelEntryPoints>::TTNNCreateModelEntryPointsBase;
 
-        // Get the shape of the tensor, tensor layout, and data type
-        //
-        ShapeAttr shapeAttr =
-            ttnn::ShapeAttr::get(&getContext(), tensor.getShape());
-        ttnn::LayoutAttr tensorLayoutAttr =
-            ttnn::LayoutAttr::get(&getContext(), layoutAttr.getLayout());
-        DataTypeAttr dTypeAttr =
-            DataTypeAttr::get(&getContext(), layoutAttr.getDataType());
-
-        // Create a new tensor
-        //
-        mlir::Value tensorValue = rewriter.create<ttnn::OnesOp>(
-            forwardFuncOp->getLoc(), tensorType, shapeAttr, dTypeAttr,
-            tensorLayoutAttr, nullptr, nullptr);
+  void runOnOperation() final {
+    ModuleOp module = getOperation();
+    IRRewriter rewriter(&getContext());
 
-        generatedTensors.push_back(tensorValue);
-      }
+    // Find all the func.func ops in the module that are "forward" functions
+    //
+    SmallVector<func::FuncOp, 1> forwardFuncOps = getForwardFuncOps(module);
 
-      // Return the generated tensors
-      //
-      rewriter.create<func::ReturnOp>(forwardFuncOp->getLoc(),
-                                      generatedTensors);
+    // Input generators are created first, as they follow the signature of the
+    // forward funcs before the state arguments are added to them
+    //
+    SmallVector<func::FuncOp, 1> inputGenFuncOps;
+    SmallVector<func::FuncOp, 1> initFuncOps;
+    for (mlir::func::FuncOp forwardFuncOp : forwardFuncOps) {
+      inputGenFuncOps.push_back(
+          createInputGenerator(rewriter, module, forwardFuncOp));
+      initFuncOps.push_back(createInitFunc(rewriter, module, forwardFuncOp));
     }
 
-    // Create a main function to call input generators and forward funcs
+    // Create a main function that initializes each model once and then runs
+    // it on generated inputs
     //
-    {
-      // Create a new function that will generate the input tensors
-      //
-      std::string mainFuncName = "main";
-
-      // Create function type
-      //
-      mlir::TypeRange returnTypeRange = mlir::TypeRange(rewriter.getI32Type());
-      FunctionType functionType =
-          mlir::FunctionType::get(&getContext(), {}, returnTypeRange);
+    func::FuncOp mainFuncOp = createMainFunc(rewriter, module);
+    if (benchmarkIterations > 0) {
+      mainFuncOp->setAttr(utils::kBenchmarkIterationsAttrName,
+                          rewriter.getI32IntegerAttr(benchmarkIterations));
+    }
+    for (size_t i = 0; i < forwardFuncOps.size(); i++) {
+      Location loc = forwardFuncOps[i]->getLoc();
+      func::CallOp state = rewriter.create<mlir::func::CallOp>(
+          loc, initFuncOps[i], ValueRange());
+      func::CallOp createdTensors = rewriter.create<mlir::func::CallOp>(
+          loc, inputGenFuncOps[i], ValueRange());
+
+      SmallVector<Value> operands =
+          llvm::to_vector(createdTensors->getResults());
+      llvm::append_range(operands, state->getResults());
+      rewriter.create<mlir::func::CallOp>(loc, forwardFuncOps[i], operands);
+    }
+  }
 
-      // Set insertion point to end of first block
-      //
-      rewriter.setInsertionPointToEnd(firstBlock);
+private:
+  // Returns whether `op` can run once at init time: it creates values without
+  // depending on the inputs of the function, and the tensors it creates are
+  // kept in DRAM or host memory
+  //
+  static bool isInitOp(Operation *op,
+                       const llvm::SetVector<Operation *> &initOps) {
+    if (!llvm::isa_and_present<TTNNDialect>(op->getDialect()) ||
+        op->getNumResults() == 0 || op->getNumRegions() != 0) {
+      return false;
+    }
 
-      // Create the function
-      //
-      func::FuncOp mainFuncOp = rewriter.create<mlir::func::FuncOp>(
-          module->getLoc(), mainFuncName, functionType);
+    bool dependsOnInitOpsOnly =
+        llvm::all_of(op->getOperands(), [&initOps](Value operand) {
+          Operation *definingOp = operand.getDefiningOp();
+          return definingOp && initOps.contains(definingOp);
+        });
+    if (!dependsOnInitOpsOnly) {
+      return false;
+    }
 
-      ::mlir::Block *currFnBlock = mainFuncOp.addEntryBlock();
+    return llvm::all_of(op->getResultTypes(), [](Type type) {
+      auto tensorType = mlir::dyn_cast<RankedTensorType>(type);
+      if (!tensorType) {
+        return true;
+      }
+      auto layoutAttr =
+          mlir::dyn_cast_if_present<TTNNLayoutAttr>(tensorType.getEncoding());
+      return layoutAttr && (layoutAttr.isSystemBufferType() ||
+                            layoutAttr.getBufferType() == BufferType::DRAM);
+    });
+  }
 
-      // Set insertion point to the beginning of the block
-      //
-      rewriter.setInsertionPointToStart(currFnBlock);
+  // Moves the init ops of `forwardFuncOp` to a new `<name>_init` function,
+  // which returns the values they produce that the remaining ops use. These
+  // values are appended to the arguments of `forwardFuncOp`
+  //
+  func::FuncOp createInitFunc(IRRewriter &rewriter, ModuleOp module,
+                              func::FuncOp forwardFuncOp) {
+    Block &entryBlock = forwardFuncOp.getBody().front();
+
+    llvm::SetVector<Operation *> initOps;
+    for (Operation &op : entryBlock) {
+      if (isInitOp(&op, initOps)) {
+        initOps.insert(&op);
+      }
+    }
 
-      // Call the input generators
-      //
-      for (mlir::func::FuncOp forwardFuncOp : forwardFuncOps) {
-        std::string inputGenFuncName =
-            "createInputsFor_" + forwardFuncOp.getName().str();
+    // Deallocations of values created at init time are dropped, so that
+    // buffers are kept and reused across runs
+    //
+    SmallVector<Value> stateValues;
+    SmallVector<Operation *> deallocOps;
+    for (Operation *op : initOps) {
+      for (Value result : op->getResults()) {
+        bool isState = false;
+        for (Operation *user : result.getUsers()) {
+          if (mlir::isa<DeallocateOp>(user)) {
+            deallocOps.push_back(user);
+          } else if (!initOps.contains(user)) {
+            isState = true;
+          }
+        }
+        if (isState) {
+          stateValues.push_back(result);
+        }
+      }
+    }
 
-        // Get the input generator function
-        //
-        mlir::func::FuncOp inputGenFuncOp =
-            module.lookupSymbol<mlir::func::FuncOp>(inputGenFuncName);
+    // Create the init function by cloning the init ops into it
+    //
+    SmallVector<Type> stateTypes;
+    for (Value stateValue : stateValues) {
+      stateTypes.push_back(stateValue.getType());
+    }
+    rewriter.setInsertionPointToEnd(module.getBody(0));
+    func::FuncOp initFuncOp = rewriter.create<func::FuncOp>(
+        forwardFuncOp->getLoc(), forwardFuncOp.getName().str() + "_init",
+        rewriter.getFunctionType({}, stateTypes));
+    rewriter.setInsertionPointToStart(initFuncOp.addEntryBlock());
+
+    IRMapping mapping;
+    for (Operation *op : initOps) {
+      rewriter.clone(*op, mapping);
+    }
+    SmallVector<Value> initResults;
+    for (Value stateValue : stateValues) {
+      initResults.push_back(mapping.lookup(stateValue));
+    }
+    rewriter.create<func::ReturnOp>(forwardFuncOp->getLoc(), initResults);
 
-        // Call the input generator function
-        //
-        func::CallOp createdTensors = rewriter.create<mlir::func::CallOp>(
-            forwardFuncOp->getLoc(), inputGenFuncOp, ValueRange());
+    // Replace the init ops in the forward function with state arguments
+    //
+    for (Operation *deallocOp : deallocOps) {
+      rewriter.eraseOp(deallocOp);
+    }
+    for (Value stateValue : stateValues) {
+      BlockArgument stateArg =
+          entryBlock.addArgument(stateValue.getType(), stateValue.getLoc());
+      rewriter.replaceAllUsesWith(stateValue, stateArg);
+    }
+    for (Operation *op : llvm::reverse(initOps)) {
+      rewriter.eraseOp(op);
+    }
 
-        rewriter.create<mlir::func::CallOp>(forwardFuncOp->getLoc(),
-                                            forwardFuncOp,
-                                            createdTensors->getResults());
+    FunctionType funcType = forwardFuncOp.getFunctionType();
+    rewriter.modifyOpInPlace(forwardFuncOp, [&]() {
+      forwardFuncOp.setType(
+          funcType.clone(entryBlock.getArgumentTypes(), funcType.getResults()));
+      if (ArrayAttr argAttrs = forwardFuncOp.getArgAttrsAttr()) {
+        SmallVector<Attribute> newArgAttrs(argAttrs.begin(), argAttrs.end());
+        newArgAttrs.resize(entryBlock.getNumArguments(),
+                           rewriter.getDictionaryAttr({}));
+        forwardFuncOp.setArgAttrsAttr(rewriter.getArrayAttr(newArgAttrs));
       }
+      forwardFuncOp->setAttr(utils::kModelRunAttrName, rewriter.getUnitAttr());
+    });
 
-      // Return 0
-      //
-      // func::ReturnOp requires a Value to be returned, which means that an SSA
-      // needs to be returned, hence create a constant 0 via arith::ConstantOp
-      //
-      Value constantZero = rewriter.create<arith::ConstantOp>(
-          rewriter.getUnknownLoc(), rewriter.getI32Type(),
-          rewriter.getI32IntegerAttr(0));
-      rewriter.create<func::ReturnOp>(mainFuncOp->getLoc(), constantZero);
-    }
+    return initFuncOp;
   }
 };
 
@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TTNN/Transforms/Passes.h"
+
+#include "ttmlir/Dialect/TTNN/IR/TTNNOps.h"
+#include "ttmlir/Dialect/TTNN/IR/TTNNOpsAttrs.h"
+#include "ttmlir/Support/CompileReport.h"
+
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/Dominance.h"
+#include "mlir/IR/PatternMatch.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+
+#include <iterator>
+#include <tuple>
+
+namespace mlir::tt::ttnn {
+#define GEN_PASS_DEF_TTNNELIMINATELAYOUTCONVERSIONS
+#include "ttmlir/Dialect/TTNN/Transforms/Passes.h.inc"
+
+namespace {
+
+bool isLayoutConversion(Operation *op) {
+  return mlir::isa<ToDeviceOp, FromDeviceOp, ToLayoutOp, TypecastOp, ToDTypeOp,
+                   ToMemoryConfigOp>(op);
+}
+
+TTNNLayoutAttr getLayout(Value value) {
+  auto type = mlir::dyn_cast<RankedTensorType>(value.getType());
+  if (!type) {
+    return nullptr;
+  }
+  return mlir::dyn_cast_if_present<TTNNLayoutAttr>(type.getEncoding());
+}
+
+// Returns true if every value of `from` is exactly representable in `to`.
+bool isLosslessConversion(DataType from, DataType to) {
+  if (from == to) {
+    return true;
+  }
+  switch (from) {
+  case DataType::BFloat16:
+  case DataType::Float16:
+    return to == DataType::Float32;
+  case DataType::BFP_BFloat8:
+  case DataType::BFP_BFloat4:
+  case DataType::BFP_BFloat2:
+    return to == DataType::BFloat16 || to == DataType::Float32;
+  case DataType::UInt8:
+  case DataType::UInt16:
+    return to == DataType::UInt16 || to == DataType::UInt32 ||
+           to == DataType::Int32;
+  default:
+    return false;
+  }
+}
+
+// Moves between host and device, tile and row major layouts and memory
+// configs keep the data as is, only data type conversions can lose it.
+bool isLosslessConversion(Operation *op) {
+  TTNNLayoutAttr inputLayout = getLayout(op->getOperand(0));
+  TTNNLayoutAttr outputLayout = getLayout(op->getResult(0));
+  return inputLayout && outputLayout &&
+         isLosslessConversion(inputLayout.getDataType(),
+                              outputLayout.getDataType());
+}
+
+// Returns true if only layout conversions run between `value` is defined and
+// `op`, i.e. reusing `value` for a result of `op` does not keep it alive
+// across any other op.
+bool isAdjacent(Value value, Operation *op) {
+  Block *block = op->getBlock();
+  if (value.getParentBlock() != block) {
+    return false;
+  }
+  Operation *def = value.getDefiningOp();
+  Block::iterator it = def ? std::next(def->getIterator()) : block->begin();
+  for (; &*it != op; ++it) {
+    if (!isLayoutConversion(&*it)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+class TTNNEliminateLayoutConversions
+    : public impl::TTNNEliminateLayoutConversionsBase<
+          TTNNEliminateLayoutConversions> {
+public:
+  using impl::TTNNEliminateLayoutConversionsBase<
+      TTNNEliminateLayoutConversions>::TTNNEliminateLayoutConversionsBase;
+
+  void runOnOperation() final {
+    func::FuncOp func = getOperation();
+    if (func.isDeclaration()) {
+      return;
+    }
+    domInfo = &getAnalysis<DominanceInfo>();
+    origins.clear();
+    losslessValues.clear();
+    lossyValues.clear();
+
+    llvm::SmallVector<Operation *> conversions;
+    func.walk([&](Operation *op) {
+      if (isLayoutConversion(op)) {
+        conversions.push_back(op);
+      }
+    });
+
+    IRRewriter rewriter(&getContext());
+    for (Operation *op : conversions) {
+      Value result = op->getResult(0);
+      if (Value existing = findEquivalentValue(op)) {
+        rewriter.replaceAllUsesWith(result, existing);
+        continue;
+      }
+      if (isLosslessConversion(op)) {
+        Value origin = getOrigin(op->getOperand(0));
+        origins[result] = origin;
+        losslessValues[{origin, result.getType()}].push_back(result);
+      } else {
+        lossyValues[{getOrigin(op->getOperand(0)), result.getType(),
+                     op->getName()}]
+            .push_back(result);
+      }
+    }
+
+    // Conversions whose results were replaced, and the ones only they used,
+    // are dead now.
+    uint64_t numErased = 0;
+    for (Operation *op : llvm::reverse(conversions)) {
+      if (op->use_empty()) {
+        rewriter.eraseOp(op);
+        numErased++;
+      }
+    }
+    compile_report::addCounter("ttnn-eliminate-layout-conversions.erased",
+                               numErased);
+  }
+
+private:
+  // The origin of a value is the value it was converted from losslessly,
+  // through any number of conversions. Values with the same origin and type
+  // hold the same data.
+  Value getOrigin(Value value) const {
+    if (Value origin = origins.lookup(value)) {
+      return origin;
+    }
+    return value;
+  }
+
+  // Returns a value that holds the same data as the result of `op`, in the
+  // same layout, and is available before `op`, or nullptr if there is none.
+  Value findEquivalentValue(Operation *op) const {
+    Value input = op->getOperand(0);
+    Type type = op->getResult(0).getType();
+    Value origin = getOrigin(input);
+
+    // A round trip back to the layout of the origin. The input holds the
+    // data of the origin exactly, so converting it back recovers the origin
+    // even if the conversion could lose data in general, e.g. bf16 -> f32 ->
+    // bf16.
+    if (origin.getType() == type && isReusable(origin, op)) {
+      return origin;
+    }
+
+    llvm::ArrayRef<Value> candidates;
+    if (isLosslessConversion(op)) {
+      auto it = losslessValues.find({origin, type});
+      if (it != losslessValues.end()) {
+        candidates = it->second;
+      }
+    } else {
+      // The same conversion of the same data.
+      auto it = lossyValues.find({origin, type, op->getName()});
+      if (it != lossyValues.end()) {
+        candidates = it->second;
+      }
+    }
+    for (Value candidate : candidates) {
+      if (isReusable(candidate, op)) {
+        return candidate;
+      }
+    }
+    return nullptr;
+  }
+
+  // Reusing a value extends its lifetime up to the uses of `op`. That is
+  // fine for DRAM and host tensors, but L1 tensors are only reused if no
+  // other op runs in between, as the memory layout analysis planned L1 usage
+  // for the lifetimes as they are.
+  bool isReusable(Value value, Operation *op) const {
+    if (!domInfo->properlyDominates(value, op)) {
+      return false;
+    }
+    TTNNLayoutAttr layout = getLayout(value);
+    if (layout && layout.getBufferType() == BufferType::L1) {
+      return isAdjacent(value, op);
+    }
+    return true;
+  }
+
+  DominanceInfo *domInfo = nullptr;
+  llvm::DenseMap<Value, Value> origins;
+  llvm::DenseMap<std::pair<Value, Type>, llvm::SmallVector<Value, 1>>
+      losslessValues;
+  llvm::DenseMap<std::tuple<Value, Type, OperationName>,
+                 llvm::SmallVector<Value, 1>>
+      lossyValues;
+};
+
+} // namespace mlir::tt::ttnn
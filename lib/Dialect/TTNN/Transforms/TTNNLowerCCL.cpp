@@ -0,0 +1,309 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TTNN/Transforms/Passes.h"
+
+#include "ttmlir/Conversion/TTIRToTTNN/Utils.h"
+#include "ttmlir/Dialect/TT/IR/TTOpsTypes.h"
+#include "ttmlir/Dialect/TTNN/IR/TTNNOps.h"
+#include "ttmlir/Dialect/TTNN/IR/TTNNOpsAttrs.h"
+#include "ttmlir/Dialect/TTNN/Utils/CCLCostModel.h"
+#include "ttmlir/Dialect/TTNN/Utils/TransformUtils.h"
+#include "ttmlir/Dialect/TTNN/Utils/Utils.h"
+
+#include "mlir/IR/BuiltinTypes.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/Rewrite/FrozenRewritePatternSet.h"
+#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+
+#include <utility>
+
+namespace mlir::tt::ttnn {
+#define GEN_PASS_DEF_TTNNLOWERCCL
+#include "ttmlir/Dialect/TTNN/Transforms/Passes.h.inc"
+
+namespace {
+
+int64_t getTensorSizeBytes(RankedTensorType type) {
+  return type.getNumElements() * type.getElementTypeBitWidth() / 8;
+}
+
+// Returns the mesh shape of the device the op runs on. Single chip devices
+// have an empty mesh shape.
+llvm::SmallVector<int64_t> getMeshShape(Operation *op) {
+  llvm::SmallVector<int64_t> meshShape(
+      getCurrentScopeDevice(op).getMeshShape());
+  if (meshShape.empty()) {
+    meshShape = {1, 1};
+  }
+  return meshShape;
+}
+
+RankedTensorType withShape(RankedTensorType type, ArrayRef<int64_t> shape) {
+  TTNNLayoutAttr layoutAttr =
+      utils::getLayoutAttrFromTensor(type).withTensorShape(type.getContext(),
+                                                           shape);
+  return RankedTensorType::get(shape, type.getElementType(), layoutAttr);
+}
+
+// Picks the dimension to scatter a tensor over `numPieces` devices along: the
+// requested one if it splits evenly, otherwise the innermost one that does.
+int64_t selectScatterDim(ArrayRef<int64_t> shape, int64_t preferredDim,
+                         int64_t numPieces) {
+  if (shape[preferredDim] % numPieces == 0) {
+    return preferredDim;
+  }
+  for (int64_t dim = shape.size() - 1; dim >= 0; --dim) {
+    if (shape[dim] % numPieces == 0) {
+      return dim;
+    }
+  }
+  return preferredDim;
+}
+
+// Fuses independent all_reduce ops smaller than the bucket size into a single
+// all_reduce of their flattened concatenation, sliced back apart afterwards.
+// Tensor parallel layers issue many tiny all_reduces whose cost is dominated
+// by the per collective latency, which is paid once per bucket instead.
+class AllReduceBucketingPattern : public OpRewritePattern<AllReduceOp> {
+public:
+  AllReduceBucketingPattern(MLIRContext *context, int64_t bucketSizeBytes)
+      : OpRewritePattern<AllReduceOp>(context),
+        bucketSizeBytes(bucketSizeBytes) {}
+
+  LogicalResult matchAndRewrite(AllReduceOp op,
+                                PatternRewriter &rewriter) const override {
+    int64_t bucketBytes = getTensorSizeBytes(op.getType());
+    if (bucketBytes >= bucketSizeBytes) {
+      return failure();
+    }
+
+    // Collect the compatible all_reduces following `op` in its block up to
+    // the first op that depends on one already in the bucket.
+    llvm::SmallVector<AllReduceOp> bucket = {op};
+    for (Operation &next : llvm::make_range(std::next(op->getIterator()),
+                                            op->getBlock()->end())) {
+      bool dependsOnBucket = llvm::any_of(bucket, [&](AllReduceOp member) {
+        return llvm::any_of(member->getUsers(), [&](Operation *user) {
+          return next.isAncestor(user);
+        });
+      });
+      if (dependsOnBucket) {
+        break;
+      }
+      auto candidate = mlir::dyn_cast<AllReduceOp>(next);
+      if (!candidate || !isCompatible(op, candidate)) {
+        continue;
+      }
+      int64_t candidateBytes = getTensorSizeBytes(candidate.getType());
+      if (bucketBytes + candidateBytes > bucketSizeBytes) {
+        break;
+      }
+      bucket.push_back(candidate);
+      bucketBytes += candidateBytes;
+    }
+
+    // The fused tensor is scattered along its only non unit dimension, which
+    // has to split evenly across the devices.
+    auto getNumElements = [](llvm::ArrayRef<AllReduceOp> members) {
+      int64_t numElements = 0;
+      for (AllReduceOp member : members) {
+        numElements += member.getType().getNumElements();
+      }
+      return numElements;
+    };
+    while (bucket.size() > 1 &&
+           getNumElements(bucket) % op.getScatterNum() != 0) {
+      bucket.pop_back();
+    }
+    if (bucket.size() < 2) {
+      return failure();
+    }
+
+    AllReduceOp lastMember = bucket.back();
+    rewriter.setInsertionPoint(lastMember);
+    Location loc = lastMember.getLoc();
+
+    llvm::SmallVector<Value> flattenedInputs;
+    for (AllReduceOp member : bucket) {
+      int64_t numElements = member.getType().getNumElements();
+      flattenedInputs.push_back(
+          ttir_to_ttnn::utils::generateReshape(
+              member.getInput(), {1, 1, 1, numElements}, rewriter)
+              .getResult());
+    }
+    RankedTensorType fusedType =
+        withShape(op.getType(), {1, 1, 1, getNumElements(bucket)});
+    EmptyOp concatOutput =
+        utils::createEmptyOp(rewriter, loc, fusedType, op.getDevice());
+    ConcatOp concatOp = rewriter.create<ConcatOp>(
+        loc, fusedType, flattenedInputs, concatOutput, /*dim=*/3,
+        /*memory_config=*/nullptr);
+    AllReduceOp fusedOp = rewriter.create<AllReduceOp>(
+        loc, fusedType, concatOp.getResult(), op.getDevice(),
+        /*scatter_dim=*/3, op.getScatterNum(), op.getMathOp(),
+        op.getNumLinks(), op.getClusterAxisAttr());
+
+    int64_t offset = 0;
+    for (AllReduceOp member : bucket) {
+      int64_t numElements = member.getType().getNumElements();
+      RankedTensorType slicedType =
+          withShape(member.getType(), {1, 1, 1, numElements});
+      EmptyOp sliceOutput =
+          utils::createEmptyOp(rewriter, loc, slicedType, op.getDevice());
+      SliceOp sliceOp = rewriter.create<SliceOp>(
+          loc, slicedType, fusedOp.getResult(), sliceOutput,
+          rewriter.getI32ArrayAttr({0, 0, 0, static_cast<int32_t>(offset)}),
+          rewriter.getI32ArrayAttr(
+              {1, 1, 1, static_cast<int32_t>(offset + numElements)}),
+          rewriter.getI32ArrayAttr({1, 1, 1, 1}));
+      ReshapeOp reshapeOp = ttir_to_ttnn::utils::generateReshape(
+          sliceOp.getResult(), member.getType().getShape(), rewriter);
+      rewriter.replaceOp(member, reshapeOp.getResult());
+      offset += numElements;
+    }
+    return success();
+  }
+
+private:
+  // All reduces can share a bucket if they reduce over the same devices the
+  // same way and their tensors can be concatenated without relayouting.
+  static bool isCompatible(AllReduceOp op, AllReduceOp other) {
+    if (op.getDevice() != other.getDevice() ||
+        op.getMathOp() != other.getMathOp() ||
+        op.getScatterNum() != other.getScatterNum() ||
+        op.getClusterAxisAttr() != other.getClusterAxisAttr() ||
+        op.getNumLinks() != other.getNumLinks() ||
+        op.getType().getElementType() != other.getType().getElementType()) {
+      return false;
+    }
+    TTNNLayoutAttr layoutAttr = utils::getLayoutAttrFromTensor(op.getType());
+    TTNNLayoutAttr otherLayoutAttr =
+        utils::getLayoutAttrFromTensor(other.getType());
+    return layoutAttr.getLayout() == otherLayoutAttr.getLayout() &&
+           layoutAttr.getBufferType() == otherLayoutAttr.getBufferType() &&
+           layoutAttr.getMemLayout() == otherLayoutAttr.getMemLayout();
+  }
+
+  int64_t bucketSizeBytes;
+};
+
+// Lowers an all_reduce to reduce_scatter ops followed by all_gather ops in the
+// reverse order, one pair per mesh axis reduced along, each in the topology
+// the cost model picks for it.
+class AllReduceLoweringPattern : public OpRewritePattern<AllReduceOp> {
+public:
+  AllReduceLoweringPattern(MLIRContext *context, utils::CCLCostModel costModel)
+      : OpRewritePattern<AllReduceOp>(context), costModel(costModel) {}
+
+  LogicalResult matchAndRewrite(AllReduceOp op,
+                                PatternRewriter &rewriter) const override {
+    if (op.getScatterNum() == 1) {
+      rewriter.replaceOp(op, op.getInput());
+      return success();
+    }
+
+    RankedTensorType inputType = op.getInput().getType();
+    llvm::SmallVector<int64_t> meshShape = getMeshShape(op);
+    utils::AllReduceLowering lowering = utils::selectAllReduceLowering(
+        costModel, meshShape, op.getClusterAxis(), op.getScatterNum(),
+        getTensorSizeBytes(inputType));
+
+    // Mesh axes reduced along, with the number of devices along each.
+    llvm::SmallVector<std::pair<int32_t, int64_t>, 2> axes;
+    if (lowering.algorithm == utils::AllReduceAlgorithm::Torus2D) {
+      axes = {{1, meshShape[1]}, {0, meshShape[0]}};
+    } else {
+      axes = {{lowering.clusterAxis, op.getScatterNum()}};
+    }
+
+    int64_t rank = inputType.getRank();
+    int64_t scatterDim = op.getScatterDim();
+    if (scatterDim < 0) {
+      scatterDim += rank;
+    }
+    llvm::SmallVector<int64_t> shape(inputType.getShape());
+    TypedValue<RankedTensorType> input = op.getInput();
+
+    // TODO(wooseoklee): Once it supports two dimensional tensor
+    // (https://github.com/tenstorrent/tt-metal/issues/15010), we can remove
+    // this workaround solution.
+    if (rank < 4) {
+      shape.insert(shape.begin(), 4 - rank, 1);
+      input = ttir_to_ttnn::utils::generateReshape(input, shape, rewriter)
+                  .getResult();
+      scatterDim += 4 - rank;
+    }
+    scatterDim = selectScatterDim(shape, scatterDim, op.getScatterNum());
+
+    for (auto [clusterAxis, numDevices] : axes) {
+      shape[scatterDim] /= numDevices;
+      input = rewriter
+                  .create<ReduceScatterOp>(
+                      op.getLoc(), withShape(input.getType(), shape), input,
+                      op.getDevice(), scatterDim, op.getMathOp(),
+                      op.getNumLinks(), clusterAxis,
+                      lowering.axisTopology[clusterAxis])
+                  .getResult();
+    }
+    for (auto [clusterAxis, numDevices] : llvm::reverse(axes)) {
+      shape[scatterDim] *= numDevices;
+      input = rewriter
+                  .create<AllGatherOp>(
+                      op.getLoc(), withShape(input.getType(), shape), input,
+                      op.getDevice(), scatterDim, op.getNumLinks(),
+                      clusterAxis, lowering.axisTopology[clusterAxis])
+                  .getResult();
+    }
+
+    if (rank < 4) {
+      input = ttir_to_ttnn::utils::generateReshape(
+                  input, op.getType().getShape(), rewriter)
+                  .getResult();
+    }
+    rewriter.replaceOp(op, input);
+    return success();
+  }
+
+private:
+  utils::CCLCostModel costModel;
+};
+
+} // namespace
+
+class TTNNLowerCCL : public impl::TTNNLowerCCLBase<TTNNLowerCCL> {
+public:
+  using impl::TTNNLowerCCLBase<TTNNLowerCCL>::TTNNLowerCCLBase;
+
+  void runOnOperation() final {
+    if (bucketSizeBytes > 0) {
+      RewritePatternSet patterns(&getContext());
+      patterns.add<AllReduceBucketingPattern>(&getContext(), bucketSizeBytes);
+      // Buckets are grown forward from their first member.
+      GreedyRewriteConfig config;
+      config.useTopDownTraversal = true;
+      if (failed(applyPatternsAndFoldGreedily(
+              getOperation(), std::move(patterns), config))) {
+        signalPassFailure();
+        return;
+      }
+    }
+
+    utils::CCLCostModel costModel;
+    costModel.hopLatencyUs = hopLatencyUs;
+    costModel.linkBandwidthBytesPerUs = linkBandwidthBytesPerUs;
+    costModel.hasWraparoundLinks = wraparoundLinks;
+    RewritePatternSet patterns(&getContext());
+    patterns.add<AllReduceLoweringPattern>(&getContext(), costModel);
+    if (failed(applyPatternsAndFoldGreedily(getOperation(),
+                                            std::move(patterns)))) {
+      signalPassFailure();
+      return;
+    }
+  }
+};
+
+} // namespace mlir::tt::ttnn
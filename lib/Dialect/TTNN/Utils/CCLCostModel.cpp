@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TTNN/Utils/CCLCostModel.h"
+
+#include <utility>
+
+namespace mlir::tt::ttnn::utils {
+
+double CCLCostModel::getAllReduceCostUs(Topology topology, int64_t numDevices,
+                                        int64_t tensorBytes) const {
+  if (numDevices <= 1) {
+    return 0.0;
+  }
+
+  double steps = 2.0 * (numDevices - 1);
+  double busiestLinkBytes = steps / numDevices * tensorBytes;
+  double stepLatencyUs = hopLatencyUs;
+  if (topology == Topology::Ring && numDevices > 2) {
+    // Both directions of the ring are used, each covering half the devices.
+    steps = 2.0 * (numDevices / 2);
+    busiestLinkBytes /= 2;
+    if (!hasWraparoundLinks) {
+      stepLatencyUs *= numDevices - 1;
+    }
+  }
+  return steps * stepLatencyUs + busiestLinkBytes / linkBandwidthBytesPerUs;
+}
+
+// Cheapest topology for an all_reduce along a single mesh axis. Rings of two
+// devices are lines, so they are never picked.
+static std::pair<Topology, double>
+selectAxisTopology(const CCLCostModel &costModel, int64_t numDevices,
+                   int64_t tensorBytes) {
+  double lineCostUs =
+      costModel.getAllReduceCostUs(Topology::Linear, numDevices, tensorBytes);
+  if (numDevices <= 2) {
+    return {Topology::Linear, lineCostUs};
+  }
+  double ringCostUs =
+      costModel.getAllReduceCostUs(Topology::Ring, numDevices, tensorBytes);
+  if (ringCostUs < lineCostUs) {
+    return {Topology::Ring, ringCostUs};
+  }
+  return {Topology::Linear, lineCostUs};
+}
+
+AllReduceLowering selectAllReduceLowering(const CCLCostModel &costModel,
+                                          llvm::ArrayRef<int64_t> meshShape,
+                                          std::optional<int32_t> clusterAxis,
+                                          int64_t numDevices,
+                                          int64_t tensorBytes) {
+  AllReduceLowering lowering;
+  bool is2DMesh = meshShape.size() == 2 && meshShape[0] > 1 && meshShape[1] > 1;
+  if (!clusterAxis && is2DMesh) {
+    // Scattering along axis 1 leaves 1 / meshShape[1] of the tensor to be
+    // reduced along axis 0.
+    auto [axis1Topology, axis1CostUs] =
+        selectAxisTopology(costModel, meshShape[1], tensorBytes);
+    auto [axis0Topology, axis0CostUs] = selectAxisTopology(
+        costModel, meshShape[0], tensorBytes / meshShape[1]);
+    lowering.algorithm = AllReduceAlgorithm::Torus2D;
+    lowering.axisTopology = {axis0Topology, axis1Topology};
+    lowering.costUs = axis0CostUs + axis1CostUs;
+    return lowering;
+  }
+
+  if (clusterAxis) {
+    lowering.clusterAxis = *clusterAxis;
+  } else if (meshShape.size() == 2 && meshShape[0] > 1) {
+    lowering.clusterAxis = 0;
+  }
+  auto [topology, costUs] =
+      selectAxisTopology(costModel, numDevices, tensorBytes);
+  lowering.algorithm = topology == Topology::Ring ? AllReduceAlgorithm::Ring
+                                                  : AllReduceAlgorithm::Line;
+  lowering.axisTopology[lowering.clusterAxis] = topology;
+  lowering.costUs = costUs;
+  return lowering;
+}
+
+} // namespace mlir::tt::ttnn::utils
@@ -98,4 +98,22 @@ createToLayoutOp(Operation *op, mlir::TypedValue<RankedTensorType> inputValue,
       DataTypeAttr::get(rewriter.getContext(), targetTensorDataType),
       outputMemConfigAttr, deviceValue);
 }
+
+// Helper method to create an EmptyOp of the given type on the given device.
+// Its shape, data type, layout and memory config are taken from the type.
+EmptyOp createEmptyOp(PatternRewriter &rewriter, Location loc,
+                      RankedTensorType type, Value device) {
+  TTNNLayoutAttr layoutAttr = getLayoutAttrFromTensor(type);
+  MLIRContext *context = rewriter.getContext();
+  ttnn::MemoryConfigAttr memoryConfigAttr = ttnn::MemoryConfigAttr::get(
+      context, ttnn::BufferTypeAttr::get(context, layoutAttr.getBufferType()),
+      ttnn::ShardSpecAttr::get(
+          context, ttnn::ShapeAttr::get(context, layoutAttr.getShardShape())),
+      layoutAttr.getMemLayout());
+  return rewriter.create<ttnn::EmptyOp>(
+      loc, type, ttnn::ShapeAttr::get(context, type.getShape()),
+      DataTypeAttr::get(context, layoutAttr.getDataType()),
+      LayoutAttr::get(context, layoutAttr.getLayout()), device,
+      memoryConfigAttr);
+}
 } // namespace mlir::tt::ttnn::utils
@@ -112,6 +112,9 @@ Type dataTypeToElementType(::mlir::MLIRContext *context, DataType dtype) {
   case DataType::UInt8:
     return IntegerType::get(context, 8,
                             IntegerType::SignednessSemantics::Unsigned);
+  case DataType::Int32:
+    return IntegerType::get(context, 32,
+                            IntegerType::SignednessSemantics::Signed);
   }
 }
 
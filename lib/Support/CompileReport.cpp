@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Support/CompileReport.h"
+
+#include "mlir/Pass/Pass.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace mlir::tt::compile_report {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Timing {
+  uint64_t runs = 0;
+  Clock::duration time = Clock::duration::zero();
+};
+
+struct Report {
+  std::atomic<bool> enabled{false};
+  Clock::time_point start;
+
+  std::mutex mutex;
+  llvm::StringMap<uint64_t> counters;
+  llvm::StringMap<Timing> passes;
+  llvm::StringMap<Timing> analyses;
+};
+
+Report &getReport() {
+  static Report report;
+  return report;
+}
+
+class TimingInstrumentation : public PassInstrumentation {
+public:
+  void runBeforePass(Pass *pass, Operation *op) override {
+    // Pass adaptors only run the nested pass managers, whose passes are
+    // timed on their own.
+    if (pass->getArgument().empty()) {
+      return;
+    }
+    start(pass, op);
+  }
+
+  void runAfterPass(Pass *pass, Operation *op) override {
+    stop(pass, op, pass->getArgument(), &Report::passes);
+  }
+
+  void runAfterPassFailed(Pass *pass, Operation *op) override {
+    stop(pass, op, pass->getArgument(), &Report::passes);
+  }
+
+  void runBeforeAnalysis(StringRef name, TypeID id, Operation *op) override {
+    start(id.getAsOpaquePointer(), op);
+  }
+
+  void runAfterAnalysis(StringRef name, TypeID id, Operation *op) override {
+    stop(id.getAsOpaquePointer(), op, name, &Report::analyses);
+  }
+
+private:
+  using Key = std::pair<const void *, Operation *>;
+
+  void start(const void *key, Operation *op) {
+    std::lock_guard<std::mutex> lock(mutex);
+    startTimes[Key(key, op)] = Clock::now();
+  }
+
+  void stop(const void *key, Operation *op, StringRef name,
+            llvm::StringMap<Timing> Report::*timings) {
+    Clock::time_point end = Clock::now();
+    Clock::time_point begin;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = startTimes.find(Key(key, op));
+      if (it == startTimes.end()) {
+        return;
+      }
+      begin = it->second;
+      startTimes.erase(it);
+    }
+
+    Report &report = getReport();
+    std::lock_guard<std::mutex> lock(report.mutex);
+    Timing &timing = (report.*timings)[name];
+    timing.runs++;
+    timing.time += end - begin;
+  }
+
+  std::mutex mutex;
+  llvm::DenseMap<Key, Clock::time_point> startTimes;
+};
+
+double toMilliseconds(Clock::duration duration) {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+// Emits the timings sorted by decreasing time, so the passes worth looking at
+// come first.
+void writeTimings(llvm::json::OStream &json, StringRef name,
+                  const llvm::StringMap<Timing> &timings) {
+  std::vector<std::pair<StringRef, Timing>> sorted;
+  for (const auto &entry : timings) {
+    sorted.emplace_back(entry.getKey(), entry.getValue());
+  }
+  std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b) {
+    return a.second.time > b.second.time;
+  });
+
+  json.attributeArray(name, [&] {
+    for (const auto &entry : sorted) {
+      json.object([&] {
+        json.attribute("name", entry.first);
+        json.attribute("runs", static_cast<int64_t>(entry.second.runs));
+        json.attribute("time_ms", toMilliseconds(entry.second.time));
+      });
+    }
+  });
+}
+
+} // namespace
+
+void enable() {
+  Report &report = getReport();
+  std::lock_guard<std::mutex> lock(report.mutex);
+  if (!report.enabled) {
+    report.start = Clock::now();
+    report.enabled = true;
+  }
+}
+
+bool isEnabled() { return getReport().enabled; }
+
+void addCounter(StringRef name, uint64_t value) {
+  Report &report = getReport();
+  if (!report.enabled) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(report.mutex);
+  report.counters[name] += value;
+}
+
+std::unique_ptr<PassInstrumentation> createTimingInstrumentation() {
+  return std::make_unique<TimingInstrumentation>();
+}
+
+LogicalResult writeReport(StringRef path) {
+  std::error_code ec;
+  llvm::raw_fd_ostream os(path, ec, llvm::sys::fs::OF_Text);
+  if (ec) {
+    llvm::errs() << "failed to open compile report '" << path
+                 << "': " << ec.message() << "\n";
+    return failure();
+  }
+
+  Report &report = getReport();
+  std::lock_guard<std::mutex> lock(report.mutex);
+
+  std::vector<std::pair<StringRef, uint64_t>> counters;
+  for (const auto &entry : report.counters) {
+    counters.emplace_back(entry.getKey(), entry.getValue());
+  }
+  llvm::sort(counters);
+
+  llvm::json::OStream json(os, /*IndentSize=*/2);
+  json.object([&] {
+    json.attribute("wall_time_ms",
+                   toMilliseconds(Clock::now() - report.start));
+    writeTimings(json, "passes", report.passes);
+    writeTimings(json, "analyses", report.analyses);
+    json.attributeObject("counters", [&] {
+      for (const auto &[name, value] : counters) {
+        json.attribute(name, static_cast<int64_t>(value));
+      }
+    });
+  });
+  os << "\n";
+  return success();
+}
+
+} // namespace mlir::tt::compile_report
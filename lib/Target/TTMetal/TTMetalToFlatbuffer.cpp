@@ -13,8 +13,10 @@
 #include "mlir/Support/LLVM.h"
 #include "mlir/Support/LogicalResult.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/Support/LogicalResult.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/xxhash.h"
 
 #include "ttmlir/Conversion/TTKernelToEmitC/TTKernelToEmitC.h"
 #include "ttmlir/Dialect/TT/IR/TT.h"
@@ -352,10 +354,16 @@ static std::shared_ptr<void> translateModuleToFlatbuffer(
           auto [kernelConfigType, kernelConfigUnion] = toFlatbuffer(
               fbb, mlir::cast<ttkernel::KernelConfigInterface>(kernelConfig));
 
+          // Kernels are frequently identical across programs (e.g. the same
+          // eltwise op on the same grid), so their sources are pooled by
+          // content and tagged with a hash the runtime keys its program
+          // cache on.
           kernels.push_back(::tt::target::metal::CreateKernelDescDirect(
               fbb, ::tt::target::metal::Kernel::KernelSource,
-              ::tt::target::metal::CreateKernelSourceDirect(
-                  fbb, source.c_str(), kernelConfigType, kernelConfigUnion)
+              ::tt::target::metal::CreateKernelSource(
+                  fbb, fbb.CreateSharedString(source), kernelConfigType,
+                  kernelConfigUnion,
+                  llvm::xxh3_64bits(llvm::arrayRefFromStringRef(source)))
                   .Union(),
               &coreRangeSet, &cbs, &runtime_args_type, &runtime_args,
               nullptr /*TODO debug info*/));
@@ -15,6 +15,7 @@
 #include "ttmlir/Dialect/TTNN/IR/TTNNOpsTypes.h"
 #include "ttmlir/Dialect/TTNN/Transforms/Passes.h"
 #include "ttmlir/Dialect/TTNN/Transforms/TTNNToCpp.h"
+#include "ttmlir/Dialect/TTNN/Types/Types.h"
 #include "ttmlir/Target/Common/Target.h"
 #include "ttmlir/Target/Common/types_generated.h"
 #include "ttmlir/Target/TTNN/Target.h"
@@ -23,15 +24,26 @@
 #include "ttmlir/Target/TTNN/utils.h"
 #include "ttmlir/Target/Utils/FlatbufferObjectCache.h"
 #include "ttmlir/Target/Utils/FuncOpToProgram.h"
+#include "ttmlir/Support/CompileReport.h"
 #include "ttmlir/Target/Utils/MLIRToFlatbuffer.h"
 #include "ttmlir/Version.h"
 
 #include "mlir/Dialect/EmitC/IR/EmitC.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/Threading.h"
 #include "mlir/Support/LogicalResult.h"
+#include "llvm/ADT/APFloat.h"
+#include "llvm/ADT/APSInt.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Twine.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/xxhash.h"
+
+#include <cstring>
+#include <optional>
 
 namespace mlir::tt {
 
@@ -94,12 +106,24 @@ memrefAttrToFlatbuffer(FlatbufferObjectCache &cache, mlir::MemRefType memref,
     size *= dim;
   }
 
-  return ::tt::target::CreateMemoryDescDirect(
-      *cache.fbb, &shape, &tileShape, toFlatbuffer(cache, dtype),
-      toFlatbuffer(
-          cache,
-          mlir::cast<ttnn::BufferTypeAttr>(memref.getMemorySpace()).getValue()),
-      toFlatbuffer(cache, memLayoutAttr), size);
+  ::tt::target::DataType targetDtype = toFlatbuffer(cache, dtype);
+  ::tt::target::MemorySpace memorySpace = toFlatbuffer(
+      cache,
+      mlir::cast<ttnn::BufferTypeAttr>(memref.getMemorySpace()).getValue());
+  ::tt::target::TensorMemoryLayout memoryLayout =
+      toFlatbuffer(cache, memLayoutAttr);
+  FlatbufferInternKey key("MemoryDesc");
+  key.add(llvm::ArrayRef<int32_t>(shape))
+      .add(tileShape)
+      .add(targetDtype)
+      .add(memorySpace)
+      .add(memoryLayout)
+      .add(size);
+  return cache.intern<::tt::target::MemoryDesc>(key, [&] {
+    return ::tt::target::CreateMemoryDescDirect(*cache.fbb, &shape, &tileShape,
+                                                targetDtype, memorySpace,
+                                                memoryLayout, size);
+  });
 }
 
 flatbuffers::Offset<::tt::target::LayoutDesc> ttnnLayoutAttrToFlatbuffer(
@@ -107,10 +131,21 @@ flatbuffers::Offset<::tt::target::LayoutDesc> ttnnLayoutAttrToFlatbuffer(
     mlir::ArrayRef<int64_t> logicalShape, DeviceAttr deviceAttr) {
   auto coreRangeSet =
       toFlatbuffer(cache, layoutAttr.getGrid(), deviceAttr.getWorkerGrid());
-  return ::tt::target::CreateLayoutDescDirect(
-      *cache.fbb, toFlatbuffer(cache, OOBVal::Undef), &coreRangeSet,
-      cache.getOrCreate(layoutAttr.getMemref(), memrefAttrToFlatbuffer,
-                        layoutAttr.getMemLayout()));
+  ::tt::target::OOBVal oobVal = toFlatbuffer(cache, OOBVal::Undef);
+  // The memory desc also depends on the memory layout, so it is interned by
+  // content rather than cached by memref.
+  auto memoryDesc = memrefAttrToFlatbuffer(cache, layoutAttr.getMemref(),
+                                           layoutAttr.getMemLayout());
+  // Layouts that only differ in their linear map (e.g. the same tensor with
+  // and without leading unit dims) serialize to the same table.
+  FlatbufferInternKey key("LayoutDesc");
+  key.add(oobVal)
+      .add(llvm::ArrayRef<::tt::target::Dim2dRange>(coreRangeSet))
+      .add(memoryDesc);
+  return cache.intern<::tt::target::LayoutDesc>(key, [&] {
+    return ::tt::target::CreateLayoutDescDirect(*cache.fbb, oobVal,
+                                                &coreRangeSet, memoryDesc);
+  });
 }
 } // namespace mlir::tt
 
@@ -126,10 +161,14 @@ constexpr uint64_t kHostAllocatedAddress = 0;
 shardSpecToFlatbuffer(FlatbufferObjectCache &cache,
                       ::mlir::tt::ttnn::ShardSpecAttr shardSpec) {
   llvm::ArrayRef<int64_t> shardShapeArr = shardSpec.getShardShape().getShape();
-  std::vector<int64_t> shardShapeVec(shardShapeArr.begin(),
-                                     shardShapeArr.end());
-  auto shardShape = cache.fbb->CreateVector<int64_t>(shardShapeVec);
-  return ::tt::target::CreateShardSpec(*cache.fbb, shardShape);
+  FlatbufferInternKey key("ShardSpec");
+  key.add(shardShapeArr);
+  return cache.intern<::tt::target::ShardSpec>(key, [&] {
+    std::vector<int64_t> shardShapeVec(shardShapeArr.begin(),
+                                       shardShapeArr.end());
+    auto shardShape = cache.fbb->CreateVector<int64_t>(shardShapeVec);
+    return ::tt::target::CreateShardSpec(*cache.fbb, shardShape);
+  });
 }
 
 ::flatbuffers::Offset<::tt::target::MemoryConfigDesc>
@@ -143,10 +182,12 @@ memoryConfigToFlatbuffer(FlatbufferObjectCache &cache,
           memoryConfig.getBufferType().getValue());
   auto shardSpec =
       cache.getOrCreate(memoryConfig.getShardSpec(), shardSpecToFlatbuffer);
-  ::flatbuffers::Offset<::tt::target::MemoryConfigDesc> memoryConfigDesc =
-      ::tt::target::CreateMemoryConfigDesc(*cache.fbb, tensorMemoryLayout,
-                                           bufferType, shardSpec);
-  return memoryConfigDesc;
+  FlatbufferInternKey key("MemoryConfigDesc");
+  key.add(tensorMemoryLayout).add(bufferType).add(shardSpec);
+  return cache.intern<::tt::target::MemoryConfigDesc>(key, [&] {
+    return ::tt::target::CreateMemoryConfigDesc(*cache.fbb, tensorMemoryLayout,
+                                                bufferType, shardSpec);
+  });
 }
 
 ::flatbuffers::Offset<::tt::target::DeviceRef>
@@ -159,10 +200,16 @@ createDeviceRef(FlatbufferObjectCache &cache, Value device) {
 template <typename OpT>
 ::flatbuffers::Offset<::tt::target::ttnn::Operation>
 createOperation(FlatbufferObjectCache &cache, ::flatbuffers::Offset<OpT> op,
-                std::string const &debugString, std::string const &locInfo) {
+                std::string const &debugString, OpLocInfo const &locInfo) {
+  // With compact locations only the ID into the location table is stored.
+  if (locInfo.id) {
+    return CreateOperationDirect(
+        *cache.fbb, ::tt::target::ttnn::OpTypeTraits<OpT>::enum_value,
+        op.Union(), debugString.c_str(), /*loc_info=*/nullptr, *locInfo.id);
+  }
   return CreateOperationDirect(
       *cache.fbb, ::tt::target::ttnn::OpTypeTraits<OpT>::enum_value, op.Union(),
-      debugString.c_str(), locInfo.c_str());
+      debugString.c_str(), locInfo.str.c_str());
 }
 
 ::flatbuffers::Offset<::tt::target::ttnn::GetDeviceOp>
@@ -370,6 +417,184 @@ createOp(FlatbufferObjectCache &cache, FullOp op) {
                         kHostAllocatedSize));
 }
 
+// Raw constant buffers that are serialized into TTNNBinary::tensor_data.
+// Buffers are uniqued by value and layout, so a weight shared by several
+// programs is only stored once.
+struct TensorDataSection {
+  std::vector<::flatbuffers::Offset<::tt::target::ttnn::TensorData>> buffers;
+  llvm::DenseMap<std::pair<Attribute, Attribute>, uint32_t> indices;
+};
+
+// Matches the force_align attribute of TensorData::data in binary.fbs.
+constexpr size_t kTensorDataAlignment = 64;
+
+template <typename T>
+static void appendBytes(std::vector<uint8_t> &data, T value) {
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+  data.insert(data.end(), bytes, bytes + sizeof(T));
+}
+
+// Returns the two's complement bits of `value` rounded toward zero. Negative
+// values are converted as signed so that e.g. an si32 -1 stored in a UInt32
+// buffer keeps its bits instead of clamping to 0.
+static uint64_t toIntegerBits(const APFloat &value, unsigned bitWidth) {
+  APSInt result(bitWidth, /*isUnsigned=*/!value.isNegative());
+  bool isExact = false;
+  value.convertToInteger(result, APFloat::rmTowardZero, &isExact);
+  return result.getZExtValue();
+}
+
+static uint16_t toHalfBits(APFloat value, const llvm::fltSemantics &semantics) {
+  bool losesInfo = false;
+  value.convert(semantics, APFloat::rmNearestTiesToEven, &losesInfo);
+  return static_cast<uint16_t>(value.bitcastToAPInt().getZExtValue());
+}
+
+static void appendElement(std::vector<uint8_t> &data, APFloat value,
+                          ::tt::target::DataType dtype) {
+  bool losesInfo = false;
+  switch (dtype) {
+  case ::tt::target::DataType::Float32:
+    value.convert(APFloat::IEEEsingle(), APFloat::rmNearestTiesToEven,
+                  &losesInfo);
+    return appendBytes(data, value.convertToFloat());
+  case ::tt::target::DataType::BFloat16:
+    return appendBytes(data, toHalfBits(value, APFloat::BFloat()));
+  case ::tt::target::DataType::UInt32:
+    return appendBytes(data, static_cast<uint32_t>(toIntegerBits(value, 32)));
+  case ::tt::target::DataType::UInt16:
+    return appendBytes(data, static_cast<uint16_t>(toIntegerBits(value, 16)));
+  case ::tt::target::DataType::UInt8:
+    return appendBytes(data, static_cast<uint8_t>(toIntegerBits(value, 8)));
+  case ::tt::target::DataType::Int32:
+    return appendBytes(data, static_cast<int32_t>(toIntegerBits(value, 32)));
+  default:
+    llvm_unreachable("unsupported data type for constant tensor data");
+  }
+}
+
+// Serializes `value` in row-major order, converted to `dtype`. Integer
+// elements go through APFloat so that integer constants can be stored in a
+// floating point data type and vice versa.
+static std::vector<uint8_t> toTargetBytes(ElementsAttr value,
+                                          ::tt::target::DataType dtype) {
+  std::vector<uint8_t> data;
+  Type elementType = value.getElementType();
+  if (isa<FloatType>(elementType)) {
+    for (APFloat element : value.getValues<APFloat>()) {
+      appendElement(data, element, dtype);
+    }
+    return data;
+  }
+
+  bool isSigned = !elementType.isUnsignedInteger();
+  for (APInt element : value.getValues<APInt>()) {
+    APFloat floatElement(APFloat::IEEEdouble());
+    floatElement.convertFromAPInt(element, isSigned,
+                                  APFloat::rmNearestTiesToEven);
+    appendElement(data, floatElement, dtype);
+  }
+  return data;
+}
+
+// Reorders row-major `data` into the tiled host layout used by TTNN: each
+// 32x32 tile is stored contiguously as four 16x16 faces, faces and the rows
+// within them in row-major order. Expects the two innermost dims to be tile
+// aligned.
+static std::vector<uint8_t> tilize(const std::vector<uint8_t> &data,
+                                   ArrayRef<int64_t> shape,
+                                   size_t elementSize) {
+  constexpr int64_t kFaceHeight = TILE_HEIGHT / 2;
+  constexpr int64_t kFaceWidth = TILE_WIDTH / 2;
+  int64_t height = shape[shape.size() - 2];
+  int64_t width = shape.back();
+  int64_t batch = ttmlir::utils::volume(shape.drop_back(2));
+
+  std::vector<uint8_t> tiled(data.size());
+  uint8_t *dst = tiled.data();
+  for (int64_t b = 0; b < batch; ++b) {
+    for (int64_t tileRow = 0; tileRow < height; tileRow += TILE_HEIGHT) {
+      for (int64_t tileCol = 0; tileCol < width; tileCol += TILE_WIDTH) {
+        for (int64_t faceRow = 0; faceRow < TILE_HEIGHT;
+             faceRow += kFaceHeight) {
+          for (int64_t faceCol = 0; faceCol < TILE_WIDTH;
+               faceCol += kFaceWidth) {
+            for (int64_t row = 0; row < kFaceHeight; ++row) {
+              int64_t src = (b * height + tileRow + faceRow + row) * width +
+                            tileCol + faceCol;
+              std::memcpy(dst, data.data() + src * elementSize,
+                          kFaceWidth * elementSize);
+              dst += kFaceWidth * elementSize;
+            }
+          }
+        }
+      }
+    }
+  }
+  return tiled;
+}
+
+static uint32_t getOrCreateTensorData(FlatbufferObjectCache &cache,
+                                      TensorDataSection &section,
+                                      ConstantOp op) {
+  auto type = mlir::cast<RankedTensorType>(op.getType());
+  auto layoutAttr = mlir::cast<TTNNLayoutAttr>(type.getEncoding());
+
+  std::pair<Attribute, Attribute> key(op.getValue(), layoutAttr);
+  if (auto it = section.indices.find(key); it != section.indices.end()) {
+    return it->second;
+  }
+
+  ::tt::target::DataType dtype = toFlatbuffer(cache, layoutAttr.getDataType());
+  std::vector<uint8_t> data = toTargetBytes(op.getValue(), dtype);
+
+  // Pre-tilize when the tensor is tiled on device so the runtime can upload
+  // the buffer as is. Unaligned shapes are stored row-major and tilized by the
+  // runtime instead.
+  ::tt::target::TensorLayout layout = ::tt::target::TensorLayout::RowMajor;
+  ArrayRef<int64_t> shape = type.getShape();
+  if (layoutAttr.isTiled() && shape.size() >= 2 &&
+      shape.back() % TILE_WIDTH == 0 &&
+      shape[shape.size() - 2] % TILE_HEIGHT == 0) {
+    data = tilize(data, shape, data.size() / type.getNumElements());
+    layout = ::tt::target::TensorLayout::Tile;
+  }
+
+  auto shapeOffset = cache.fbb->CreateVector<int64_t>(shape);
+  cache.fbb->ForceVectorAlignment(data.size(), sizeof(uint8_t),
+                                  kTensorDataAlignment);
+  auto dataOffset = cache.fbb->CreateVector(data);
+  auto tensorData = ::tt::target::ttnn::CreateTensorData(
+      *cache.fbb, dtype, layout, shapeOffset, dataOffset);
+
+  uint32_t index = section.buffers.size();
+  section.buffers.push_back(tensorData);
+  section.indices.try_emplace(key, index);
+  return index;
+}
+
+::flatbuffers::Offset<::tt::target::ttnn::ConstantOp>
+createOp(FlatbufferObjectCache &cache, TensorDataSection &section,
+         ConstantOp op) {
+  uint32_t dataIndex = getOrCreateTensorData(cache, section, op);
+
+  flatbuffers::Offset<::tt::target::DeviceRef> device =
+      op.getDevice() ? cache.at<::tt::target::DeviceRef>(
+                           getOperandThroughDPSOps(op.getDevice()))
+                     : 0;
+
+  auto memoryConfigDesc = op.getMemoryConfig().has_value()
+                              ? cache.getOrCreate(op.getMemoryConfig().value(),
+                                                  memoryConfigToFlatbuffer)
+                              : 0;
+
+  auto output = cache.getOrCreate(op.getResult(), tensorValueToFlatbuffer,
+                                  kHostAllocatedAddress, kHostAllocatedSize);
+
+  return ::tt::target::ttnn::CreateConstantOp(*cache.fbb, dataIndex, device,
+                                              memoryConfigDesc, output);
+}
+
 ::flatbuffers::Offset<::tt::target::ttnn::ArangeOp>
 createOp(FlatbufferObjectCache &cache, ArangeOp op) {
 
@@ -548,6 +773,17 @@ createOp(FlatbufferObjectCache &cache, ConvTranspose2dOp op) {
       op.getGroups());
 }
 
+static ::tt::target::ttnn::Topology
+toTargetTopology(ttnn::Topology topology) {
+  switch (topology) {
+  case ttnn::Topology::Ring:
+    return ::tt::target::ttnn::Topology::Ring;
+  case ttnn::Topology::Linear:
+    return ::tt::target::ttnn::Topology::Linear;
+  }
+  llvm_unreachable("unhandled CCL topology");
+}
+
 ::flatbuffers::Offset<::tt::target::ttnn::AllGatherOp>
 createOp(FlatbufferObjectCache &cache, AllGatherOp op) {
   auto input =
@@ -557,7 +793,8 @@ createOp(FlatbufferObjectCache &cache, AllGatherOp op) {
   auto device = getOperandThroughDPSOps(op.getDevice());
   return ::tt::target::ttnn::CreateAllGatherOp(
       *cache.fbb, input, output, cache.at<::tt::target::DeviceRef>(device),
-      op.getDim(), op.getNumLinks());
+      op.getDim(), op.getNumLinks(), op.getClusterAxis(),
+      toTargetTopology(op.getTopology()));
 }
 
 ::flatbuffers::Offset<::tt::target::ttnn::ReduceScatterOp>
@@ -570,7 +807,8 @@ createOp(FlatbufferObjectCache &cache, ReduceScatterOp op) {
   return ::tt::target::ttnn::CreateReduceScatterOp(
       *cache.fbb, input, output, cache.at<::tt::target::DeviceRef>(device),
       op.getScatterSplitDim(), static_cast<uint32_t>(op.getMathOp()),
-      op.getNumLinks());
+      op.getNumLinks(), op.getClusterAxis(),
+      toTargetTopology(op.getTopology()));
 }
 
 ::flatbuffers::Offset<::tt::target::ttnn::MeshShardOp>
@@ -704,6 +942,70 @@ createOp(FlatbufferObjectCache &cache, FillCacheOp op) {
                                                op.getBatchOffset());
 }
 
+::flatbuffers::Offset<::tt::target::ttnn::PagedUpdateCacheOp>
+createOp(FlatbufferObjectCache &cache, PagedUpdateCacheOp op) {
+  auto cacheOperand =
+      cache.at<::tt::target::TensorRef>(getOperandThroughDPSOps(op.getCache()));
+  auto input =
+      cache.at<::tt::target::TensorRef>(getOperandThroughDPSOps(op.getInput()));
+  auto updateIndex = cache.at<::tt::target::TensorRef>(
+      getOperandThroughDPSOps(op.getUpdateIndex()));
+  auto pageTable = cache.at<::tt::target::TensorRef>(
+      getOperandThroughDPSOps(op.getPageTable()));
+
+  return ::tt::target::ttnn::CreatePagedUpdateCacheOp(
+      *cache.fbb, cacheOperand, input, updateIndex, pageTable);
+}
+
+static ::flatbuffers::Optional<float> toFlatbufferScale(FloatAttr scale) {
+  return scale ? ::flatbuffers::Optional<float>(
+                     scale.getValue().convertToFloat())
+               : ::flatbuffers::nullopt;
+}
+
+::flatbuffers::Offset<::tt::target::ttnn::ScaledDotProductAttentionOp>
+createOp(FlatbufferObjectCache &cache, ScaledDotProductAttentionOp op) {
+  auto query =
+      cache.at<::tt::target::TensorRef>(getOperandThroughDPSOps(op.getQuery()));
+  auto key =
+      cache.at<::tt::target::TensorRef>(getOperandThroughDPSOps(op.getKey()));
+  auto value =
+      cache.at<::tt::target::TensorRef>(getOperandThroughDPSOps(op.getValue()));
+  auto attentionMask =
+      op.getODSOperands(3).empty()
+          ? flatbuffers::Offset<::tt::target::TensorRef>()
+          : cache.at<::tt::target::TensorRef>(
+                getOperandThroughDPSOps(op.getAttentionMask()));
+  auto out = cache.getOrCreate(op.getResult(), tensorValueToFlatbuffer,
+                               kHostAllocatedAddress, kHostAllocatedSize);
+
+  return ::tt::target::ttnn::CreateScaledDotProductAttentionOp(
+      *cache.fbb, query, key, value, attentionMask, out, op.getIsCausal(),
+      toFlatbufferScale(op.getScaleAttr()));
+}
+
+::flatbuffers::Offset<
+    ::tt::target::ttnn::PagedScaledDotProductAttentionDecodeOp>
+createOp(FlatbufferObjectCache &cache,
+         PagedScaledDotProductAttentionDecodeOp op) {
+  auto query =
+      cache.at<::tt::target::TensorRef>(getOperandThroughDPSOps(op.getQuery()));
+  auto keyCache = cache.at<::tt::target::TensorRef>(
+      getOperandThroughDPSOps(op.getKeyCache()));
+  auto valueCache = cache.at<::tt::target::TensorRef>(
+      getOperandThroughDPSOps(op.getValueCache()));
+  auto pageTable = cache.at<::tt::target::TensorRef>(
+      getOperandThroughDPSOps(op.getPageTable()));
+  auto curPos = cache.at<::tt::target::TensorRef>(
+      getOperandThroughDPSOps(op.getCurPos()));
+  auto out = cache.getOrCreate(op.getResult(), tensorValueToFlatbuffer,
+                               kHostAllocatedAddress, kHostAllocatedSize);
+
+  return ::tt::target::ttnn::CreatePagedScaledDotProductAttentionDecodeOp(
+      *cache.fbb, query, keyCache, valueCache, pageTable, curPos, out,
+      toFlatbufferScale(op.getScaleAttr()));
+}
+
 template <typename EltwiseOp>
 ::flatbuffers::Offset<::tt::target::ttnn::EltwiseOp>
 createNonDPSEltwiseOp(FlatbufferObjectCache &cache, EltwiseOp op) {
@@ -1082,8 +1384,9 @@ createDeallocateOp(FlatbufferObjectCache &cache, DeallocateOp op) {
 }
 
 ::flatbuffers::Offset<::tt::target::ttnn::Operation>
-emitTTNNOperation(FlatbufferObjectCache &cache, Operation *op,
-                  std::string const &debugString, std::string const &locInfo) {
+emitTTNNOperation(FlatbufferObjectCache &cache, TensorDataSection &section,
+                  Operation *op, std::string const &debugString,
+                  OpLocInfo const &locInfo) {
   if (auto getDeviceOp = dyn_cast<GetDeviceOp>(op); getDeviceOp) {
     return createOperation(cache, createOp(cache, getDeviceOp), debugString,
                            locInfo);
@@ -1121,6 +1424,10 @@ emitTTNNOperation(FlatbufferObjectCache &cache, Operation *op,
     return createOperation(cache, createOp(cache, fullOp), debugString,
                            locInfo);
   }
+  if (auto constantOp = dyn_cast<ConstantOp>(op); constantOp) {
+    return createOperation(cache, createOp(cache, section, constantOp),
+                           debugString, locInfo);
+  }
   if (auto arangeOp = dyn_cast<ArangeOp>(op); arangeOp) {
     return createOperation(cache, createOp(cache, arangeOp), debugString,
                            locInfo);
@@ -1434,6 +1741,20 @@ emitTTNNOperation(FlatbufferObjectCache &cache, Operation *op,
     return createOperation(cache, createOp(cache, fillCacheOp), debugString,
                            locInfo);
   }
+  if (auto pagedUpdateCacheOp = dyn_cast<PagedUpdateCacheOp>(op);
+      pagedUpdateCacheOp) {
+    return createOperation(cache, createOp(cache, pagedUpdateCacheOp),
+                           debugString, locInfo);
+  }
+  if (auto sdpaOp = dyn_cast<ScaledDotProductAttentionOp>(op); sdpaOp) {
+    return createOperation(cache, createOp(cache, sdpaOp), debugString,
+                           locInfo);
+  }
+  if (auto sdpaDecodeOp = dyn_cast<PagedScaledDotProductAttentionDecodeOp>(op);
+      sdpaDecodeOp) {
+    return createOperation(cache, createOp(cache, sdpaDecodeOp), debugString,
+                           locInfo);
+  }
   if (auto permuteOp = dyn_cast<PermuteOp>(op); permuteOp) {
     return createOperation(cache, createOp(cache, permuteOp), debugString,
                            locInfo);
@@ -1446,24 +1767,108 @@ emitTTNNOperation(FlatbufferObjectCache &cache, Operation *op,
   llvm_unreachable("unhandled op in emitTTNNOperation");
 }
 
-std::shared_ptr<void> ttnnToFlatbuffer(
-    Operation *op,
-    const std::unordered_map<std::string, GoldenTensor> &goldenMap,
-    const std::vector<std::pair<std::string, std::string>> &moduleCache) {
-  ModuleOp module = dyn_cast<ModuleOp>(op);
-  assert(module && "Expected ModuleOp as top level operation");
+// Returns the only op using `value` other than deallocations of it, or
+// nullptr if there is none or more than one.
+static Operation *getOnlyConsumer(Value value) {
+  Operation *consumer = nullptr;
+  for (Operation *user : value.getUsers()) {
+    if (isa<DeallocateOp>(user) || user == consumer) {
+      continue;
+    }
+    if (consumer) {
+      return nullptr;
+    }
+    consumer = user;
+  }
+  return consumer;
+}
 
-  ::flatbuffers::FlatBufferBuilder fbb;
-  FlatbufferObjectCache cache(&fbb);
+// Programs get their inputs in the host layout of the function arguments and
+// convert them (to device, tilize, typecast, ...) for the ops that use them.
+// The contract of an input is the value at the end of that chain of
+// conversions, which callers can produce once and pass in directly, along
+// with the ops that are skipped when they do. The results of the chain are
+// not deallocated by the program then, as the caller owns the last one.
+static ::flatbuffers::Offset<::tt::target::ttnn::InputContract>
+createInputContract(FlatbufferObjectCache &cache, BlockArgument input,
+                    const llvm::DenseMap<Operation *, uint32_t> &opIndices) {
+  std::vector<uint32_t> skippedOps;
+  llvm::SmallVector<Value> converted;
+  Value value = input;
+  while (Operation *consumer = getOnlyConsumer(value)) {
+    if (!isa<ToDeviceOp, ToLayoutOp, TypecastOp, ToDTypeOp, ToMemoryConfigOp>(
+            consumer) ||
+        consumer->getOperand(0) != value) {
+      break;
+    }
+    skippedOps.push_back(opIndices.at(consumer));
+    value = consumer->getResult(0);
+    converted.push_back(value);
+  }
+  for (Value result : converted) {
+    for (Operation *user : result.getUsers()) {
+      if (isa<DeallocateOp>(user)) {
+        skippedOps.push_back(opIndices.at(user));
+      }
+    }
+  }
+  llvm::sort(skippedOps);
+
+  return ::tt::target::ttnn::CreateInputContractDirect(
+      *cache.fbb, cache.at<::tt::target::TensorRef>(value), &skippedOps);
+}
 
-  ::ttmlir::Version ttmlirVersion = ::ttmlir::getVersion();
-  ::tt::target::Version binaryVersion(ttmlirVersion.major, ttmlirVersion.minor,
-                                      ttmlirVersion.patch);
+static std::vector<::flatbuffers::Offset<::tt::target::ttnn::InputContract>>
+createInputContracts(FlatbufferObjectCache &cache, func::FuncOp entry) {
+  llvm::DenseMap<Operation *, uint32_t> opIndices;
+  forEachProgramOp(entry, [&](Operation *op) {
+    opIndices.try_emplace(op, opIndices.size());
+  });
 
-  auto systemDesc =
-      toFlatbuffer(cache, mlir::cast<tt::SystemDescAttr>(
-                              module->getAttr(tt::SystemDescAttr::name)));
+  std::vector<::flatbuffers::Offset<::tt::target::ttnn::InputContract>>
+      contracts;
+  for (BlockArgument input : entry.getBody().getArguments()) {
+    contracts.push_back(createInputContract(cache, input, opIndices));
+  }
+  return contracts;
+}
 
+static std::vector<::flatbuffers::Offset<::tt::target::ttnn::BucketDims>>
+createBucketDims(::flatbuffers::FlatBufferBuilder &fbb, ArrayAttr dimsAttr) {
+  std::vector<::flatbuffers::Offset<::tt::target::ttnn::BucketDims>> result;
+  for (Attribute attr : dimsAttr) {
+    std::vector<uint32_t> dims;
+    for (int64_t dim : mlir::cast<DenseI64ArrayAttr>(attr).asArrayRef()) {
+      dims.push_back(static_cast<uint32_t>(dim));
+    }
+    result.push_back(::tt::target::ttnn::CreateBucketDimsDirect(fbb, &dims));
+  }
+  return result;
+}
+
+// Returns the shape bucket `entry` was specialized for, or a null offset if
+// it has none.
+static ::flatbuffers::Offset<::tt::target::ttnn::ShapeBucket>
+createShapeBucket(::flatbuffers::FlatBufferBuilder &fbb, func::FuncOp entry) {
+  auto bucket = entry->getAttrOfType<ShapeBucketAttr>(ShapeBucketAttr::name);
+  if (!bucket) {
+    return 0;
+  }
+  auto inputDims = createBucketDims(fbb, bucket.getInputDims());
+  auto outputDims = createBucketDims(fbb, bucket.getOutputDims());
+  std::vector<float> padValues(bucket.getPadValues().asArrayRef().begin(),
+                               bucket.getPadValues().asArrayRef().end());
+  return ::tt::target::ttnn::CreateShapeBucketDirect(
+      fbb, bucket.getGroup().getValue().str().c_str(),
+      static_cast<uint32_t>(bucket.getSize()), &inputDims, &outputDims,
+      &padValues);
+}
+
+static ::flatbuffers::Offset<::tt::target::DebugInfo> createDebugInfo(
+    ::flatbuffers::FlatBufferBuilder &fbb, ModuleOp module,
+    const std::unordered_map<std::string, GoldenTensor> &goldenMap,
+    const std::vector<std::pair<std::string, std::string>> &moduleCache,
+    const LocationTable *locationTable) {
   auto mlir = toDebugInfo(fbb, "ttnn", module);
   std::string cpp;
   llvm::raw_string_ostream os(cpp);
@@ -1494,44 +1899,184 @@ std::shared_ptr<void> ttnnToFlatbuffer(
     moduleCacheList.push_back(moduleCacheItem);
   }
 
+  // golden_map is keyed, the Direct builder sorts it so that the runtime can
+  // binary search by location.
   auto goldenInfo = ::tt::target::CreateGoldenInfoDirect(fbb, &goldenKVList);
-  auto debugInfo = ::tt::target::CreateDebugInfoDirect(
-      fbb, mlir, cpp.c_str(), &moduleCacheList, goldenInfo);
+
+  // Ops of binaries built with compact locations refer to these by ID.
+  std::vector<::flatbuffers::Offset<::flatbuffers::String>> locationList;
+  if (locationTable) {
+    locationList.reserve(locationTable->getLocations().size());
+    for (const std::string &location : locationTable->getLocations()) {
+      locationList.push_back(fbb.CreateString(location));
+    }
+  }
+
+  return ::tt::target::CreateDebugInfoDirect(
+      fbb, mlir, cpp.c_str(), &moduleCacheList, goldenInfo,
+      locationTable ? &locationList : nullptr);
+}
+
+static std::shared_ptr<void>
+copyFinishedBuffer(::flatbuffers::FlatBufferBuilder &fbb) {
+  uint8_t *buf = fbb.GetBufferPointer();
+  std::size_t size = fbb.GetSize();
+
+  std::shared_ptr<void> bufferPtr =
+      std::shared_ptr<void>(std::malloc(size), std::free);
+  std::memcpy(bufferPtr.get(), buf, size);
+  return bufferPtr;
+}
+
+// Serializes the debug info into a standalone TTNNDebugInfo buffer and
+// returns the hash that links it to the stripped binary.
+static uint64_t createDebugInfoSidecar(
+    ModuleOp module,
+    const std::unordered_map<std::string, GoldenTensor> &goldenMap,
+    const std::vector<std::pair<std::string, std::string>> &moduleCache,
+    const LocationTable *locationTable,
+    const ::tt::target::Version &binaryVersion,
+    std::shared_ptr<void> &debugInfoSidecar) {
+  ::flatbuffers::FlatBufferBuilder fbb;
+  auto debugInfo =
+      createDebugInfo(fbb, module, goldenMap, moduleCache, locationTable);
+
+  // Everything serialized so far belongs to the debug info, so hash the
+  // builder contents before the root table is added.
+  uint64_t contentHash = llvm::xxh3_64bits(
+      llvm::ArrayRef<uint8_t>(fbb.GetCurrentBufferPointer(), fbb.GetSize()));
+  // Zero means "not split" in TTNNBinary::debug_info_hash.
+  contentHash = contentHash ? contentHash : 1;
+
+  auto root = ::tt::target::ttnn::CreateTTNNDebugInfoDirect(
+      fbb, &binaryVersion, ::ttmlir::getGitHash(), contentHash, debugInfo);
+  ::tt::target::ttnn::FinishSizePrefixedTTNNDebugInfoBuffer(fbb, root);
+  ::flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  ::tt::target::ttnn::VerifySizePrefixedTTNNDebugInfoBuffer(verifier);
+  compile_report::addCounter("flatbuffer.bytes.debug-info-sidecar",
+                             fbb.GetSize());
+
+  debugInfoSidecar = copyFinishedBuffer(fbb);
+  return contentHash;
+}
+
+std::shared_ptr<void> ttnnToFlatbuffer(
+    Operation *op,
+    const std::unordered_map<std::string, GoldenTensor> &goldenMap,
+    const std::vector<std::pair<std::string, std::string>> &moduleCache,
+    std::shared_ptr<void> *debugInfoSidecar, bool compactLocations,
+    bool internDescs) {
+  ModuleOp module = dyn_cast<ModuleOp>(op);
+  assert(module && "Expected ModuleOp as top level operation");
+
+  ::flatbuffers::FlatBufferBuilder fbb;
+  FlatbufferObjectCache cache(&fbb);
+  cache.internEnabled = internDescs;
+
+  ::ttmlir::Version ttmlirVersion = ::ttmlir::getVersion();
+  ::tt::target::Version binaryVersion(ttmlirVersion.major, ttmlirVersion.minor,
+                                      ttmlirVersion.patch);
+
+  // The builder grows backwards, so its size after each section is the size
+  // of everything serialized so far.
+  size_t sectionStart = fbb.GetSize();
+  auto countSectionBytes = [&fbb, &sectionStart](llvm::StringRef section) {
+    compile_report::addCounter(
+        (llvm::Twine("flatbuffer.bytes.") + section).str(),
+        fbb.GetSize() - sectionStart);
+    sectionStart = fbb.GetSize();
+  };
+
+  auto systemDesc =
+      toFlatbuffer(cache, mlir::cast<tt::SystemDescAttr>(
+                              module->getAttr(tt::SystemDescAttr::name)));
+  countSectionBytes("system-desc");
+
+  std::optional<LocationTable> locationTable;
+  if (compactLocations) {
+    locationTable.emplace(module);
+  }
+  const LocationTable *locations = locationTable ? &*locationTable : nullptr;
+
+  // Production binaries leave the debug info to the sidecar and only keep
+  // the hash linking the two.
+  ::flatbuffers::Offset<::tt::target::DebugInfo> debugInfo = 0;
+  uint64_t debugInfoHash = 0;
+  if (debugInfoSidecar) {
+    debugInfoHash =
+        createDebugInfoSidecar(module, goldenMap, moduleCache, locations,
+                               binaryVersion, *debugInfoSidecar);
+  } else {
+    debugInfo = createDebugInfo(fbb, module, goldenMap, moduleCache, locations);
+    countSectionBytes("debug-info");
+  }
+
+  TensorDataSection tensorData;
+  auto emitOperation = [&tensorData](FlatbufferObjectCache &cache,
+                                     Operation *op,
+                                     std::string const &debugString,
+                                     OpLocInfo const &locInfo) {
+    return emitTTNNOperation(cache, tensorData, op, debugString, locInfo);
+  };
+
+  llvm::SmallVector<func::FuncOp> funcOps;
+  module->walk([&](func::FuncOp func) { funcOps.push_back(func); });
+
+  // Printing ops dominates the serialization of large modules. Functions are
+  // printed in parallel up front, while the programs are serialized in order
+  // as they share the builder and the object cache.
+  std::vector<ProgramDebugStrings> debugStrings(funcOps.size());
+  mlir::parallelFor(module.getContext(), 0, funcOps.size(), [&](size_t i) {
+    debugStrings[i] = getProgramDebugStrings(funcOps[i], locations);
+  });
 
   std::vector<::flatbuffers::Offset<::tt::target::ttnn::Program>> programs;
-  module->walk([&](func::FuncOp func) {
+  for (size_t i = 0; i < funcOps.size(); ++i) {
     Program<::tt::target::ttnn::Operation> program =
-        funcOpToProgram<::tt::target::ttnn::Operation>(cache, func,
-                                                       emitTTNNOperation);
+        funcOpToProgram<::tt::target::ttnn::Operation>(
+            cache, funcOps[i], emitOperation, &debugStrings[i]);
+    // Contracts refer to the tensors created while serializing the ops.
+    auto inputContracts = createInputContracts(cache, funcOps[i]);
+    auto bucket = createShapeBucket(fbb, funcOps[i]);
     programs.push_back(::tt::target::ttnn::CreateProgramDirect(
         fbb, program.name, &program.inputs, &program.outputs, &program.ops,
-        debugInfo));
-  });
+        debugInfo, &inputContracts, bucket));
+  }
+  // Constant tensors are serialized along with the ops that use them.
+  countSectionBytes("programs");
 
   auto binary = ::tt::target::ttnn::CreateTTNNBinaryDirect(
-      fbb, &binaryVersion, ::ttmlir::getGitHash(), systemDesc, &programs);
+      fbb, &binaryVersion, ::ttmlir::getGitHash(), systemDesc, &programs,
+      &tensorData.buffers, debugInfoHash);
 
   ::tt::target::ttnn::FinishSizePrefixedTTNNBinaryBuffer(fbb, binary);
   ::flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
   ::tt::target::ttnn::VerifySizePrefixedTTNNBinaryBuffer(verifier);
+  countSectionBytes("root");
+  compile_report::addCounter("flatbuffer.bytes.total", fbb.GetSize());
 
-  uint8_t *buf = fbb.GetBufferPointer();
-  std::size_t size = fbb.GetSize();
-
-  std::shared_ptr<void> bufferPtr =
-      std::shared_ptr<void>(std::malloc(size), std::free);
-  std::memcpy(bufferPtr.get(), buf, size);
-  return bufferPtr;
+  return copyFinishedBuffer(fbb);
 }
 
 LogicalResult translateTTNNToFlatbuffer(
     Operation *op, llvm::raw_ostream &os,
     const std::unordered_map<std::string, GoldenTensor> &goldenMap,
-    const std::vector<std::pair<std::string, std::string>> &moduleCache) {
-  std::shared_ptr<void> data = ttnnToFlatbuffer(op, goldenMap, moduleCache);
+    const std::vector<std::pair<std::string, std::string>> &moduleCache,
+    llvm::raw_ostream *debugInfoOs, bool compactLocations, bool internDescs) {
+  std::shared_ptr<void> debugInfo;
+  std::shared_ptr<void> data = ttnnToFlatbuffer(
+      op, goldenMap, moduleCache, debugInfoOs ? &debugInfo : nullptr,
+      compactLocations, internDescs);
   std::size_t size = ::flatbuffers::GetSizePrefixedBufferLength(
       static_cast<const uint8_t *>(data.get()));
   os.write(reinterpret_cast<char const *>(data.get()), size);
+
+  if (debugInfoOs) {
+    std::size_t debugInfoSize = ::flatbuffers::GetSizePrefixedBufferLength(
+        static_cast<const uint8_t *>(debugInfo.get()));
+    debugInfoOs->write(reinterpret_cast<char const *>(debugInfo.get()),
+                       debugInfoSize);
+  }
   return success();
 }
 } // namespace mlir::tt::ttnn
@@ -5,6 +5,9 @@
 #include "mlir/Dialect/EmitC/IR/EmitC.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Tools/mlir-translate/Translation.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/raw_ostream.h"
 
 #include "ttmlir/Dialect/TT/IR/TT.h"
 #include "ttmlir/Dialect/TTKernel/IR/TTKernel.h"
@@ -15,11 +18,52 @@ using namespace mlir;
 
 namespace mlir::tt::ttnn {
 
+// When set, debug info is written to this file instead of being embedded in
+// the binary.
+static llvm::cl::opt<std::string>
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    debugInfoPath("ttnn-debug-info-file",
+                  llvm::cl::desc("Write debug info and goldens to a sidecar "
+                                 "file and strip them from the binary"),
+                  llvm::cl::init(""));
+
+// When set, ops refer to their location by ID into a table in the debug info
+// instead of storing the printed location.
+static llvm::cl::opt<bool>
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    compactLocations("ttnn-compact-locations",
+                     llvm::cl::desc("Store op locations as IDs into a "
+                                    "location table in the debug info"),
+                     llvm::cl::init(false));
+
+// When set, each distinct tensor, layout and memory desc is serialized once
+// and shared by all tensors that use it.
+static llvm::cl::opt<bool>
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    internDescs("ttnn-intern-descs",
+                llvm::cl::desc("Serialize each distinct tensor and memory "
+                               "desc only once"),
+                llvm::cl::init(true));
+
 void registerTTNNToFlatbuffer() {
   TranslateFromMLIRRegistration reg(
       "ttnn-to-flatbuffer", "translate ttnn to flatbuffer",
       [](Operation *op, llvm::raw_ostream &os) -> LogicalResult {
-        return translateTTNNToFlatbuffer(op, os, {}, {});
+        if (debugInfoPath.empty()) {
+          return translateTTNNToFlatbuffer(op, os, {}, {}, nullptr,
+                                           compactLocations, internDescs);
+        }
+
+        std::error_code fileError;
+        llvm::raw_fd_ostream debugInfoOs(debugInfoPath, fileError,
+                                         llvm::sys::fs::OF_None);
+        if (fileError) {
+          return op->emitError() << "Failed to open debug info file: "
+                                 << debugInfoPath << ". Error: "
+                                 << fileError.message();
+        }
+        return translateTTNNToFlatbuffer(op, os, {}, {}, &debugInfoOs,
+                                         compactLocations, internDescs);
       },
       [](DialectRegistry &registry) {
         // clang-format off
@@ -178,7 +178,8 @@ void populatePassesModule(py::module &m) {
          const std::unordered_map<std::string, mlir::tt::GoldenTensor>
              &goldenMap = {},
          const std::vector<std::pair<std::string, std::string>> &moduleCache =
-             {}) {
+             {},
+         const std::string &debugInfoPath = "", bool compactLocations = false) {
         mlir::Operation *moduleOp = unwrap(mlirModuleGetOperation(module));
 
         std::error_code fileError;
@@ -189,15 +190,27 @@ void populatePassesModule(py::module &m) {
                                    ". Error: " + fileError.message());
         }
 
+        std::unique_ptr<llvm::raw_fd_ostream> debugInfoFile;
+        if (!debugInfoPath.empty()) {
+          debugInfoFile =
+              std::make_unique<llvm::raw_fd_ostream>(debugInfoPath, fileError);
+          if (fileError) {
+            throw std::runtime_error("Failed to open file: " + debugInfoPath +
+                                     ". Error: " + fileError.message());
+          }
+        }
+
         if (mlir::failed(mlir::tt::ttnn::translateTTNNToFlatbuffer(
-                moduleOp, file, goldenMap, moduleCache))) {
+                moduleOp, file, goldenMap, moduleCache, debugInfoFile.get(),
+                compactLocations))) {
           throw std::runtime_error("Failed to write flatbuffer to file: " +
                                    filepath);
         }
       },
       py::arg("module"), py::arg("filepath"), py::arg("goldenMap") = py::dict(),
       py::arg("moduleCache") =
-          std::vector<std::pair<std::string, std::string>>());
+          std::vector<std::pair<std::string, std::string>>(),
+      py::arg("debugInfoPath") = "", py::arg("compactLocations") = false);
 
   m.def("ttmetal_to_flatbuffer_file",
         [](MlirModule module, std::string &filepath,
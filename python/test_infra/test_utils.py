@@ -58,6 +58,10 @@ def compile_as_mlir_module(
     module_dump: bool
         Set to True to print out generated MLIR module.
 
+    compact_locations: bool
+        Set to True to store op locations in a table of the debug info of the
+        TTNN flatbuffer, ops only refer to them by ID.
+
     golden_dump: bool
         Set to True to dump golden info to flatbuffer file.
 
@@ -231,7 +235,11 @@ def ttir_to_ttmetal(
 
 
 def ttnn_to_flatbuffer(
-    module, builder, output_file_name: str = "ttnn_fb.ttnn", module_log=None
+    module,
+    builder,
+    output_file_name: str = "ttnn_fb.ttnn",
+    module_log=None,
+    compact_locations: bool = False,
 ):
     """
     Converts TTNN module to flatbuffer and saves to file. Wrapper around
@@ -241,10 +249,19 @@ def ttnn_to_flatbuffer(
     # Convert to flatbuffer file.
     if module_log:
         ttnn_to_flatbuffer_file(
-            module, output_file_name, builder.get_golden_map(), module_log
+            module,
+            output_file_name,
+            builder.get_golden_map(),
+            module_log,
+            compactLocations=compact_locations,
         )
     else:
-        ttnn_to_flatbuffer_file(module, output_file_name, builder.get_golden_map())
+        ttnn_to_flatbuffer_file(
+            module,
+            output_file_name,
+            builder.get_golden_map(),
+            compactLocations=compact_locations,
+        )
 
     print("`ttnn_to_flatbuffer_file` passed successfully.")
 
@@ -274,6 +291,7 @@ def compile_to_flatbuffer(
     test_name: Optional[str] = None,
     targets: List[str] = ["ttmetal", "ttnn"],
     module_dump: bool = False,
+    compact_locations: bool = False,
 ):
     """
     Decorator to run an e2e Python -> Flatbuffer test using the decorated
@@ -308,6 +326,10 @@ def compile_to_flatbuffer(
     module_dump: bool
         Set to True to print out generated MLIR module.
 
+    compact_locations: bool
+        Set to True to store op locations in a table of the debug info of the
+        TTNN flatbuffer, ops only refer to them by ID.
+
     Example
     -------
 
@@ -349,7 +371,11 @@ def compile_to_flatbuffer(
                 module_logger.attach_context(module.context)
                 module = ttir_to_ttnn(module, builder, test_base + ".mlir")
                 ttnn_to_flatbuffer(
-                    module, builder, test_base + ".ttnn", module_logger.module_log
+                    module,
+                    builder,
+                    test_base + ".ttnn",
+                    module_logger.module_log,
+                    compact_locations,
                 )
 
         return wrapper
@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TT_RUNTIME_DETAIL_PROGRAM_CACHE_H
+#define TT_RUNTIME_DETAIL_PROGRAM_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string_view>
+#include <vector>
+
+#include "ttmlir/Target/TTMetal/Target.h"
+
+namespace tt::runtime::ttmetal {
+
+// Everything a built program depends on, flattened: per kernel the source
+// hash, kernel config, core ranges, CB descriptors and runtime arg kinds.
+// Tensor addresses are deliberately not part of the key, they are patched
+// into a cached program on every enqueue.
+using ProgramCacheKey = std::vector<std::uint64_t>;
+
+inline std::uint64_t
+getKernelSourceHash(::tt::target::metal::KernelSource const *kernelSource) {
+  if (kernelSource->source_hash()) {
+    return kernelSource->source_hash();
+  }
+  // Binaries produced before sources were hashed by the compiler.
+  return std::hash<std::string_view>{}(kernelSource->source()->string_view());
+}
+
+inline void
+appendKernelConfig(ProgramCacheKey &key,
+                   ::tt::target::metal::KernelSource const *kernelSource) {
+  key.push_back(static_cast<std::uint64_t>(kernelSource->config_type()));
+  switch (kernelSource->config_type()) {
+  case ::tt::target::metal::KernelConfig::NocConfig: {
+    auto const *config = kernelSource->config_as_NocConfig();
+    key.push_back(static_cast<std::uint64_t>(config->noc_index()));
+    break;
+  }
+  case ::tt::target::metal::KernelConfig::EthernetConfig: {
+    auto const *config = kernelSource->config_as_EthernetConfig();
+    key.push_back(static_cast<std::uint64_t>(config->eth_type()));
+    key.push_back(static_cast<std::uint64_t>(config->noc_index()));
+    break;
+  }
+  case ::tt::target::metal::KernelConfig::TensixConfig: {
+    auto const *config = kernelSource->config_as_TensixConfig();
+    key.push_back(static_cast<std::uint64_t>(config->math_fidelity()));
+    key.push_back(config->fp32_dest_acc_en());
+    key.push_back(config->math_approx_mode());
+    auto const *unpackToDestModes = config->unpack_to_dest_mode();
+    key.push_back(unpackToDestModes ? unpackToDestModes->size() : 0);
+    if (unpackToDestModes) {
+      for (auto mode : *unpackToDestModes) {
+        key.push_back(static_cast<std::uint64_t>(mode));
+      }
+    }
+    break;
+  }
+  case ::tt::target::metal::KernelConfig::NONE: {
+    break;
+  }
+  }
+}
+
+inline ProgramCacheKey
+makeProgramCacheKey(::tt::target::metal::ProgramDesc const *program) {
+  ProgramCacheKey key;
+  key.push_back(program->kernels()->size());
+  for (::tt::target::metal::KernelDesc const *kernelDesc :
+       *program->kernels()) {
+    ::tt::target::metal::KernelSource const *kernelSource =
+        kernelDesc->kernel_as_KernelSource();
+    key.push_back(getKernelSourceHash(kernelSource));
+    appendKernelConfig(key, kernelSource);
+
+    key.push_back(kernelDesc->core_range_set()->size());
+    for (::tt::target::Dim2dRange const *range :
+         *kernelDesc->core_range_set()) {
+      key.push_back(range->loc().y());
+      key.push_back(range->loc().x());
+      key.push_back(range->size().y());
+      key.push_back(range->size().x());
+    }
+
+    auto const *cbs = kernelDesc->cbs();
+    key.push_back(cbs ? cbs->size() : 0);
+    if (cbs) {
+      for (::tt::target::CBRef const *cbRef : *cbs) {
+        ::tt::target::CBDesc const *desc = cbRef->desc();
+        key.push_back(desc->port());
+        key.push_back(desc->page_size());
+        key.push_back(desc->num_buffers());
+        key.push_back(desc->memory_desc()->size());
+        key.push_back(static_cast<std::uint64_t>(
+            desc->memory_desc()->data_type()));
+        // Locally allocated CBs are placed at a fixed address, globally
+        // allocated ones follow their tensor.
+        key.push_back(cbRef->tensor_ref() ? 0 : cbRef->address() + 1);
+      }
+    }
+
+    auto const *runtimeArgTypes = kernelDesc->runtime_args_type();
+    auto const *runtimeArgs = kernelDesc->runtime_args();
+    std::size_t numRuntimeArgs = runtimeArgTypes ? runtimeArgTypes->size() : 0;
+    key.push_back(numRuntimeArgs);
+    for (std::size_t i = 0; i < numRuntimeArgs; ++i) {
+      key.push_back(static_cast<std::uint64_t>(runtimeArgTypes->Get(i)));
+      if (runtimeArgTypes->Get(i) ==
+          ::tt::target::metal::RuntimeArg::RuntimeArgSemaphoreAddress) {
+        // Semaphores are created together with the program.
+        auto const *semaphore = static_cast<
+            ::tt::target::metal::RuntimeArgSemaphoreAddress const *>(
+            runtimeArgs->Get(i));
+        key.push_back(semaphore->initial_value());
+        key.push_back(static_cast<std::uint64_t>(semaphore->core_type()));
+      }
+    }
+  }
+  return key;
+}
+
+// Cache of built programs, so that a program enqueued over and over (e.g. in a
+// loop or across submits) has its kernels written out and compiled once. The
+// program type and the way it is built are left to the user, which keeps the
+// caching logic independent of tt-metal.
+template <typename ProgramT>
+class ProgramCache {
+public:
+  using Builder = std::function<ProgramT()>;
+
+  // Returns the program cached for `key`, building it with `build` if it is
+  // not cached yet. The reference is stable until the cache is cleared.
+  ProgramT &getOrBuild(ProgramCacheKey const &key, Builder const &build) {
+    auto it = programs.find(key);
+    if (it != programs.end()) {
+      ++numHits;
+      return it->second;
+    }
+    ++numMisses;
+    return programs.emplace(key, build()).first->second;
+  }
+
+  bool contains(ProgramCacheKey const &key) const {
+    return programs.count(key) != 0;
+  }
+
+  void clear() { programs.clear(); }
+
+  std::size_t size() const { return programs.size(); }
+  std::size_t hits() const { return numHits; }
+  std::size_t misses() const { return numMisses; }
+
+private:
+  std::map<ProgramCacheKey, ProgramT> programs;
+  std::size_t numHits = 0;
+  std::size_t numMisses = 0;
+};
+
+} // namespace tt::runtime::ttmetal
+
+#endif
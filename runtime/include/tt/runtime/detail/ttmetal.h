@@ -63,7 +63,7 @@ Event submit(Device deviceHandle, Binary executableHandle,
 
 std::string getOpDebugString(OpContext opContextHandle);
 
-std::string getOpLocInfo(OpContext opContextHandle);
+std::string getOpLocInfo(Binary executableHandle, OpContext opContextHandle);
 
 Tensor getOpOutputTensor(OpContext opContextHandle,
                          CallbackContext programContextHandle);
@@ -83,6 +83,9 @@ executeCommandQueue(::tt::tt_metal::IDevice *device,
                     std::size_t cq_id, std::vector<InputBuffer> const &inputs,
                     std::vector<OutputBuffer> const &outputs);
 
+// Drops the programs cached for `device` by executeCommandQueue.
+void clearProgramCache(::tt::tt_metal::IDevice *device);
+
 // Utils
 
 inline CoreRangeSet toCoreRangeSet(
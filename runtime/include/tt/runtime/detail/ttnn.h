@@ -28,6 +28,7 @@
 #include "ttnn/operations/eltwise/ternary/where.hpp"
 #include "ttnn/operations/eltwise/unary/unary.hpp"
 #include "ttnn/operations/embedding/embedding.hpp"
+#include "ttnn/operations/experimental/paged_cache/paged_cache.hpp"
 #include "ttnn/operations/kv_cache/kv_cache.hpp"
 #include "ttnn/operations/matmul/matmul.hpp"
 #include "ttnn/operations/moreh/moreh_cumsum/moreh_cumsum.hpp"
@@ -36,6 +37,8 @@
 #include "ttnn/operations/pool/upsample/upsample.hpp"
 #include "ttnn/operations/reduction/generic/generic_reductions.hpp"
 #include "ttnn/operations/reduction/prod/prod.hpp"
+#include "ttnn/operations/transformer/sdpa/sdpa.hpp"
+#include "ttnn/operations/transformer/sdpa_decode/sdpa_decode.hpp"
 #include "ttnn/tensor/host_buffer/functions.hpp"
 #include "ttnn/tensor/host_buffer/owned_buffer.hpp"
 #include "ttnn/tensor/shape/shape.hpp"
@@ -65,6 +68,13 @@ createTensor(std::vector<std::shared_ptr<void>> &data,
              ::tt::target::DataType dataType,
              std::unordered_map<std::string, std::string> const &strategy);
 
+Tensor createTensor(std::shared_ptr<void> data,
+                    std::vector<std::uint32_t> const &shape,
+                    std::vector<std::uint32_t> const &stride,
+                    std::uint32_t itemsize, ::tt::target::DataType dataType,
+                    std::vector<std::uint32_t> const &meshShape,
+                    std::vector<std::int64_t> const &shardDims);
+
 Tensor createTensor(Device device, Layout layout,
                     std::vector<std::uint32_t> const &shape,
                     std::vector<std::uint32_t> const &stride,
@@ -82,6 +92,14 @@ createTensor(std::vector<std::shared_ptr<void>> &data, TensorDesc const &desc,
       data, desc.shape, desc.stride, desc.itemsize, desc.dataType, strategy);
 }
 
+inline Tensor createTensor(std::shared_ptr<void> data, TensorDesc const &desc,
+                           std::vector<std::uint32_t> const &meshShape,
+                           std::vector<std::int64_t> const &shardDims) {
+  return ::tt::runtime::ttnn::createTensor(data, desc.shape, desc.stride,
+                                           desc.itemsize, desc.dataType,
+                                           meshShape, shardDims);
+}
+
 inline Tensor createTensor(Device device, Layout layout,
                            TensorDesc const &desc) {
   return ::tt::runtime::ttnn::createTensor(device, layout, desc.shape,
@@ -120,6 +138,10 @@ Tensor toLayout(Tensor tensor, Device device, Layout layout);
 Layout getLayout(Binary executableHandle, std::uint32_t programIndex,
                  std::uint32_t inputIndex);
 
+Layout getPreparedInputLayout(Binary executableHandle,
+                              std::uint32_t programIndex,
+                              std::uint32_t inputIndex);
+
 void memcpy(void *dst, Tensor src);
 
 void memcpy(Tensor dst, Tensor src);
@@ -128,7 +150,7 @@ void deallocateTensor(Tensor &tensor, bool force = false);
 
 std::string getOpDebugString(OpContext opContextHandle);
 
-std::string getOpLocInfo(OpContext opContextHandle);
+std::string getOpLocInfo(Binary executableHandle, OpContext opContextHandle);
 
 Tensor getOpOutputTensor(OpContext opContextHandle,
                          CallbackContext programContextHandle);
@@ -139,6 +161,10 @@ std::vector<Tensor> submit(Device deviceHandle, Binary executableHandle,
                            std::uint32_t programIndex,
                            std::vector<Tensor> const &inputs);
 
+std::vector<Tensor> submitBucketed(Device deviceHandle, Binary executableHandle,
+                                   std::string const &group,
+                                   std::vector<Tensor> const &inputs);
+
 std::vector<Tensor> runProgram(::ttnn::MeshDevice &meshDevice,
                                Binary executableHandle,
                                std::uint32_t programIndex,
@@ -7,6 +7,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <string>
 #include <vector>
 
 #include "tt/runtime/types.h"
@@ -59,6 +60,17 @@ createTensor(std::vector<std::shared_ptr<void>> &data,
              ::tt::target::DataType dataType,
              std::unordered_map<std::string, std::string> const &strategy);
 
+// Create a multi-device host tensor from user-owned data of the full tensor,
+// split over a 2D mesh of `meshShape` devices. `shardDims` holds the tensor
+// dim sharded along each mesh axis, or -1 if the axis replicates it. The
+// shards are copied out of `data`, which doesn't need to outlive the tensor.
+Tensor createTensor(std::shared_ptr<void> data,
+                    std::vector<std::uint32_t> const &shape,
+                    std::vector<std::uint32_t> const &stride,
+                    std::uint32_t itemsize, ::tt::target::DataType dataType,
+                    std::vector<std::uint32_t> const &meshShape,
+                    std::vector<std::int64_t> const &shardDims);
+
 Tensor createTensor(Device device, Layout layout,
                     std::vector<std::uint32_t> const &shape,
                     std::vector<std::uint32_t> const &stride,
@@ -76,6 +88,14 @@ createTensor(std::vector<std::shared_ptr<void>> &data, TensorDesc const &desc,
                                      desc.itemsize, desc.dataType, strategy);
 }
 
+inline Tensor createTensor(std::shared_ptr<void> data, TensorDesc const &desc,
+                           std::vector<std::uint32_t> const &meshShape,
+                           std::vector<std::int64_t> const &shardDims) {
+  return ::tt::runtime::createTensor(data, desc.shape, desc.stride,
+                                     desc.itemsize, desc.dataType,
+                                     meshShape, shardDims);
+}
+
 inline Tensor createTensor(Device device, Layout layout,
                            TensorDesc const &desc) {
   return ::tt::runtime::createTensor(device, layout, desc.shape, desc.stride,
@@ -107,6 +127,14 @@ Tensor toLayout(Tensor tensor, Device device, Layout layout);
 Layout getLayout(Binary executableHandle, std::uint32_t programIndex,
                  std::uint32_t inputIndex);
 
+// Returns the layout the ops of the program consume the input in, after the
+// conversions the program starts it with. Inputs submitted in this layout,
+// e.g. tilized tensors on device created once with toLayout and reused across
+// submits, skip those conversions.
+Layout getPreparedInputLayout(Binary executableHandle,
+                              std::uint32_t programIndex,
+                              std::uint32_t inputIndex);
+
 void memcpy(void *dst, Tensor src);
 
 void memcpy(Tensor dst, Tensor src);
@@ -115,7 +143,7 @@ void deallocateTensor(Tensor &tensor, bool force = false);
 
 std::string getOpDebugString(OpContext opContextHandle);
 
-std::string getOpLocInfo(OpContext opContextHandle);
+std::string getOpLocInfo(Binary executableHandle, OpContext opContextHandle);
 
 Tensor getOpOutputTensor(OpContext opContextHandle,
                          CallbackContext programContextHandle);
@@ -126,6 +154,15 @@ std::vector<Tensor> submit(Device deviceHandle, Binary executableHandle,
                            std::uint32_t programIndex,
                            std::vector<Tensor> const &inputs);
 
+// Runs the program of the shape bucket group `group`, i.e. of the function
+// compiled with the `shape-buckets` pipeline option, whose bucket is the
+// smallest the inputs fit in. The bucketed dimensions of the inputs are padded
+// up to the bucket size and those of the outputs sliced back to the length of
+// the inputs.
+std::vector<Tensor> submitBucketed(Device deviceHandle, Binary executableHandle,
+                                   std::string const &group,
+                                   std::vector<Tensor> const &inputs);
+
 Event submit(Device deviceHandle, Binary executableHandle,
              std::uint32_t programIndex, std::vector<Tensor> const &inputs,
              std::vector<Tensor> const &outputs);
@@ -44,6 +44,14 @@ enum class DispatchCoreType {
   ETH,
 };
 
+enum class FlatbufferFormat {
+  Unknown,
+  TTNN,
+  TTMetal,
+  SystemDesc,
+  TTNNDebugInfo,
+};
+
 namespace detail {
 struct ObjectImpl {
 
@@ -98,15 +106,24 @@ struct TensorDesc {
 using DeviceIds = std::vector<int>;
 
 struct Flatbuffer : public detail::ObjectImpl {
-  using detail::ObjectImpl::ObjectImpl;
+  // Resolves the format from the file identifier once, so that accessors
+  // don't have to re-check the buffer on every call.
+  Flatbuffer(std::shared_ptr<void> handle);
 
+  // Maps the file into memory and verifies the sections needed for
+  // execution. Debug info and goldens are only verified when accessed.
   static Flatbuffer loadFromPath(char const *path);
 
+  FlatbufferFormat getFormat() const { return format; }
+
   void store(char const *path) const;
   std::string_view getFileIdentifier() const;
   std::string getVersion() const;
   std::string_view getTTMLIRGitHash() const;
   std::string asJson() const;
+
+protected:
+  FlatbufferFormat format;
 };
 
 struct SystemDesc : public Flatbuffer {
@@ -122,13 +139,25 @@ struct SystemDesc : public Flatbuffer {
 };
 
 struct Binary : public Flatbuffer {
-  using Flatbuffer::Flatbuffer;
+  Binary(std::shared_ptr<void> handle);
 
   static Binary loadFromPath(char const *path);
 
+  // Attaches the debug info sidecar that was emitted together with this
+  // (stripped) binary, goldens are looked up there afterwards.
+  void loadDebugInfo(char const *path);
+
   std::vector<TensorDesc> getProgramInputs(std::uint32_t programIndex) const;
   std::vector<TensorDesc> getProgramOutputs(std::uint32_t programIndex) const;
   const ::tt::target::GoldenTensor *getDebugInfoGolden(std::string &loc) const;
+  // Returns the location with ID `locId` in the location table of a binary
+  // built with compact locations, or null if there is none.
+  const char *getDebugInfoLocation(std::uint32_t locId) const;
+
+  std::shared_ptr<void> debugInfoHandle;
+  // Debug info tables embedded in the binary, verified on first access and
+  // shared between copies of the binary.
+  std::shared_ptr<void> debugInfoCache;
 };
 
 struct Device : public detail::RuntimeCheckedObjectImpl {
@@ -37,6 +37,8 @@ inline std::uint32_t dataTypeElementSize(::tt::target::DataType dataType) {
     return 2;
   case ::tt::target::DataType::UInt8:
     return 1;
+  case ::tt::target::DataType::Int32:
+    return 4;
   default:
     assert(false && "Unsupported element size for data type");
     return 0;
@@ -2,7 +2,13 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+#include <fcntl.h>
 #include <fstream>
+#include <mutex>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "flatbuffers/idl.h"
 
@@ -15,6 +21,7 @@
 #include "ttmlir/Target/TTMetal/binary_bfbs_generated.h"
 #include "ttmlir/Target/TTNN/Target.h"
 #include "ttmlir/Target/TTNN/binary_bfbs_generated.h"
+#include "ttmlir/Target/TTNN/debug_info_bfbs_generated.h"
 
 namespace tt::runtime {
 
@@ -54,12 +61,135 @@ calculateStride(std::vector<uint32_t> const &shape) {
 namespace ttnn {
 
 ::tt::target::ttnn::TTNNBinary const *getBinary(Flatbuffer binary) {
-  bool isTTNN = ::tt::target::ttnn::SizePrefixedTTNNBinaryBufferHasIdentifier(
-      binary.handle.get());
-  LOG_ASSERT(isTTNN, "Unsupported binary format");
+  LOG_ASSERT(binary.getFormat() == FlatbufferFormat::TTNN,
+             "Unsupported binary format");
   return ::tt::target::ttnn::GetSizePrefixedTTNNBinary(binary.handle.get());
 }
 
+// Checks that the input contracts of `program`, if it has any, line up with
+// its inputs, which the runtime indexes them by.
+static bool verifyInputContracts(::tt::target::ttnn::Program const *program) {
+  auto const *contracts = program->input_contracts();
+  if (!contracts) {
+    return true;
+  }
+  if (!program->inputs() || contracts->size() != program->inputs()->size()) {
+    return false;
+  }
+  for (auto const *contract : *contracts) {
+    if (!contract->tensor() || !contract->skipped_ops()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns whether `dims` holds one list of dims per tensor in `tensors`, each
+// of them within the rank of its tensor.
+static bool verifyBucketDims(
+    ::flatbuffers::Vector<::flatbuffers::Offset<::tt::target::ttnn::BucketDims>>
+        const *dims,
+    ::flatbuffers::Vector<::flatbuffers::Offset<::tt::target::TensorRef>> const
+        *tensors) {
+  if (!dims || !tensors || dims->size() != tensors->size()) {
+    return false;
+  }
+  for (std::uint32_t i = 0; i < dims->size(); ++i) {
+    auto const *tensorDims = dims->Get(i)->dims();
+    auto const *desc = tensors->Get(i)->desc();
+    if (!tensorDims || !desc || !desc->shape()) {
+      return false;
+    }
+    for (std::uint32_t dim : *tensorDims) {
+      if (dim >= desc->shape()->size()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Checks that the shape bucket of `program`, if it has one, has a group, and
+// dims and pad values that line up with its inputs and outputs.
+static bool verifyShapeBucket(::tt::target::ttnn::Program const *program) {
+  auto const *bucket = program->bucket();
+  if (!bucket) {
+    return true;
+  }
+  return bucket->group() &&
+         verifyBucketDims(bucket->input_dims(), program->inputs()) &&
+         verifyBucketDims(bucket->output_dims(), program->outputs()) &&
+         bucket->input_pad_values() &&
+         bucket->input_pad_values()->size() == program->inputs()->size();
+}
+
+// Verifies the parts of a TTNN binary that are needed to execute it. The
+// debug info of the programs (MLIR source, generated C++ and goldens) is
+// skipped, so it is never paged in from a mapped file; it is verified when
+// it is first accessed instead.
+static bool verifyExecutableSections(uint8_t const *buffer, size_t size) {
+  using ::tt::target::ttnn::Program;
+  using ::tt::target::ttnn::TTNNBinary;
+
+  ::flatbuffers::Verifier verifier(buffer, size);
+  if (!verifier.VerifyOffset(sizeof(::flatbuffers::uoffset_t))) {
+    return false;
+  }
+
+  TTNNBinary const *binary =
+      ::tt::target::ttnn::GetSizePrefixedTTNNBinary(buffer);
+  if (!binary->VerifyTableStart(verifier) ||
+      !binary->VerifyField<::tt::target::Version>(
+          verifier, TTNNBinary::VT_VERSION, 4) ||
+      !binary->VerifyOffset(verifier, TTNNBinary::VT_TTMLIR_GIT_HASH) ||
+      !verifier.VerifyString(binary->ttmlir_git_hash()) ||
+      !binary->VerifyOffset(verifier, TTNNBinary::VT_SYSTEM_DESC) ||
+      !verifier.VerifyTable(binary->system_desc()) ||
+      !binary->VerifyOffset(verifier, TTNNBinary::VT_TENSOR_DATA) ||
+      !verifier.VerifyVector(binary->tensor_data()) ||
+      !verifier.VerifyVectorOfTables(binary->tensor_data()) ||
+      !binary->VerifyOffset(verifier, TTNNBinary::VT_PROGRAMS) ||
+      !verifier.VerifyVector(binary->programs())) {
+    return false;
+  }
+
+  if (binary->programs()) {
+    for (Program const *program : *binary->programs()) {
+      if (!program || !program->VerifyTableStart(verifier) ||
+          !program->VerifyOffset(verifier, Program::VT_NAME) ||
+          !verifier.VerifyString(program->name()) ||
+          !program->VerifyOffset(verifier, Program::VT_INPUTS) ||
+          !verifier.VerifyVector(program->inputs()) ||
+          !verifier.VerifyVectorOfTables(program->inputs()) ||
+          !program->VerifyOffset(verifier, Program::VT_OUTPUTS) ||
+          !verifier.VerifyVector(program->outputs()) ||
+          !verifier.VerifyVectorOfTables(program->outputs()) ||
+          !program->VerifyOffset(verifier, Program::VT_OPERATIONS) ||
+          !verifier.VerifyVector(program->operations()) ||
+          !verifier.VerifyVectorOfTables(program->operations()) ||
+          !program->VerifyOffset(verifier, Program::VT_DEBUG_INFO) ||
+          !program->VerifyOffset(verifier, Program::VT_INPUT_CONTRACTS) ||
+          !verifier.VerifyVector(program->input_contracts()) ||
+          !verifier.VerifyVectorOfTables(program->input_contracts()) ||
+          !program->VerifyOffset(verifier, Program::VT_BUCKET) ||
+          !verifier.VerifyTable(program->bucket()) || !verifier.EndTable() ||
+          !verifyInputContracts(program) || !verifyShapeBucket(program)) {
+        return false;
+      }
+    }
+  }
+
+  return verifier.EndTable();
+}
+
+static void verifyDebugInfo(Flatbuffer binary,
+                            ::tt::target::DebugInfo const *debugInfo) {
+  uint8_t const *buffer = static_cast<uint8_t const *>(binary.handle.get());
+  ::flatbuffers::Verifier verifier(
+      buffer, ::flatbuffers::GetSizePrefixedBufferLength(buffer));
+  LOG_ASSERT(verifier.VerifyTable(debugInfo), "Corrupt debug info section");
+}
+
 std::string getVersion(Flatbuffer binary) {
   auto const *version = getBinary(binary)->version();
   return std::to_string(version->major()) + "." +
@@ -111,16 +241,56 @@ std::vector<TensorDesc> getProgramOutputs(Flatbuffer binary,
   return outputs;
 }
 
-const ::tt::target::GoldenTensor *getDebugInfoGolden(Flatbuffer binary,
-                                                     std::string &loc) {
-  auto const *programs = getBinary(binary)->programs();
-  for (auto const *program : *programs) {
-    for (const ::tt::target::GoldenKV *goldenKV :
-         *program->debug_info()->golden_info()->golden_map()) {
-      if (std::string(goldenKV->key()->c_str()) == loc) {
-        return goldenKV->value();
-        ;
+static const ::tt::target::GoldenTensor *
+lookupGolden(::tt::target::DebugInfo const *debugInfo, std::string &loc) {
+  if (!debugInfo->golden_info() || !debugInfo->golden_info()->golden_map()) {
+    return nullptr;
+  }
+  const ::tt::target::GoldenKV *goldenKV =
+      debugInfo->golden_info()->golden_map()->LookupByKey(loc.c_str());
+  return goldenKV ? goldenKV->value() : nullptr;
+}
+
+struct DebugInfoCache {
+  std::once_flag verified;
+  std::vector<::tt::target::DebugInfo const *> debugInfos;
+};
+
+// Returns the debug info tables of `binary`, the one of its sidecar if it has
+// one loaded.
+static std::vector<::tt::target::DebugInfo const *>
+getDebugInfos(Binary const &binary) {
+  if (binary.debugInfoHandle) {
+    // sidecar was verified when it was loaded
+    return {::tt::target::ttnn::GetSizePrefixedTTNNDebugInfo(
+                binary.debugInfoHandle.get())
+                ->debug_info()};
+  }
+
+  // embedded tables are verified on the first lookup only
+  auto &cache = *static_cast<DebugInfoCache *>(binary.debugInfoCache.get());
+  std::call_once(cache.verified, [&]() {
+    // programs usually share one debug info table, only keep it once
+    for (auto const *program : *getBinary(binary)->programs()) {
+      ::tt::target::DebugInfo const *debugInfo = program->debug_info();
+      if (!debugInfo ||
+          std::find(cache.debugInfos.begin(), cache.debugInfos.end(),
+                    debugInfo) != cache.debugInfos.end()) {
+        continue;
       }
+      verifyDebugInfo(binary, debugInfo);
+      cache.debugInfos.push_back(debugInfo);
+    }
+  });
+  return cache.debugInfos;
+}
+
+const ::tt::target::GoldenTensor *getDebugInfoGolden(Binary const &binary,
+                                                     std::string &loc) {
+  for (::tt::target::DebugInfo const *debugInfo : getDebugInfos(binary)) {
+    if (const ::tt::target::GoldenTensor *golden =
+            lookupGolden(debugInfo, loc)) {
+      return golden;
     }
   }
 
@@ -128,15 +298,22 @@ const ::tt::target::GoldenTensor *getDebugInfoGolden(Flatbuffer binary,
   return nullptr;
 }
 
+const char *getDebugInfoLocation(Binary const &binary, std::uint32_t locId) {
+  for (::tt::target::DebugInfo const *debugInfo : getDebugInfos(binary)) {
+    if (debugInfo->locations() && locId < debugInfo->locations()->size()) {
+      return debugInfo->locations()->Get(locId)->c_str();
+    }
+  }
+  return nullptr;
+}
+
 } // namespace ttnn
 
 namespace metal {
 
 ::tt::target::metal::TTMetalBinary const *getBinary(Flatbuffer binary) {
-  bool isTTMetal =
-      ::tt::target::metal::SizePrefixedTTMetalBinaryBufferHasIdentifier(
-          binary.handle.get());
-  LOG_ASSERT(isTTMetal, "Unsupported binary format");
+  LOG_ASSERT(binary.getFormat() == FlatbufferFormat::TTMetal,
+             "Unsupported binary format");
   return ::tt::target::metal::GetSizePrefixedTTMetalBinary(binary.handle.get());
 }
 
@@ -209,10 +386,8 @@ const ::tt::target::GoldenTensor *getDebugInfoGolden(Flatbuffer binary,
 namespace system_desc {
 
 ::tt::target::SystemDescRoot const *getBinary(Flatbuffer binary) {
-  if (!::tt::target::SizePrefixedSystemDescRootBufferHasIdentifier(
-          binary.handle.get())) {
-    LOG_FATAL("Unsupported binary format");
-  }
+  LOG_ASSERT(binary.getFormat() == FlatbufferFormat::SystemDesc,
+             "Unsupported binary format");
   return ::tt::target::GetSizePrefixedSystemDescRoot(binary.handle.get());
 }
 
@@ -235,15 +410,106 @@ std::string asJson(Flatbuffer binary) {
 
 } // namespace system_desc
 
+namespace debug_info {
+
+::tt::target::ttnn::TTNNDebugInfo const *getBinary(Flatbuffer binary) {
+  LOG_ASSERT(binary.getFormat() == FlatbufferFormat::TTNNDebugInfo,
+             "Unsupported binary format");
+  return ::tt::target::ttnn::GetSizePrefixedTTNNDebugInfo(binary.handle.get());
+}
+
+std::string getVersion(Flatbuffer binary) {
+  auto const *version = getBinary(binary)->version();
+  return std::to_string(version->major()) + "." +
+         std::to_string(version->minor()) + "." +
+         std::to_string(version->patch());
+}
+
+std::string_view getTTMLIRGitHash(Flatbuffer binary) {
+  return getBinary(binary)->ttmlir_git_hash()->c_str();
+}
+
+std::string asJson(Flatbuffer binary) {
+  return ::tt::runtime::asJson(
+      binary.handle.get(),
+      ::tt::target::ttnn::TTNNDebugInfoBinarySchema::data(),
+      ::tt::target::ttnn::TTNNDebugInfoBinarySchema::size());
+}
+
+} // namespace debug_info
+
+static FlatbufferFormat getFlatbufferFormat(void const *buffer) {
+  if (!buffer) {
+    return FlatbufferFormat::Unknown;
+  }
+
+  if (::tt::target::ttnn::SizePrefixedTTNNBinaryBufferHasIdentifier(buffer)) {
+    return FlatbufferFormat::TTNN;
+  }
+
+  if (::tt::target::metal::SizePrefixedTTMetalBinaryBufferHasIdentifier(
+          buffer)) {
+    return FlatbufferFormat::TTMetal;
+  }
+
+  if (::tt::target::SizePrefixedSystemDescRootBufferHasIdentifier(buffer)) {
+    return FlatbufferFormat::SystemDesc;
+  }
+
+  if (::tt::target::ttnn::SizePrefixedTTNNDebugInfoBufferHasIdentifier(
+          buffer)) {
+    return FlatbufferFormat::TTNNDebugInfo;
+  }
+
+  return FlatbufferFormat::Unknown;
+}
+
+Flatbuffer::Flatbuffer(std::shared_ptr<void> handle)
+    : detail::ObjectImpl(handle), format(getFlatbufferFormat(handle.get())) {}
+
 Flatbuffer Flatbuffer::loadFromPath(char const *path) {
-  // load a flatbuffer from path
-  std::ifstream fbb(path, std::ios::binary | std::ios::ate);
-  LOG_ASSERT(fbb.is_open(), "Failed to open file: ", path);
-  std::streampos size = fbb.tellg();
-  fbb.seekg(0, std::ios::beg);
-  auto buffer = ::tt::runtime::utils::malloc_shared(size);
-  fbb.read(static_cast<char *>(buffer.get()), size);
-  return Flatbuffer(buffer);
+  // map a flatbuffer from path, pages (e.g. constant tensor data) are only
+  // read from disk once they are touched. The mapping is read-only, host
+  // tensors borrowing constant data from it must never be written to.
+  int fd = ::open(path, O_RDONLY);
+  LOG_ASSERT(fd >= 0, "Failed to open file: ", path);
+  struct stat fileStat;
+  int statResult = ::fstat(fd, &fileStat);
+  size_t size = static_cast<size_t>(fileStat.st_size);
+  void *addr = (statResult == 0 && size > sizeof(::flatbuffers::uoffset_t))
+                   ? ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0)
+                   : MAP_FAILED;
+  ::close(fd);
+  LOG_ASSERT(addr != MAP_FAILED, "Failed to map file: ", path);
+  Flatbuffer fbb(std::shared_ptr<void>(
+      addr, [size](void *ptr) { ::munmap(ptr, size); }));
+
+  // verify once here so that accessors can trust the buffer afterwards
+  uint8_t const *buffer = static_cast<uint8_t const *>(addr);
+  size_t bufferSize = ::flatbuffers::GetSizePrefixedBufferLength(buffer);
+  LOG_ASSERT(bufferSize <= size, "Truncated flatbuffer: ", path);
+  ::flatbuffers::Verifier verifier(buffer, bufferSize);
+  bool verified = false;
+  switch (fbb.getFormat()) {
+  case FlatbufferFormat::TTNN:
+    verified = ttnn::verifyExecutableSections(buffer, bufferSize);
+    break;
+  case FlatbufferFormat::TTMetal:
+    verified =
+        ::tt::target::metal::VerifySizePrefixedTTMetalBinaryBuffer(verifier);
+    break;
+  case FlatbufferFormat::SystemDesc:
+    verified = ::tt::target::VerifySizePrefixedSystemDescRootBuffer(verifier);
+    break;
+  case FlatbufferFormat::TTNNDebugInfo:
+    verified =
+        ::tt::target::ttnn::VerifySizePrefixedTTNNDebugInfoBuffer(verifier);
+    break;
+  case FlatbufferFormat::Unknown:
+    LOG_FATAL("Unsupported binary format: ", path);
+  }
+  LOG_ASSERT(verified, "Failed to verify flatbuffer: ", path);
+  return fbb;
 }
 
 void Flatbuffer::store(char const *path) const {
@@ -255,78 +521,82 @@ void Flatbuffer::store(char const *path) const {
 }
 
 std::string_view Flatbuffer::getFileIdentifier() const {
-  if (::tt::target::ttnn::SizePrefixedTTNNBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTNN) {
     return ::tt::target::ttnn::TTNNBinaryIdentifier();
   }
 
-  if (::tt::target::metal::SizePrefixedTTMetalBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTMetal) {
     return ::tt::target::metal::TTMetalBinaryIdentifier();
   }
 
-  if (::tt::target::SizePrefixedSystemDescRootBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::SystemDesc) {
     return ::tt::target::SystemDescRootIdentifier();
   }
 
+  if (format == FlatbufferFormat::TTNNDebugInfo) {
+    return ::tt::target::ttnn::TTNNDebugInfoIdentifier();
+  }
+
   LOG_FATAL("Unsupported binary format");
 }
 
 std::string Flatbuffer::getVersion() const {
-  if (::tt::target::ttnn::SizePrefixedTTNNBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTNN) {
     return ttnn::getVersion(*this);
   }
 
-  if (::tt::target::metal::SizePrefixedTTMetalBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTMetal) {
     return metal::getVersion(*this);
   }
 
-  if (::tt::target::SizePrefixedSystemDescRootBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::SystemDesc) {
     return system_desc::getVersion(*this);
   }
 
+  if (format == FlatbufferFormat::TTNNDebugInfo) {
+    return debug_info::getVersion(*this);
+  }
+
   LOG_FATAL("Unsupported binary format");
 }
 
 std::string_view Flatbuffer::getTTMLIRGitHash() const {
-  if (::tt::target::ttnn::SizePrefixedTTNNBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTNN) {
     return ttnn::getTTMLIRGitHash(*this);
   }
 
-  if (::tt::target::metal::SizePrefixedTTMetalBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTMetal) {
     return metal::getTTMLIRGitHash(*this);
   }
 
-  if (::tt::target::SizePrefixedSystemDescRootBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::SystemDesc) {
     return system_desc::getTTMLIRGitHash(*this);
   }
 
+  if (format == FlatbufferFormat::TTNNDebugInfo) {
+    return debug_info::getTTMLIRGitHash(*this);
+  }
+
   LOG_FATAL("Unsupported binary format");
 }
 
 std::string Flatbuffer::asJson() const {
-  if (::tt::target::ttnn::SizePrefixedTTNNBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTNN) {
     return ttnn::asJson(*this);
   }
 
-  if (::tt::target::metal::SizePrefixedTTMetalBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTMetal) {
     return metal::asJson(*this);
   }
 
-  if (::tt::target::SizePrefixedSystemDescRootBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::SystemDesc) {
     return system_desc::asJson(*this);
   }
 
+  if (format == FlatbufferFormat::TTNNDebugInfo) {
+    return debug_info::asJson(*this);
+  }
+
   LOG_FATAL("Unsupported binary format");
 }
 
@@ -334,19 +604,36 @@ SystemDesc SystemDesc::loadFromPath(char const *path) {
   return SystemDesc(Flatbuffer::loadFromPath(path).handle);
 }
 
+Binary::Binary(std::shared_ptr<void> handle)
+    : Flatbuffer(handle),
+      debugInfoCache(std::make_shared<ttnn::DebugInfoCache>()) {}
+
 Binary Binary::loadFromPath(char const *path) {
   return Binary(Flatbuffer::loadFromPath(path).handle);
 }
 
+void Binary::loadDebugInfo(char const *path) {
+  LOG_ASSERT(format == FlatbufferFormat::TTNN,
+             "Debug info files are only supported for TTNN binaries");
+  Flatbuffer debugInfo = Flatbuffer::loadFromPath(path);
+  LOG_ASSERT(debugInfo.getFormat() == FlatbufferFormat::TTNNDebugInfo,
+             "Not a debug info file: ", path);
+  uint64_t expectedHash = ttnn::getBinary(*this)->debug_info_hash();
+  uint64_t actualHash = ::tt::target::ttnn::GetSizePrefixedTTNNDebugInfo(
+                            debugInfo.handle.get())
+                            ->content_hash();
+  LOG_ASSERT(expectedHash != 0 && expectedHash == actualHash,
+             "Debug info file does not belong to this binary: ", path);
+  debugInfoHandle = debugInfo.handle;
+}
+
 std::vector<TensorDesc>
 Binary::getProgramInputs(std::uint32_t programIndex) const {
-  if (::tt::target::ttnn::SizePrefixedTTNNBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTNN) {
     return ttnn::getProgramInputs(*this, programIndex);
   }
 
-  if (::tt::target::metal::SizePrefixedTTMetalBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTMetal) {
     return metal::getProgramInputs(*this, programIndex);
   }
 
@@ -355,13 +642,11 @@ Binary::getProgramInputs(std::uint32_t programIndex) const {
 
 std::vector<TensorDesc>
 Binary::getProgramOutputs(std::uint32_t programIndex) const {
-  if (::tt::target::ttnn::SizePrefixedTTNNBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTNN) {
     return ttnn::getProgramOutputs(*this, programIndex);
   }
 
-  if (::tt::target::metal::SizePrefixedTTMetalBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTMetal) {
     return metal::getProgramOutputs(*this, programIndex);
   }
 
@@ -370,17 +655,24 @@ Binary::getProgramOutputs(std::uint32_t programIndex) const {
 
 const ::tt::target::GoldenTensor *
 Binary::getDebugInfoGolden(std::string &loc) const {
-  if (::tt::target::ttnn::SizePrefixedTTNNBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTNN) {
     return ttnn::getDebugInfoGolden(*this, loc);
   }
 
-  if (::tt::target::metal::SizePrefixedTTMetalBinaryBufferHasIdentifier(
-          handle.get())) {
+  if (format == FlatbufferFormat::TTMetal) {
     return metal::getDebugInfoGolden(*this, loc);
   }
 
   LOG_FATAL("Unsupported binary format for obtaining golden information");
 }
 
+const char *Binary::getDebugInfoLocation(std::uint32_t locId) const {
+  if (format == FlatbufferFormat::TTNN) {
+    return ttnn::getDebugInfoLocation(*this, locId);
+  }
+
+  // only TTNN binaries are built with compact locations
+  return nullptr;
+}
+
 } // namespace tt::runtime
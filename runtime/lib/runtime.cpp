@@ -182,6 +182,30 @@ createTensor(std::vector<std::shared_ptr<void>> &data,
   LOG_FATAL("runtime is not enabled");
 }
 
+Tensor createTensor(std::shared_ptr<void> data,
+                    std::vector<std::uint32_t> const &shape,
+                    std::vector<std::uint32_t> const &stride,
+                    std::uint32_t itemsize, ::tt::target::DataType dataType,
+                    std::vector<std::uint32_t> const &meshShape,
+                    std::vector<std::int64_t> const &shardDims) {
+  LOG_ASSERT(not shape.empty());
+  LOG_ASSERT(not stride.empty());
+  LOG_ASSERT(itemsize > 0);
+#if defined(TT_RUNTIME_ENABLE_TTNN)
+  if (getCurrentRuntime() == DeviceRuntime::TTNN) {
+    return ::tt::runtime::ttnn::createTensor(data, shape, stride, itemsize,
+                                             dataType, meshShape, shardDims);
+  }
+#endif
+
+#if defined(TT_RUNTIME_ENABLE_TTMETAL)
+  if (getCurrentRuntime() == DeviceRuntime::TTMetal) {
+    LOG_FATAL("Not implemented");
+  }
+#endif
+  LOG_FATAL("runtime is not enabled");
+}
+
 Tensor createTensor(Device device, Layout layout,
                     std::vector<std::uint32_t> const &shape,
                     std::vector<std::uint32_t> const &stride,
@@ -362,6 +386,24 @@ Layout getLayout(Binary executableHandle, std::uint32_t programIndex,
   LOG_FATAL("runtime is not enabled");
 }
 
+Layout getPreparedInputLayout(Binary executableHandle,
+                              std::uint32_t programIndex,
+                              std::uint32_t inputIndex) {
+#if defined(TT_RUNTIME_ENABLE_TTNN)
+  if (getCurrentRuntime() == DeviceRuntime::TTNN) {
+    return ::tt::runtime::ttnn::getPreparedInputLayout(
+        executableHandle, programIndex, inputIndex);
+  }
+#endif
+
+#if defined(TT_RUNTIME_ENABLE_TTMETAL)
+  if (getCurrentRuntime() == DeviceRuntime::TTMetal) {
+    LOG_FATAL("not implemented");
+  }
+#endif
+  LOG_FATAL("runtime is not enabled");
+}
+
 void memcpy(void *dst, Tensor src) {
 #if defined(TT_RUNTIME_ENABLE_TTNN)
   if (getCurrentRuntime() == DeviceRuntime::TTNN) {
@@ -422,16 +464,17 @@ std::string getOpDebugString(OpContext opContextHandle) {
   LOG_FATAL("runtime is not enabled");
 }
 
-std::string getOpLocInfo(OpContext opContextHandle) {
+std::string getOpLocInfo(Binary executableHandle, OpContext opContextHandle) {
 #ifdef TT_RUNTIME_ENABLE_TTNN
   if (getCurrentRuntime() == DeviceRuntime::TTNN) {
-    return ::tt::runtime::ttnn::getOpLocInfo(opContextHandle);
+    return ::tt::runtime::ttnn::getOpLocInfo(executableHandle, opContextHandle);
   }
 #endif
 
 #ifdef TT_RUNTIME_ENABLE_TTMETAL
   if (getCurrentRuntime() == DeviceRuntime::TTMetal) {
-    return ::tt::runtime::ttmetal::getOpLocInfo(opContextHandle);
+    return ::tt::runtime::ttmetal::getOpLocInfo(executableHandle,
+                                                  opContextHandle);
   }
 #endif
   throw std::runtime_error("runtime is not enabled");
@@ -489,6 +532,24 @@ std::vector<Tensor> submit(Device deviceHandle, Binary executableHandle,
   LOG_FATAL("runtime is not enabled");
 }
 
+std::vector<Tensor> submitBucketed(Device deviceHandle, Binary executableHandle,
+                                   std::string const &group,
+                                   std::vector<Tensor> const &inputHandles) {
+#if defined(TT_RUNTIME_ENABLE_TTNN)
+  if (getCurrentRuntime() == DeviceRuntime::TTNN) {
+    return ::tt::runtime::ttnn::submitBucketed(deviceHandle, executableHandle,
+                                               group, inputHandles);
+  }
+#endif
+
+#if defined(TT_RUNTIME_ENABLE_TTMETAL)
+  if (getCurrentRuntime() == DeviceRuntime::TTMetal) {
+    LOG_FATAL("not implemented");
+  }
+#endif
+  LOG_FATAL("runtime is not enabled");
+}
+
 Event submit(Device deviceHandle, Binary executableHandle,
              std::uint32_t programIndex,
              std::vector<Tensor> const &inputHandles,
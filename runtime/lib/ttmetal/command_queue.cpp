@@ -7,6 +7,7 @@
 #include <unordered_map>
 
 #include "tt/runtime/detail/debug.h"
+#include "tt/runtime/detail/program_cache.h"
 #include "tt/runtime/detail/ttmetal.h"
 #include "tt/runtime/runtime.h"
 #include "tt/runtime/utils.h"
@@ -18,6 +19,31 @@
 
 namespace tt::runtime::ttmetal {
 
+// A program built for an EnqueueProgramCommand, along with the handles needed
+// to re-enqueue it with different tensors.
+struct CachedProgram {
+  ::tt::tt_metal::Program program;
+  std::vector<::tt::tt_metal::KernelHandle> kernels;
+  // CBs backed by a tensor, in creation order. Their address is updated to
+  // the current tensor on every enqueue.
+  std::vector<::tt::tt_metal::CBHandle> globalCBs;
+  // Semaphores created with the program, per kernel in runtime arg order.
+  std::vector<std::vector<std::uint32_t>> semaphores;
+};
+
+static std::unordered_map<::tt::tt_metal::IDevice *,
+                          ProgramCache<CachedProgram>> &
+getProgramCaches() {
+  static std::unordered_map<::tt::tt_metal::IDevice *,
+                            ProgramCache<CachedProgram>>
+      programCaches;
+  return programCaches;
+}
+
+void clearProgramCache(::tt::tt_metal::IDevice *device) {
+  getProgramCaches().erase(device);
+}
+
 struct CQExecutor {
   ::tt::tt_metal::IDevice *device;
   std::vector<std::shared_ptr<::tt::tt_metal::Event>> initEvents;
@@ -37,6 +63,9 @@ struct CQExecutor {
   void execute(::tt::target::metal::Command const *command);
   void execute(::tt::target::metal::EnqueueProgramCommand const *command,
                char const *debugInfo);
+  CachedProgram
+  buildProgram(::tt::target::metal::EnqueueProgramCommand const *command,
+               char const *debugInfo);
   void execute(::tt::target::metal::EnqueueWriteBufferCommand const *command);
   void execute(::tt::target::metal::EnqueueReadBufferCommand const *command);
   void execute(::tt::target::metal::CreateBufferCommand const *command);
@@ -345,6 +374,8 @@ static ::tt::DataFormat toDataFormat(::tt::target::DataType dataType) {
     return ::tt::DataFormat::UInt16;
   case ::tt::target::DataType::UInt8:
     return ::tt::DataFormat::UInt8;
+  case ::tt::target::DataType::Int32:
+    return ::tt::DataFormat::Int32;
   default:
     LOG_FATAL("Unsupported data type");
   }
@@ -391,7 +422,8 @@ static void processRuntimeArgs(
         *operands,
     std::unordered_map<std::uint32_t,
                        std::shared_ptr<::tt::tt_metal::Buffer>> const
-        &buffers) {
+        &buffers,
+    std::vector<std::uint32_t> &semaphores) {
 
   using SemaphoreAddr = ::tt::target::metal::RuntimeArgSemaphoreAddress;
   using TensorAddr = ::tt::target::metal::RuntimeArgTensorAddress;
@@ -406,6 +438,9 @@ static void processRuntimeArgs(
 
   LOG_ASSERT(rt_args_types->size() == rt_args->size());
   std::vector<uint32_t> rt_args_vec;
+  // Semaphores are created the first time a program is built and reused
+  // every time the cached program is enqueued again.
+  std::size_t semaphoreIdx = 0;
 
   for (size_t i = 0; i < rt_args->size(); i++) {
     switch (rt_args_types->Get(i)) {
@@ -420,10 +455,12 @@ static void processRuntimeArgs(
     }
     case ::tt::target::metal::RuntimeArg::RuntimeArgSemaphoreAddress: {
       const auto *rt_arg = static_cast<const SemaphoreAddr *>(rt_args->Get(i));
-      auto addr = ::tt::tt_metal::CreateSemaphore(
-          program, coreRange, rt_arg->initial_value(),
-          toCoreType(rt_arg->core_type()));
-      rt_args_vec.push_back(addr);
+      if (semaphoreIdx == semaphores.size()) {
+        semaphores.push_back(::tt::tt_metal::CreateSemaphore(
+            program, coreRange, rt_arg->initial_value(),
+            toCoreType(rt_arg->core_type())));
+      }
+      rt_args_vec.push_back(semaphores[semaphoreIdx++]);
       break;
     }
     case ::tt::target::metal::RuntimeArg::NONE:
@@ -434,12 +471,11 @@ static void processRuntimeArgs(
   ::tt::tt_metal::SetRuntimeArgs(program, handle, coreRange, rt_args_vec);
 }
 
-void CQExecutor::execute(
+CachedProgram CQExecutor::buildProgram(
     ::tt::target::metal::EnqueueProgramCommand const *command,
     char const *debugInfo) {
-
-  ZoneScopedN("EnqueueProgramCommand");
-  ::tt::tt_metal::Program program = ::tt::tt_metal::CreateProgram();
+  ZoneScopedN("BuildProgram");
+  CachedProgram cached{::tt::tt_metal::CreateProgram(), {}, {}, {}};
 
   std::unordered_set<uint32_t> createdCBs;
   for (::tt::target::metal::KernelDesc const *kernelDesc :
@@ -457,8 +493,9 @@ void CQExecutor::execute(
     std::variant<DataMovementConfig, ComputeConfig, EthernetConfig> config =
         createKernelConfig(kernelSource);
 
-    ::tt::tt_metal::KernelHandle handle =
-        ::tt::tt_metal::CreateKernel(program, fileName, coreRangeSet, config);
+    cached.kernels.push_back(::tt::tt_metal::CreateKernel(
+        cached.program, fileName, coreRangeSet, config));
+    cached.semaphores.emplace_back();
 
     for (::tt::target::CBRef const *cbRef : *kernelDesc->cbs()) {
       if (createdCBs.count(cbRef->desc()->port())) {
@@ -467,29 +504,71 @@ void CQExecutor::execute(
       }
       ::tt::tt_metal::CircularBufferConfig config =
           createCircularBufferConfig(cbRef, buffers);
-      CBHandle cbHandle =
-          ::tt::tt_metal::CreateCircularBuffer(program, coreRangeSet, config);
+      CBHandle cbHandle = ::tt::tt_metal::CreateCircularBuffer(
+          cached.program, coreRangeSet, config);
 
       if (!cbRef->tensor_ref()) {
         // Internally allocated CBs are not associated with any tensor ref. We
         // need to set the address of the CB manually.
         std::shared_ptr<CircularBuffer> cbPtr =
-            tt_metal::detail::GetCircularBuffer(program, cbHandle);
+            tt_metal::detail::GetCircularBuffer(cached.program, cbHandle);
         assert(!cbPtr->globally_allocated() &&
                "CB should not be globally allocated");
         cbPtr->set_locally_allocated_address(cbRef->address());
+      } else {
+        cached.globalCBs.push_back(cbHandle);
       }
 
       createdCBs.insert(cbRef->desc()->port());
     }
+  }
+
+  return cached;
+}
+
+void CQExecutor::execute(
+    ::tt::target::metal::EnqueueProgramCommand const *command,
+    char const *debugInfo) {
+
+  ZoneScopedN("EnqueueProgramCommand");
+  // Programs are keyed on their kernels, CBs and core ranges but not on the
+  // tensors they run on, so an identical program is only built (and its
+  // kernels compiled) the first time it is enqueued on this device.
+  bool built = false;
+  CachedProgram &cached = getProgramCaches()[device].getOrBuild(
+      makeProgramCacheKey(command->program()), [&]() {
+        built = true;
+        return buildProgram(command, debugInfo);
+      });
+
+  std::unordered_set<uint32_t> visitedCBs;
+  std::size_t globalCBIdx = 0;
+  std::size_t kernelIdx = 0;
+  for (::tt::target::metal::KernelDesc const *kernelDesc :
+       *command->program()->kernels()) {
+    for (::tt::target::CBRef const *cbRef : *kernelDesc->cbs()) {
+      if (!visitedCBs.insert(cbRef->desc()->port()).second ||
+          !cbRef->tensor_ref()) {
+        continue;
+      }
+      ::tt::tt_metal::CBHandle cbHandle = cached.globalCBs[globalCBIdx++];
+      if (!built) {
+        ::tt::tt_metal::UpdateDynamicCircularBufferAddress(
+            cached.program, cbHandle,
+            *buffers.at(cbRef->tensor_ref()->global_id()));
+      }
+    }
 
     // Process Kernel's runtime args based on variant and call metal APIs.
-    processRuntimeArgs(program, kernelDesc, handle, coreRangeSet,
-                       command->operands(), buffers);
+    CoreRangeSet coreRangeSet = toCoreRangeSet(kernelDesc->core_range_set());
+    processRuntimeArgs(cached.program, kernelDesc, cached.kernels[kernelIdx],
+                       coreRangeSet, command->operands(), buffers,
+                       cached.semaphores[kernelIdx]);
+    ++kernelIdx;
   }
 
   constexpr bool blocking = false;
-  ::tt::tt_metal::EnqueueProgram(*cq, program, blocking);
+  ::tt::tt_metal::EnqueueProgram(*cq, cached.program, blocking);
 }
 
 void CQExecutor::execute(
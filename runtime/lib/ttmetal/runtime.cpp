@@ -21,10 +21,7 @@ using MetalTensor =
     std::variant<TensorDesc, std::shared_ptr<::tt::tt_metal::Buffer>>;
 
 static ::tt::target::metal::TTMetalBinary const *getBinary(Flatbuffer binary) {
-  bool isTTMetal =
-      ::tt::target::metal::SizePrefixedTTMetalBinaryBufferHasIdentifier(
-          binary.handle.get());
-  if (not isTTMetal) {
+  if (binary.getFormat() != FlatbufferFormat::TTMetal) {
     LOG_FATAL("Unsupported binary format");
   }
   return ::tt::target::metal::GetSizePrefixedTTMetalBinary(binary.handle.get());
@@ -115,6 +112,10 @@ void closeDevice(Device device) {
     ::tt::tt_metal::detail::DumpDeviceProfileResults(ttmetalDevice);
   }
 #endif
+  for (::tt::tt_metal::IDevice *ttmetalDevice :
+       ttmetalMeshDevice.get_devices()) {
+    clearProgramCache(ttmetalDevice);
+  }
   ttmetalMeshDevice.close();
 }
 
@@ -342,7 +343,7 @@ std::string getOpDebugString(OpContext opContextHandle) {
   return "";
 }
 
-std::string getOpLocInfo(OpContext opContextHandle) {
+std::string getOpLocInfo(Binary executableHandle, OpContext opContextHandle) {
   // Not implemented
   LOG_WARNING("obtaining op location info for metal runtime not implemented");
   return "";
@@ -6,6 +6,8 @@
 #include "tt/runtime/detail/logger.h"
 #include "tt/runtime/ttnn/utils.h"
 
+#include <type_traits>
+
 namespace tt::runtime::ttnn {
 
 //
@@ -65,6 +67,14 @@ LayoutConverter::toDeviceIfNeeded(const ::ttnn::Tensor &input,
     LOG_ASSERT(targetDevice.has_value());
     return std::visit(
         [&](auto &&targetDevice) -> ::ttnn::Tensor {
+          using DeviceType = std::decay_t<decltype(targetDevice.get())>;
+          if constexpr (std::is_same_v<DeviceType, ::ttnn::MeshDevice>) {
+            if (input.storage_type() ==
+                ::tt::tt_metal::StorageType::MULTI_DEVICE_HOST) {
+              return utils::toMeshDevice(input, targetDevice.get(),
+                                         outputDesc.memoryConfig);
+            }
+          }
           return ::ttnn::to_device(input, &(targetDevice.get()),
                                    outputDesc.memoryConfig);
         },
@@ -390,10 +400,12 @@ std::vector<Tensor> ProgramTensorPool::gatherOutputTensors() {
 // ProgramContext APIs
 //
 ProgramContext::ProgramContext(
+    const Binary &executableHandle,
     const std::unordered_map<uint32_t, ::ttnn::Tensor *> &liveTensors,
     const std::vector<uint32_t> &programInputs,
     const std::vector<uint32_t> &programOutputs, ::ttnn::MeshDevice *parentMesh)
-    : tensorPool(ProgramTensorPool(liveTensors, programInputs, programOutputs)),
+    : executableHandle(executableHandle),
+      tensorPool(ProgramTensorPool(liveTensors, programInputs, programOutputs)),
       parentMesh(parentMesh) {
   LOG_ASSERT(parentMesh, "Parent mesh cannot be null");
 }
@@ -428,6 +440,29 @@ size_t ProgramContext::subMeshSize(uint32_t meshId) const {
   return *subMesh.get_device_index(deviceIndex);
 }
 
+const ::ttnn::MemoryConfig &
+ProgramContext::getMemoryConfig(const ::tt::target::TensorRef *tensorRef) {
+  decltype(memoryConfigs)::key_type key(nullptr, tensorRef->desc()->layout());
+  auto it = memoryConfigs.find(key);
+  if (it == memoryConfigs.end()) {
+    it = memoryConfigs.emplace(key, utils::createMemoryConfig(tensorRef)).first;
+  }
+  return it->second;
+}
+
+const ::ttnn::MemoryConfig &
+ProgramContext::getMemoryConfig(const ::tt::target::MemoryConfigDesc *memcfg,
+                                const ::tt::target::TensorRef *tensorRef) {
+  decltype(memoryConfigs)::key_type key(memcfg, tensorRef->desc()->layout());
+  auto it = memoryConfigs.find(key);
+  if (it == memoryConfigs.end()) {
+    it = memoryConfigs
+             .emplace(key, utils::createMemoryConfig(memcfg, tensorRef))
+             .first;
+  }
+  return it->second;
+}
+
 DeviceVariant ProgramContext::getTargetDevice(uint32_t meshId) {
   LOG_ASSERT(subMeshes.contains(meshId));
   auto &subMesh = *subMeshes.at(meshId);
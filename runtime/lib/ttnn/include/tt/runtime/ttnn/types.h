@@ -7,6 +7,7 @@
 
 #include "tt/runtime/detail/ttnn.h"
 #include "tt/runtime/types.h"
+#include <map>
 #include <optional>
 #include <unordered_map>
 
@@ -136,6 +137,7 @@ private:
 class ProgramContext {
 public:
   ProgramContext(
+      const Binary &executableHandle,
       const std::unordered_map<uint32_t, ::ttnn::Tensor *> &liveTensors,
       const std::vector<uint32_t> &programInputs,
       const std::vector<uint32_t> &programOutputs,
@@ -145,6 +147,11 @@ public:
   ProgramContext(ProgramContext &&) = default;
   ProgramContext &operator=(ProgramContext &&) = default;
 
+  //
+  // Executable Operations
+  //
+  const Binary &getExecutableHandle() const { return executableHandle; }
+
   //
   // Parent Mesh Operations
   //
@@ -175,7 +182,24 @@ public:
   ProgramTensorPool &getTensorPool() { return tensorPool; }
   const ProgramTensorPool &getTensorPool() const { return tensorPool; }
 
+  //
+  // Memory Config Operations
+  //
+  // Returns the memory config of the tensor described by `tensorRef`
+  const ::ttnn::MemoryConfig &
+  getMemoryConfig(const ::tt::target::TensorRef *tensorRef);
+
+  // Returns the memory config described by `memcfg` for a tensor laid out as
+  // `tensorRef`
+  const ::ttnn::MemoryConfig &
+  getMemoryConfig(const ::tt::target::MemoryConfigDesc *memcfg,
+                  const ::tt::target::TensorRef *tensorRef);
+
 private:
+  // Keeps the binary alive for as long as tensors borrowing its constant
+  // tensor data may be in use
+  Binary executableHandle;
+
   ProgramTensorPool tensorPool;
 
   // Contains all devices borrowed from the user that are available to the
@@ -185,6 +209,14 @@ private:
   // Contains subMeshes of the parentMesh that are used by the program
   // Will be populated by GetDevice ops
   std::unordered_map<uint32_t, std::shared_ptr<::ttnn::MeshDevice>> subMeshes;
+
+  // Memory configs keyed by the memory config and layout tables they are
+  // built from. The compiler interns these tables, so each distinct memory
+  // config in the program is only built once per run
+  std::map<std::pair<const ::tt::target::MemoryConfigDesc *,
+                     const ::tt::target::LayoutDesc *>,
+           ::ttnn::MemoryConfig>
+      memoryConfigs;
 };
 } // namespace tt::runtime::ttnn
 
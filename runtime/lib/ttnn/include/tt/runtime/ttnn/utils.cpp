@@ -4,6 +4,12 @@
 
 #include "tt/runtime/ttnn/utils.h"
 #include "tt/runtime/detail/logger.h"
+#include "ttnn/distributed/api.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
 
 namespace tt::runtime::ttnn::utils {
 
@@ -42,6 +48,8 @@ bool isValidTileShape(const ::tt::target::Dim2d *shape) {
     return ::ttnn::DataType::UINT32;
   case ::tt::target::DataType::UInt16:
     return ::ttnn::DataType::UINT16;
+  case ::tt::target::DataType::Int32:
+    return ::ttnn::DataType::INT32;
 
   default:
     LOG_FATAL("Unsupported data type");
@@ -62,6 +70,8 @@ bool isValidTileShape(const ::tt::target::Dim2d *shape) {
     return ::tt::target::DataType::UInt32;
   case ::ttnn::DataType::UINT16:
     return ::tt::target::DataType::UInt16;
+  case ::ttnn::DataType::INT32:
+    return ::tt::target::DataType::Int32;
 
   default:
     LOG_FATAL("Unsupported data type");
@@ -208,10 +218,133 @@ createMemoryConfig(const ::tt::target::TensorRef *tensorRef) {
   return memoryConfig;
 }
 
+::tt::tt_metal::MemoryConfig
+createMemoryConfig(const ::tt::target::MemoryConfigDesc *memcfg,
+                   const ::tt::target::TensorRef *tensorRef) {
+
+  ::ttnn::TensorMemoryLayout tensorMemoryLayout =
+      toTTNNTensorMemoryLayout(memcfg->tensor_memory_layout());
+
+  ::ttnn::BufferType bufferType = toTTNNBufferType(memcfg->buffer_type());
+
+  const ::tt::target::LayoutDesc *layout = tensorRef->desc()->layout();
+  const ::flatbuffers::Vector<const tt::target::Dim2dRange *>
+      *targetCoreRangeSet = layout->core_range_set();
+  CoreRangeSet ttnnCoreRangeSet = toCoreRangeSet(targetCoreRangeSet);
+  const ::flatbuffers::Vector<int64_t> *shardShape =
+      memcfg->shard_spec()->shard_shape();
+  const ::tt::target::Dim2d *tileShape = layout->memory_desc()->tile_shape();
+
+  LOG_ASSERT(targetCoreRangeSet->size() == 1,
+             "Currently only single core range/grid is supported");
+
+  LOG_ASSERT(shardShape->size() == 2,
+             "Only 2D shard shape is supported in TTNN backend");
+
+  LOG_ASSERT(isValidTileShape(tileShape), "Invalid tile shape");
+
+  std::array<uint32_t, 2> ttnnShardShape = {
+      static_cast<uint32_t>(shardShape->Get(0)),
+      static_cast<uint32_t>(shardShape->Get(1))};
+
+  ttnnShardShape[0] *= tileShape->y();
+  ttnnShardShape[1] *= tileShape->x();
+
+  ::tt::tt_metal::ShardSpec shardSpec(
+      ttnnCoreRangeSet, ttnnShardShape,
+      ::tt::tt_metal::ShardOrientation::ROW_MAJOR);
+
+  ::ttnn::MemoryConfig memoryConfig = {
+      tensorMemoryLayout, bufferType,
+      tensorMemoryLayout == tt_metal::TensorMemoryLayout::INTERLEAVED
+          ? std::nullopt
+          : std::make_optional(shardSpec)};
+  return memoryConfig;
+}
+
 Tensor createRuntimeTensorFromTTNN(const ::ttnn::Tensor &tensor) {
   auto tensorPtr = std::make_shared<::ttnn::Tensor>(tensor);
   return Tensor(std::static_pointer_cast<void>(tensorPtr), nullptr,
                 DeviceRuntime::TTNN);
 }
 
+bool hasLayoutOf(const ::ttnn::Tensor &tensor,
+                 const ::tt::target::TensorRef *tensorRef) {
+  const ::tt::target::MemoryDesc *memoryDesc =
+      tensorRef->desc()->layout()->memory_desc();
+  if (tensor.get_layout() != inferLayoutFromTileShape(tensorRef) ||
+      tensor.get_dtype() != toTTNNDataType(memoryDesc->data_type())) {
+    return false;
+  }
+  if (toTTNNBufferType(memoryDesc->memory_space()) ==
+      ::ttnn::BufferType::SYSTEM_MEMORY) {
+    return isOnHost(tensor.storage_type());
+  }
+  return isOnDevice(tensor.storage_type()) &&
+         tensor.memory_config() == createMemoryConfig(tensorRef);
+}
+
+std::string getOpLocInfo(const Binary &binary,
+                         const ::tt::target::ttnn::Operation *op) {
+  if (op->loc_info()) {
+    return op->loc_info()->str();
+  }
+  if (const char *loc = binary.getDebugInfoLocation(op->loc_id())) {
+    return loc;
+  }
+  return "#" + std::to_string(op->loc_id());
+}
+
+void parallelFor(std::size_t count,
+                 const std::function<void(std::size_t)> &fn) {
+  std::size_t numThreads = std::min<std::size_t>(
+      count, std::max(1u, std::thread::hardware_concurrency()));
+  std::vector<std::exception_ptr> errors(count);
+  std::atomic<std::size_t> next = 0;
+  auto worker = [&] {
+    for (std::size_t i = next++; i < count; i = next++) {
+      try {
+        fn(i);
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads);
+  for (std::size_t i = 0; i < numThreads; ++i) {
+    threads.emplace_back(worker);
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  for (const std::exception_ptr &error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+::ttnn::Tensor
+toMeshDevice(const ::ttnn::Tensor &input, ::ttnn::MeshDevice &meshDevice,
+             const std::optional<::ttnn::MemoryConfig> &memoryConfig) {
+  LOG_ASSERT(input.storage_type() ==
+                 ::tt::tt_metal::StorageType::MULTI_DEVICE_HOST,
+             "Expected a multi-device host tensor");
+  std::vector<::ttnn::Tensor> hostShards =
+      ::ttnn::distributed::get_tensors_from_multi_device_storage(input);
+  std::vector<::ttnn::IDevice *> devices = meshDevice.get_devices();
+  LOG_ASSERT(hostShards.size() == devices.size(), "Expected ",
+             devices.size(), " shards, got ", hostShards.size());
+
+  std::vector<::ttnn::Tensor> deviceShards(devices.size());
+  parallelFor(devices.size(), [&](std::size_t i) {
+    deviceShards[i] =
+        ::ttnn::to_device(hostShards[i], devices[i], memoryConfig);
+  });
+  return ::ttnn::distributed::create_multi_device_tensor(
+      deviceShards, ::tt::tt_metal::StorageType::MULTI_DEVICE,
+      ::ttnn::distributed::get_distributed_tensor_config_from_tensor(input));
+}
+
 } // namespace tt::runtime::ttnn::utils
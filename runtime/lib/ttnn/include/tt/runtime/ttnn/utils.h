@@ -10,6 +10,10 @@
 #include "ttmlir/Target/Common/types_generated.h"
 #include "ttmlir/Target/TTNN/Target.h"
 
+#include <functional>
+#include <optional>
+#include <string>
+
 namespace tt::runtime::ttnn::utils {
 
 bool isOnHost(const ::ttnn::StorageType &storageType);
@@ -46,8 +50,35 @@ toCoreRangeSet(const ::flatbuffers::Vector<const ::tt::target::Dim2dRange *>
 ::tt::tt_metal::MemoryConfig
 createMemoryConfig(const ::tt::target::TensorRef *tensorRef);
 
+::tt::tt_metal::MemoryConfig
+createMemoryConfig(const ::tt::target::MemoryConfigDesc *memcfg,
+                   const ::tt::target::TensorRef *tensorRef);
+
 Tensor createRuntimeTensorFromTTNN(const ::ttnn::Tensor &tensor);
 
+// Returns true if `tensor` is stored where `tensorRef` is, in its layout, data
+// type and memory config.
+bool hasLayoutOf(const ::ttnn::Tensor &tensor,
+                 const ::tt::target::TensorRef *tensorRef);
+
+// Returns the location of `op`. Binaries built with compact locations only
+// store the ID of the location, which is looked up in the location table of
+// the debug info of `binary`. If that is not available, e.g. because the debug
+// info sidecar was not loaded, "#<id>" is returned.
+std::string getOpLocInfo(const Binary &binary,
+                         const ::tt::target::ttnn::Operation *op);
+
+// Calls `fn` for every index in [0, count) on a pool of at most one thread per
+// hardware thread, and rethrows the first exception thrown by any of them once
+// all have finished.
+void parallelFor(std::size_t count, const std::function<void(std::size_t)> &fn);
+
+// Moves each shard of a multi-device host tensor to its device in
+// `meshDevice`, uploading to all devices concurrently.
+::ttnn::Tensor
+toMeshDevice(const ::ttnn::Tensor &input, ::ttnn::MeshDevice &meshDevice,
+             const std::optional<::ttnn::MemoryConfig> &memoryConfig);
+
 } // namespace tt::runtime::ttnn::utils
 
 #endif
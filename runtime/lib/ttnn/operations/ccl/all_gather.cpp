@@ -15,16 +15,18 @@ void run(const ::tt::target::ttnn::AllGatherOp *op, ProgramContext &context) {
   const ::ttnn::Tensor &input = tensorPool.at(op->in()->global_id());
   int32_t gatherDim = op->dim();
   int32_t numLinks = op->num_links();
+  int32_t clusterAxis = op->cluster_axis();
   LOG_ASSERT(
       input.storage_type() == ::tt::tt_metal::StorageType::MULTI_DEVICE,
       "Input of all_gather must be MULTIDEVICE. id:", op->in()->global_id());
   ::tt::tt_metal::MemoryConfig outputMemoryConfig =
-      ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+      context.getMemoryConfig(op->out());
   ::ttnn::MeshDevice &meshDevice =
       context.getSubMesh(op->device()->global_id());
   ::ttnn::Tensor out = ::ttnn::all_gather(
-      input, gatherDim, 1, meshDevice, numLinks, outputMemoryConfig,
-      std::nullopt, std::nullopt, ::ttnn::ccl::Topology::Linear);
+      input, gatherDim, clusterAxis, meshDevice, numLinks, outputMemoryConfig,
+      std::nullopt, std::nullopt,
+      ::tt::runtime::ttnn::operations::utils::toTTNNTopology(op->topology()));
   tensorPool.insert_or_assign(op->out()->global_id(), out);
 }
 } // namespace tt::runtime::ttnn::operations::ccl
@@ -11,11 +11,58 @@
 #include "ttnn/tensor/xtensor/partition.hpp"
 
 namespace tt::runtime::ttnn::operations::ccl {
+// Checks that `input`, which was distributed over the mesh on host already,
+// is distributed the way the op would distribute it: replicated or sharded
+// over the whole mesh, with one shard per device of the shape of the op's
+// output.
+static void verifyHostDistribution(const ::ttnn::Tensor &input,
+                                   ::ttnn::MeshDevice &meshDevice,
+                                   const ::tt::target::MeshShardType &shardType,
+                                   const std::vector<int64_t> &shardDims,
+                                   const ::ttnn::Shape &outputShape) {
+  std::vector<::ttnn::Tensor> shards =
+      ::ttnn::distributed::get_tensors_from_multi_device_storage(input);
+  LOG_ASSERT(shards.size() == meshDevice.num_devices(),
+             "Sharded input does not match the mesh of ",
+             meshDevice.num_devices(), " devices");
+
+  ::tt::tt_metal::DistributedTensorConfig config =
+      ::ttnn::distributed::get_distributed_tensor_config_from_tensor(input);
+  bool isSharded = shardType == ::tt::target::MeshShardType::Devices &&
+                   std::any_of(shardDims.begin(), shardDims.end(),
+                               [](int64_t dim) { return dim >= 0; });
+  if (isSharded) {
+    const auto *shard2D = std::get_if<::tt::tt_metal::ShardTensor2D>(&config);
+    LOG_ASSERT(shard2D && shard2D->shard_mesh.y == meshDevice.num_rows() &&
+                   shard2D->shard_mesh.x == meshDevice.num_cols(),
+               "Input is not sharded over the ", meshDevice.num_rows(), "x",
+               meshDevice.num_cols(), " mesh");
+  } else {
+    LOG_ASSERT(std::holds_alternative<::tt::tt_metal::ReplicateTensor>(config),
+               "Input is not replicated over the mesh");
+  }
+
+  // The shapes tell apart inputs sharded along other tensor dims.
+  for (const ::ttnn::Tensor &shard : shards) {
+    LOG_ASSERT(shard.get_logical_shape() == outputShape, "Input shard shape ",
+               shard.get_logical_shape(), " does not match the shard shape ",
+               outputShape);
+  }
+}
+
 void FullToShardShape(const ::ttnn::Tensor &input, ::ttnn::Tensor &out,
                       ::ttnn::MeshDevice &meshDevice,
                       const ::tt::target::MeshShardType &shardType,
                       const std::vector<int64_t> &shardShape,
-                      const std::vector<int64_t> &shardDims) {
+                      const std::vector<int64_t> &shardDims,
+                      const ::ttnn::Shape &outputShape) {
+  // Inputs created sharded over the mesh on host are distributed already.
+  if (input.storage_type() == ::tt::tt_metal::StorageType::MULTI_DEVICE_HOST) {
+    verifyHostDistribution(input, meshDevice, shardType, shardDims,
+                           outputShape);
+    out = input;
+    return;
+  }
   if (shardType == ::tt::target::MeshShardType::Replicate) {
     out = ::ttnn::distributed::distribute_tensor(
         input,
@@ -110,7 +157,8 @@ void run(const ::tt::target::ttnn::MeshShardOp *op, ProgramContext &context) {
 
   ::ttnn::Tensor out;
   if (shardDirection == ::tt::target::MeshShardDirection::FullToShardShape) {
-    FullToShardShape(input, out, meshDevice, shardType, shardShape, shardDims);
+    FullToShardShape(input, out, meshDevice, shardType, shardShape, shardDims,
+                     utils::toTTNNShape(*op->out()->desc()->shape()));
   } else {
     ShardToFullShape(input, out, meshDevice, shardType, shardShape, shardDims);
   }
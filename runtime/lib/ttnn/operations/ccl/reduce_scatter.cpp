@@ -19,20 +19,21 @@ void run(const ::tt::target::ttnn::ReduceScatterOp *op,
   int32_t numLinks = op->num_links();
   auto mathOp =
       static_cast<::ttnn::operations::reduction::ReduceType>(op->math_op());
-  // Reduction in horizontal direction (x-dimension) in linear computation
-  // config: e.g., For 2x4 mesh, clusterAxis (1) means reduction in horizontal
-  // direction such as 0,1,2,3 and 4,5,6,7.
-  int32_t clusterAxis = 1;
+  // e.g., For 2x4 mesh, clusterAxis (1) means reduction in horizontal
+  // direction such as 0,1,2,3 and 4,5,6,7, clusterAxis (0) means reduction in
+  // vertical direction such as 0,4 and 1,5.
+  int32_t clusterAxis = op->cluster_axis();
   LOG_ASSERT(input.storage_type() == ::tt::tt_metal::StorageType::MULTI_DEVICE,
              "Input of reduce_scatter must be MULTIDEVICE. id:",
              op->in()->global_id());
   ::tt::tt_metal::MemoryConfig outputMemoryConfig =
-      ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+      context.getMemoryConfig(op->out());
   ::ttnn::MeshDevice &meshDevice =
       context.getSubMesh(op->device()->global_id());
   ::ttnn::Tensor out = ::ttnn::reduce_scatter(
       input, scatterSplitDim, clusterAxis, meshDevice, mathOp, numLinks,
-      outputMemoryConfig, ::ttnn::ccl::Topology::Linear);
+      outputMemoryConfig,
+      ::tt::runtime::ttnn::operations::utils::toTTNNTopology(op->topology()));
   tensorPool.insert_or_assign(op->out()->global_id(), out);
 }
 } // namespace tt::runtime::ttnn::operations::ccl
@@ -28,8 +28,7 @@ void run(const ::tt::target::ttnn::Conv2dOp *op, ProgramContext &context) {
   // Use defaults for now, until compiler drives this.
   std::optional<::ttnn::DeviceComputeKernelConfig> computeConfig = std::nullopt;
 
-  ::ttnn::MemoryConfig outMemConfig =
-      ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+  ::ttnn::MemoryConfig outMemConfig = context.getMemoryConfig(op->out());
   DeviceVariant targetDevice =
       context.getTargetDevice(op->device()->global_id());
   ::ttnn::Tensor out = std::visit(
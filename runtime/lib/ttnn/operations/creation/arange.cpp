@@ -25,7 +25,7 @@ void run(const ::tt::target::ttnn::ArangeOp *op, ProgramContext &context) {
   }
 
   if (op->memcfg()) {
-    memoryConfig = utils::createMemoryConfig(op->memcfg(), op->out());
+    memoryConfig = context.getMemoryConfig(op->memcfg(), op->out());
   }
 
   if (op->device()) {
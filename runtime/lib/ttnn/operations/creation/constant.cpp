@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "operations/creation/constant.h"
+#include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/ttnn.h"
+#include "tt/runtime/ttnn/operations/utils.h"
+#include "tt/runtime/ttnn/utils.h"
+#include "tt/runtime/utils.h"
+#include "ttmlir/Target/TTNN/Target.h"
+
+namespace tt::runtime::ttnn::operations::creation {
+
+// Wraps the raw buffer in borrowed storage so that no copy of the constant is
+// made on the host. The owner keeps the (possibly mmap-ed) binary alive for as
+// long as any tensor borrows from it. The mapping is read-only, so the tensor
+// must not be modified in place.
+template <typename T>
+static ::tt::tt_metal::BorrowedStorage
+createBorrowedStorage(const uint8_t *data, size_t numElements,
+                      std::shared_ptr<void> owner) {
+  T *ptr = reinterpret_cast<T *>(const_cast<uint8_t *>(data));
+  return ::tt::tt_metal::BorrowedStorage(
+      ::tt::tt_metal::borrowed_buffer::Buffer<T>(ptr, numElements),
+      [owner] { (void)owner; }, [owner] { (void)owner; });
+}
+
+static ::tt::tt_metal::BorrowedStorage
+createBorrowedStorage(const ::tt::target::ttnn::TensorData *tensorData,
+                      size_t numElements, std::shared_ptr<void> owner) {
+  const uint8_t *data = tensorData->data()->data();
+  switch (tensorData->dtype()) {
+  case ::tt::target::DataType::Float32:
+    return createBorrowedStorage<float>(data, numElements, owner);
+  case ::tt::target::DataType::BFloat16:
+    return createBorrowedStorage<bfloat16>(data, numElements, owner);
+  case ::tt::target::DataType::UInt32:
+    return createBorrowedStorage<uint32_t>(data, numElements, owner);
+  case ::tt::target::DataType::UInt16:
+    return createBorrowedStorage<uint16_t>(data, numElements, owner);
+  case ::tt::target::DataType::UInt8:
+    return createBorrowedStorage<uint8_t>(data, numElements, owner);
+  case ::tt::target::DataType::Int32:
+    return createBorrowedStorage<int32_t>(data, numElements, owner);
+  default:
+    LOG_FATAL("Unsupported data type for constant tensor data");
+  }
+}
+
+static ::ttnn::Tensor
+createHostTensor(const ::tt::target::ttnn::TensorData *tensorData,
+                 const Binary &executableHandle) {
+  ::ttnn::Shape shape = utils::toTTNNShape(*tensorData->shape());
+  size_t numElements = shape.volume();
+  LOG_ASSERT(tensorData->data()->size() ==
+                 numElements * ::tt::runtime::utils::dataTypeElementSize(
+                                   tensorData->dtype()),
+             "Constant tensor data size mismatch");
+  return ::ttnn::Tensor(
+      createBorrowedStorage(tensorData, numElements, executableHandle.handle),
+      shape, ::tt::runtime::ttnn::utils::toTTNNDataType(tensorData->dtype()),
+      ::tt::runtime::ttnn::utils::toTTNNLayout(tensorData->layout()));
+}
+
+void run(const ::tt::target::ttnn::ConstantOp *op, ProgramContext &context) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
+  const Binary &executableHandle = context.getExecutableHandle();
+  const auto *tensorDataSection =
+      ::tt::target::ttnn::GetSizePrefixedTTNNBinary(
+          executableHandle.handle.get())
+          ->tensor_data();
+  LOG_ASSERT(tensorDataSection &&
+                 op->data_index() < tensorDataSection->size(),
+             "Constant tensor data index out of range: ", op->data_index());
+
+  ::ttnn::Tensor out =
+      createHostTensor(tensorDataSection->Get(op->data_index()),
+                       executableHandle);
+
+  // Data that could not be pre-tilized at compile time is converted here, on
+  // host, before upload.
+  ::ttnn::Layout layout =
+      ::tt::runtime::ttnn::utils::inferLayoutFromTileShape(op->out());
+  if (out.get_layout() != layout) {
+    out = ::ttnn::to_layout(out, layout, std::nullopt, std::nullopt,
+                            static_cast<::ttnn::IDevice *>(nullptr));
+  }
+
+  if (op->device()) {
+    LOG_ASSERT(op->memcfg(), "Memory config must be provided for device "
+                             "constant tensors");
+    std::optional<::ttnn::MemoryConfig> memoryConfig =
+        context.getMemoryConfig(op->memcfg(), op->out());
+    DeviceVariant targetDevice =
+        context.getTargetDevice(op->device()->global_id());
+    out = std::visit(
+        [&](auto &&targetDevice) -> ::ttnn::Tensor {
+          return ::ttnn::to_device(out, &(targetDevice.get()), memoryConfig);
+        },
+        targetDevice);
+  }
+
+  tensorPool.insert_or_assign(op->out()->global_id(), out);
+}
+} // namespace tt::runtime::ttnn::operations::creation
@@ -18,7 +18,8 @@ struct EmptyTensorConfig {
   const ::tt::target::DistributionStrategy *strategy = nullptr;
   std::optional<::ttnn::MemoryConfig> memoryConfig = std::nullopt;
 
-  EmptyTensorConfig(const ::tt::target::ttnn::EmptyOp *op)
+  EmptyTensorConfig(const ::tt::target::ttnn::EmptyOp *op,
+                    ProgramContext &context)
       : shape(::tt::runtime::ttnn::operations::utils::toTTNNShape(
             *op->out()->desc()->shape())),
         dtype(::tt::runtime::ttnn::operations::utils::getDataType(op->out())),
@@ -27,8 +28,7 @@ struct EmptyTensorConfig {
     if (op->device()) {
       LOG_ASSERT(op->memcfg(),
                  "Memory config must be provided when device is provided");
-      memoryConfig = ::tt::runtime::ttnn::operations::utils::createMemoryConfig(
-          op->memcfg(), op->out());
+      memoryConfig = context.getMemoryConfig(op->memcfg(), op->out());
     }
     validate();
   }
@@ -88,7 +88,7 @@ createEmptyOnSingleDevice(ProgramContext &context, EmptyTensorConfig &config,
 
 void run(const ::tt::target::ttnn::EmptyOp *op, ProgramContext &context) {
   ProgramTensorPool &tensorPool = context.getTensorPool();
-  EmptyTensorConfig config(op);
+  EmptyTensorConfig config(op, context);
   ::ttnn::Tensor out;
   if (config.numShards == 1) {
     out = createEmptyOnSingleDevice(context, config, op->device());
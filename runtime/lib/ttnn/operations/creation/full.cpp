@@ -19,7 +19,8 @@ struct FullTensorConfig {
   const ::tt::target::DistributionStrategy *strategy = nullptr;
   std::optional<::ttnn::MemoryConfig> memoryConfig = std::nullopt;
 
-  FullTensorConfig(const ::tt::target::ttnn::FullOp *op)
+  FullTensorConfig(const ::tt::target::ttnn::FullOp *op,
+                   ProgramContext &context)
       : shape(::tt::runtime::ttnn::operations::utils::toTTNNShape(
             *op->out()->desc()->shape())),
         dtype(::tt::runtime::ttnn::operations::utils::getDataType(op->out())),
@@ -28,7 +29,7 @@ struct FullTensorConfig {
         strategy(op->strategy()) {
 
     if (!utils::inSystemMemory(op->out())) {
-      memoryConfig = ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+      memoryConfig = context.getMemoryConfig(op->out());
     }
     validate();
   }
@@ -89,7 +90,7 @@ createFullOnSingleDevice(ProgramContext &context, FullTensorConfig &config,
 
 void run(const ::tt::target::ttnn::FullOp *op, ProgramContext &context) {
   ProgramTensorPool &tensorPool = context.getTensorPool();
-  FullTensorConfig config(op);
+  FullTensorConfig config(op, context);
   ::ttnn::Tensor out;
   const ::tt::target::DeviceRef *deviceRef =
       !utils::inSystemMemory(op->out()) ? op->device() : nullptr;
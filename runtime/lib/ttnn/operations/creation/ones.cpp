@@ -45,7 +45,7 @@ void run(const ::tt::target::ttnn::OnesOp *op, ProgramContext &context) {
   }
 
   if (op->memcfg()) {
-    memoryConfig = utils::createMemoryConfig(op->memcfg(), op->out());
+    memoryConfig = context.getMemoryConfig(op->memcfg(), op->out());
   }
 
   ::ttnn::Tensor out = ::ttnn::ones(shape, dtype, layout, device, memoryConfig);
@@ -44,7 +44,7 @@ void run(const ::tt::target::ttnn::ZerosOp *op, ProgramContext &context) {
   }
 
   if (op->memcfg()) {
-    memoryConfig = utils::createMemoryConfig(op->memcfg(), op->out());
+    memoryConfig = context.getMemoryConfig(op->memcfg(), op->out());
   }
 
   ::ttnn::Tensor out =
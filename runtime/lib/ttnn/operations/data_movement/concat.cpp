@@ -18,7 +18,7 @@ void run(const ::tt::target::ttnn::ConcatOp *op, ProgramContext &context) {
   }
   int32_t dim = op->dim();
   std::optional<tt::tt_metal::MemoryConfig> memoryConfig =
-      op->memory_config() ? std::make_optional(utils::createMemoryConfig(
+      op->memory_config() ? std::make_optional(context.getMemoryConfig(
                                 op->memory_config(), op->out()))
                           : std::nullopt;
   ::ttnn::Tensor out = ::ttnn::concat(inputs, dim, memoryConfig);
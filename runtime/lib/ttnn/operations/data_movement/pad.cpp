@@ -29,7 +29,7 @@ void run(const ::tt::target::ttnn::PadOp *op, ProgramContext &context) {
 
   std::optional<::tt::tt_metal::MemoryConfig> outputMemoryConfig =
       op->memcfg() ? std::make_optional(
-                         utils::createMemoryConfig(op->memcfg(), op->out()))
+                         context.getMemoryConfig(op->memcfg(), op->out()))
                    : std::nullopt;
 
   if (workaround::Env::get().usePaddingPairSignatureWithQueueId) {
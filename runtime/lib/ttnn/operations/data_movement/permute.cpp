@@ -19,7 +19,7 @@ void run(const ::tt::target::ttnn::PermuteOp *op, ProgramContext &context) {
   ::ttnn::SmallVector<int64_t> permutation(op->permutation()->begin(),
                                            op->permutation()->end());
   std::optional<tt::tt_metal::MemoryConfig> memoryConfig =
-      op->memory_config() ? std::make_optional(utils::createMemoryConfig(
+      op->memory_config() ? std::make_optional(context.getMemoryConfig(
                                 op->memory_config(), op->out()))
                           : std::nullopt;
   float padValue = op->pad_value();
@@ -12,7 +12,7 @@
 namespace tt::runtime::ttnn::operations::binary {
 
 static void runEltwiseBinaryOp(
-    const ::tt::target::ttnn::EltwiseOp *op, ProgramTensorPool &tensorPool,
+    const ::tt::target::ttnn::EltwiseOp *op, ProgramContext &context,
     const std::function<::ttnn::Tensor(
         const ::ttnn::Tensor &, const ::ttnn::Tensor &,
         const std::optional<const ::ttnn::DataType> &,
@@ -20,14 +20,14 @@ static void runEltwiseBinaryOp(
         std::optional<::ttnn::Tensor>,
         std::optional<::ttnn::operations::unary::FusedActivations>,
         std::optional<::ttnn::operations::unary::UnaryWithParam>)> &ttnnOp) {
-
+  ProgramTensorPool &tensorPool = context.getTensorPool();
   ::ttnn::Tensor *lhs = nullptr;
   ::ttnn::Tensor *rhs = nullptr;
   getEltwiseBinaryOpInputTensors(op, tensorPool, &lhs, &rhs);
 
   ::ttnn::DataType outputDataType = utils::getDataType(op->out());
   ::tt::tt_metal::MemoryConfig outputMemoryConfig =
-      ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+      context.getMemoryConfig(op->out());
 
   ::ttnn::Tensor out = ttnnOp(*lhs, *rhs, outputDataType, outputMemoryConfig,
                               std::nullopt, std::nullopt, std::nullopt);
@@ -35,77 +35,76 @@ static void runEltwiseBinaryOp(
 }
 
 void run(const ::tt::target::ttnn::EltwiseOp *op, ProgramContext &context) {
-  ProgramTensorPool &tensorPool = context.getTensorPool();
   switch (op->type()) {
   /* Eltwise Binary */
   case ::tt::target::ttnn::EltwiseOpType::Add: {
-    runEltwiseBinaryOp(op, tensorPool, ::ttnn::add);
+    runEltwiseBinaryOp(op, context, ::ttnn::add);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Multiply: {
-    runEltwiseBinaryOp(op, tensorPool, ::ttnn::multiply);
+    runEltwiseBinaryOp(op, context, ::ttnn::multiply);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Subtract: {
-    runEltwiseBinaryOp(op, tensorPool, ::ttnn::subtract);
+    runEltwiseBinaryOp(op, context, ::ttnn::subtract);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Equal: {
-    runEltwiseBinaryOp(op, tensorPool, ::ttnn::eq);
+    runEltwiseBinaryOp(op, context, ::ttnn::eq);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::NotEqual: {
-    runEltwiseBinaryOp(op, tensorPool, ::ttnn::ne);
+    runEltwiseBinaryOp(op, context, ::ttnn::ne);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::GreaterEqual: {
-    runEltwiseBinaryOp(op, tensorPool, ::ttnn::ge);
+    runEltwiseBinaryOp(op, context, ::ttnn::ge);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::GreaterThan: {
-    runEltwiseBinaryOp(op, tensorPool, ::ttnn::gt);
+    runEltwiseBinaryOp(op, context, ::ttnn::gt);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::LessEqual: {
-    runEltwiseBinaryOp(op, tensorPool, ::ttnn::le);
+    runEltwiseBinaryOp(op, context, ::ttnn::le);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::LessThan: {
-    runEltwiseBinaryOp(op, tensorPool, ::ttnn::lt);
+    runEltwiseBinaryOp(op, context, ::ttnn::lt);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Div: {
-    runEltwiseBinaryOp(op, tensorPool, ::ttnn::divide);
+    runEltwiseBinaryOp(op, context, ::ttnn::divide);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::LogicalAnd: {
-    runEltwiseBinaryOp(op, tensorPool, ::ttnn::logical_and);
+    runEltwiseBinaryOp(op, context, ::ttnn::logical_and);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::LogicalOr: {
-    runEltwiseBinaryOp(op, tensorPool, ::ttnn::logical_or);
+    runEltwiseBinaryOp(op, context, ::ttnn::logical_or);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::LogicalXor: {
-    runEltwiseBinaryOp(op, tensorPool, ::ttnn::logical_xor);
+    runEltwiseBinaryOp(op, context, ::ttnn::logical_xor);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::BitwiseAnd: {
     LOG_ASSERT(false, "Binary bitwise_and op not supported in ttnn. See "
                       "https://github.com/tenstorrent/tt-metal/issues/13582");
-    // runEltwiseBinaryOP(op, tensorPool, ::ttnn::bitwise_and);
+    // runEltwiseBinaryOP(op, context, ::ttnn::bitwise_and);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::BitwiseOr: {
     LOG_ASSERT(false, "Binary bitwise_or op not supported in ttnn. See "
                       "https://github.com/tenstorrent/tt-metal/issues/13582");
-    // runEltwiseBinaryOP(op, tensorPool, ::ttnn::bitwise_or);
+    // runEltwiseBinaryOP(op, context, ::ttnn::bitwise_or);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::BitwiseXor: {
     LOG_ASSERT(false, "Binary bitwise_xor op not supported in ttnn. See "
                       "https://github.com/tenstorrent/tt-metal/issues/13582");
-    // runEltwiseBinaryOP(op, tensorPool, ::ttnn::bitwise_xor);
+    // runEltwiseBinaryOP(op, context, ::ttnn::bitwise_xor);
     break;
   }
   default:
@@ -11,43 +11,42 @@
 namespace tt::runtime::ttnn::operations::binary::composite {
 
 static void runEltwiseBinaryCompositeOp(
-    const ::tt::target::ttnn::EltwiseOp *op, ProgramTensorPool &tensorPool,
+    const ::tt::target::ttnn::EltwiseOp *op, ProgramContext &context,
     const std::function<::ttnn::Tensor(
         const ::ttnn::Tensor &, const ::ttnn::Tensor &,
         const std::optional<::tt::tt_metal::MemoryConfig> &)> &ttnnOp) {
-
+  ProgramTensorPool &tensorPool = context.getTensorPool();
   ::ttnn::Tensor *lhs = nullptr;
   ::ttnn::Tensor *rhs = nullptr;
   getEltwiseBinaryOpInputTensors(op, tensorPool, &lhs, &rhs);
 
   ::tt::tt_metal::MemoryConfig outputMemoryConfig =
-      ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+      context.getMemoryConfig(op->out());
 
   ::ttnn::Tensor out = ttnnOp(*lhs, *rhs, outputMemoryConfig);
   tensorPool.insert_or_assign(op->out()->global_id(), out);
 }
 
 void run(const ::tt::target::ttnn::EltwiseOp *op, ProgramContext &context) {
-  ProgramTensorPool &tensorPool = context.getTensorPool();
   switch (op->type()) {
   case ::tt::target::ttnn::EltwiseOpType::Maximum: {
-    runEltwiseBinaryCompositeOp(op, tensorPool, ::ttnn::maximum);
+    runEltwiseBinaryCompositeOp(op, context, ::ttnn::maximum);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Minimum: {
-    runEltwiseBinaryCompositeOp(op, tensorPool, ::ttnn::minimum);
+    runEltwiseBinaryCompositeOp(op, context, ::ttnn::minimum);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Remainder: {
-    runEltwiseBinaryCompositeOp(op, tensorPool, ::ttnn::remainder);
+    runEltwiseBinaryCompositeOp(op, context, ::ttnn::remainder);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Scatter: {
-    runEltwiseBinaryCompositeOp(op, tensorPool, ::ttnn::scatter);
+    runEltwiseBinaryCompositeOp(op, context, ::ttnn::scatter);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Power: {
-    runEltwiseBinaryCompositeOp(op, tensorPool, ::ttnn::pow);
+    runEltwiseBinaryCompositeOp(op, context, ::ttnn::pow);
     break;
   }
   default:
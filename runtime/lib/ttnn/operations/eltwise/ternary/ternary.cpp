@@ -12,27 +12,27 @@
 namespace tt::runtime::ttnn::operations::ternary {
 
 static void runEltwiseTernaryWhereOp(
-    const ::tt::target::ttnn::EltwiseOp *op, ProgramTensorPool &tensorPool,
+    const ::tt::target::ttnn::EltwiseOp *op, ProgramContext &context,
     const std::function<::ttnn::Tensor(
         const ::ttnn::Tensor &, const ::ttnn::Tensor &, const ::ttnn::Tensor &,
         const std::optional<::tt::tt_metal::MemoryConfig> &)> &ttnnOp) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
   ::ttnn::Tensor *first = nullptr;
   ::ttnn::Tensor *second = nullptr;
   ::ttnn::Tensor *third = nullptr;
   getEltwiseTernaryOpInputTensors(op, tensorPool, &first, &second, &third);
 
   ::tt::tt_metal::MemoryConfig outputMemoryConfig =
-      ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+      context.getMemoryConfig(op->out());
 
   ::ttnn::Tensor out = ttnnOp(*first, *second, *third, outputMemoryConfig);
   tensorPool.insert_or_assign(op->out()->global_id(), out);
 }
 
 void run(const ::tt::target::ttnn::EltwiseOp *op, ProgramContext &context) {
-  ProgramTensorPool &tensorPool = context.getTensorPool();
   switch (op->type()) {
   case ::tt::target::ttnn::EltwiseOpType::Where: {
-    runEltwiseTernaryWhereOp(op, tensorPool, ::ttnn::where);
+    runEltwiseTernaryWhereOp(op, context, ::ttnn::where);
     break;
   }
   default:
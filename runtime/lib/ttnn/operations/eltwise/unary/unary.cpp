@@ -13,34 +13,34 @@
 namespace tt::runtime::ttnn::operations::unary {
 
 static void runEltwiseUnaryOp(
-    const ::tt::target::ttnn::EltwiseOp *op, ProgramTensorPool &tensorPool,
+    const ::tt::target::ttnn::EltwiseOp *op, ProgramContext &context,
     const std::function<
         ::ttnn::Tensor(const ::ttnn::Tensor &,
                        const std::optional<::tt::tt_metal::MemoryConfig> &,
                        const std::optional<::ttnn::Tensor> &)> &ttnnOp) {
-
+  ProgramTensorPool &tensorPool = context.getTensorPool();
   ::ttnn::Tensor *in = nullptr;
   getEltwiseUnaryOpInputTensor(op, tensorPool, &in);
 
   ::tt::tt_metal::MemoryConfig outputMemoryConfig =
-      ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+      context.getMemoryConfig(op->out());
 
   ::ttnn::Tensor out = ttnnOp(*in, outputMemoryConfig, std::nullopt);
   tensorPool.insert_or_assign(op->out()->global_id(), out);
 }
 
 static void runEltwiseUnaryWithFastAndApproximateModeOp(
-    const ::tt::target::ttnn::EltwiseOp *op, ProgramTensorPool &tensorPool,
+    const ::tt::target::ttnn::EltwiseOp *op, ProgramContext &context,
     const std::function<
         ::ttnn::Tensor(const ::ttnn::Tensor &, const bool,
                        const std::optional<::tt::tt_metal::MemoryConfig> &,
                        const std::optional<::ttnn::Tensor> &)> &ttnnOp) {
-
+  ProgramTensorPool &tensorPool = context.getTensorPool();
   ::ttnn::Tensor *in = nullptr;
   getEltwiseUnaryOpInputTensor(op, tensorPool, &in);
 
   ::tt::tt_metal::MemoryConfig outputMemoryConfig =
-      ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+      context.getMemoryConfig(op->out());
 
   ::ttnn::Tensor out =
       ttnnOp(*in, false /* parameter */, outputMemoryConfig, std::nullopt);
@@ -48,111 +48,111 @@ static void runEltwiseUnaryWithFastAndApproximateModeOp(
 }
 
 static void runEltwiseUnaryWithFloatParameterOp(
-    const ::tt::target::ttnn::EltwiseOp *op, ProgramTensorPool &tensorPool,
+    const ::tt::target::ttnn::EltwiseOp *op, ProgramContext &context,
     const std::function<::ttnn::Tensor(const ::ttnn::Tensor &, float,
                                        const ::tt::tt_metal::MemoryConfig &)>
         &ttnnOp) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
   ::ttnn::Tensor *in = nullptr;
   getEltwiseUnaryOpInputTensor(op, tensorPool, &in);
 
   float parameter = op->params_as_EltwiseOpWithFloatParams()->parameter();
   ::tt::tt_metal::MemoryConfig outputMemoryConfig =
-      ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+      context.getMemoryConfig(op->out());
   ::ttnn::Tensor out = ttnnOp(*in, parameter, outputMemoryConfig);
   tensorPool.insert_or_assign(op->out()->global_id(), out);
 }
 
 void run(const ::tt::target::ttnn::EltwiseOp *op, ProgramContext &context) {
-  ProgramTensorPool &tensorPool = context.getTensorPool();
   switch (op->type()) {
   case ::tt::target::ttnn::EltwiseOpType::Abs: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::abs);
+    runEltwiseUnaryOp(op, context, ::ttnn::abs);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Ceil: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::ceil);
+    runEltwiseUnaryOp(op, context, ::ttnn::ceil);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Cos: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::cos);
+    runEltwiseUnaryOp(op, context, ::ttnn::cos);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Floor: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::floor);
+    runEltwiseUnaryOp(op, context, ::ttnn::floor);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Gelu: {
-    runEltwiseUnaryWithFastAndApproximateModeOp(op, tensorPool, ::ttnn::gelu);
+    runEltwiseUnaryWithFastAndApproximateModeOp(op, context, ::ttnn::gelu);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::IsFinite: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::isfinite);
+    runEltwiseUnaryOp(op, context, ::ttnn::isfinite);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::LogicalNot: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::logical_not);
+    runEltwiseUnaryOp(op, context, ::ttnn::logical_not);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Neg: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::neg);
+    runEltwiseUnaryOp(op, context, ::ttnn::neg);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Relu: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::relu);
+    runEltwiseUnaryOp(op, context, ::ttnn::relu);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Sqrt: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::sqrt);
+    runEltwiseUnaryOp(op, context, ::ttnn::sqrt);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Rsqrt: {
-    runEltwiseUnaryWithFastAndApproximateModeOp(op, tensorPool, ::ttnn::rsqrt);
+    runEltwiseUnaryWithFastAndApproximateModeOp(op, context, ::ttnn::rsqrt);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Sigmoid: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::sigmoid);
+    runEltwiseUnaryOp(op, context, ::ttnn::sigmoid);
     break;
   }
 
   case ::tt::target::ttnn::EltwiseOpType::Sin: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::sin);
+    runEltwiseUnaryOp(op, context, ::ttnn::sin);
     break;
   }
 
   case ::tt::target::ttnn::EltwiseOpType::Reciprocal: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::reciprocal);
+    runEltwiseUnaryOp(op, context, ::ttnn::reciprocal);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Sign: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::sign);
+    runEltwiseUnaryOp(op, context, ::ttnn::sign);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Tan: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::tan);
+    runEltwiseUnaryOp(op, context, ::ttnn::tan);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Tanh: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::tanh);
+    runEltwiseUnaryOp(op, context, ::ttnn::tanh);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Exp: {
-    runEltwiseUnaryWithFastAndApproximateModeOp(op, tensorPool, ::ttnn::exp);
+    runEltwiseUnaryWithFastAndApproximateModeOp(op, context, ::ttnn::exp);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Log: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::log);
+    runEltwiseUnaryOp(op, context, ::ttnn::log);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Expm1: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::expm1);
+    runEltwiseUnaryOp(op, context, ::ttnn::expm1);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::LeakyRelu: {
-    runEltwiseUnaryWithFloatParameterOp(op, tensorPool, ::ttnn::leaky_relu);
+    runEltwiseUnaryWithFloatParameterOp(op, context, ::ttnn::leaky_relu);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::BitwiseNot: {
-    runEltwiseUnaryOp(op, tensorPool, ::ttnn::bitwise_not);
+    runEltwiseUnaryOp(op, context, ::ttnn::bitwise_not);
     break;
   }
   default:
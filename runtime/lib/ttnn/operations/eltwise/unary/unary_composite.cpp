@@ -12,50 +12,50 @@
 namespace tt::runtime::ttnn::operations::unary::composite {
 
 static void runEltwiseUnaryCompositeOp(
-    const ::tt::target::ttnn::EltwiseOp *op, ProgramTensorPool &tensorPool,
+    const ::tt::target::ttnn::EltwiseOp *op, ProgramContext &context,
     const std::function<::ttnn::Tensor(const ::ttnn::Tensor &,
                                        const ::tt::tt_metal::MemoryConfig &)>
         &ttnnOp) {
-
+  ProgramTensorPool &tensorPool = context.getTensorPool();
   ::ttnn::Tensor *in = nullptr;
   getEltwiseUnaryOpInputTensor(op, tensorPool, &in);
 
   ::tt::tt_metal::MemoryConfig outputMemoryConfig =
-      ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+      context.getMemoryConfig(op->out());
 
   ::ttnn::Tensor out = ttnnOp(*in, outputMemoryConfig);
   tensorPool.insert_or_assign(op->out()->global_id(), out);
 }
 
 static void runEltwiseUnaryCompositeClampOp(
-    const ::tt::target::ttnn::EltwiseOp *op, ProgramTensorPool &tensorPool,
+    const ::tt::target::ttnn::EltwiseOp *op, ProgramContext &context,
     const std::function<::ttnn::Tensor(const ::ttnn::Tensor &, float, float,
                                        const ::tt::tt_metal::MemoryConfig &)>
         &ttnnOp) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
   ::ttnn::Tensor *in = nullptr;
   getEltwiseUnaryOpInputTensor(op, tensorPool, &in);
 
   float min = op->params_as_ClampOpParams()->min();
   float max = op->params_as_ClampOpParams()->max();
   ::tt::tt_metal::MemoryConfig outputMemoryConfig =
-      ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+      context.getMemoryConfig(op->out());
   ::ttnn::Tensor out = ttnnOp(*in, min, max, outputMemoryConfig);
   tensorPool.insert_or_assign(op->out()->global_id(), out);
 }
 
 void run(const ::tt::target::ttnn::EltwiseOp *op, ProgramContext &context) {
-  ProgramTensorPool &tensorPool = context.getTensorPool();
   switch (op->type()) {
   case ::tt::target::ttnn::EltwiseOpType::Cbrt: {
-    runEltwiseUnaryCompositeOp(op, tensorPool, ::ttnn::cbrt);
+    runEltwiseUnaryCompositeOp(op, context, ::ttnn::cbrt);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Clamp: {
-    runEltwiseUnaryCompositeClampOp(op, tensorPool, ::ttnn::clamp);
+    runEltwiseUnaryCompositeClampOp(op, context, ::ttnn::clamp);
     break;
   }
   case ::tt::target::ttnn::EltwiseOpType::Log1p: {
-    runEltwiseUnaryCompositeOp(op, tensorPool, ::ttnn::log1p);
+    runEltwiseUnaryCompositeOp(op, context, ::ttnn::log1p);
     break;
   }
   default:
@@ -31,7 +31,7 @@ void run(const ::tt::target::ttnn::EmbeddingBackwardOp *op,
   }
   if (op->memcfg()) {
     memoryConfig =
-        std::make_optional(utils::createMemoryConfig(op->memcfg(), op->out()));
+        std::make_optional(context.getMemoryConfig(op->memcfg(), op->out()));
   }
   ::ttnn::Tensor out =
       ::ttnn::embedding_bw(input, weight, inGrad, dtype, memoryConfig);
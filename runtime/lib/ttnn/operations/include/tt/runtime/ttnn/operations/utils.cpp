@@ -29,54 +29,6 @@ bool inSystemMemory(const ::tt::target::TensorRef *tensorRef) {
       tensorRef->desc()->layout()->memory_desc()->data_type());
 }
 
-::tt::tt_metal::MemoryConfig
-createMemoryConfig(const ::tt::target::MemoryConfigDesc *memcfg,
-                   const ::tt::target::TensorRef *tensorRef) {
-
-  ::ttnn::TensorMemoryLayout tensorMemoryLayout =
-      ::tt::runtime::ttnn::utils::toTTNNTensorMemoryLayout(
-          memcfg->tensor_memory_layout());
-
-  ::ttnn::BufferType bufferType =
-      ::tt::runtime::ttnn::utils::toTTNNBufferType(memcfg->buffer_type());
-
-  const ::tt::target::LayoutDesc *layout = tensorRef->desc()->layout();
-  const ::flatbuffers::Vector<const tt::target::Dim2dRange *>
-      *targetCoreRangeSet = layout->core_range_set();
-  CoreRangeSet ttnnCoreRangeSet =
-      ::tt::runtime::ttnn::utils::toCoreRangeSet(targetCoreRangeSet);
-  const ::flatbuffers::Vector<int64_t> *shardShape =
-      memcfg->shard_spec()->shard_shape();
-  const ::tt::target::Dim2d *tileShape = layout->memory_desc()->tile_shape();
-
-  LOG_ASSERT(targetCoreRangeSet->size() == 1,
-             "Currently only single core range/grid is supported");
-
-  LOG_ASSERT(shardShape->size() == 2,
-             "Only 2D shard shape is supported in TTNN backend");
-
-  LOG_ASSERT(::tt::runtime::ttnn::utils::isValidTileShape(tileShape),
-             "Invalid tile shape");
-
-  std::array<uint32_t, 2> ttnnShardShape = {
-      static_cast<uint32_t>(shardShape->Get(0)),
-      static_cast<uint32_t>(shardShape->Get(1))};
-
-  ttnnShardShape[0] *= tileShape->y();
-  ttnnShardShape[1] *= tileShape->x();
-
-  ::tt::tt_metal::ShardSpec shardSpec(
-      ttnnCoreRangeSet, ttnnShardShape,
-      ::tt::tt_metal::ShardOrientation::ROW_MAJOR);
-
-  ::ttnn::MemoryConfig memoryConfig = {
-      tensorMemoryLayout, bufferType,
-      tensorMemoryLayout == tt_metal::TensorMemoryLayout::INTERLEAVED
-          ? std::nullopt
-          : std::make_optional(shardSpec)};
-  return memoryConfig;
-}
-
 ::tt::tt_metal::DistributedTensorConfig distributedTensorConfigFromFlatbuffer(
     const ::tt::target::DistributionStrategy *strategy) {
   switch (strategy->strategy_type()) {
@@ -102,4 +54,14 @@ createMemoryConfig(const ::tt::target::MemoryConfigDesc *memcfg,
   }
   }
 }
+
+::ttnn::ccl::Topology toTTNNTopology(::tt::target::ttnn::Topology topology) {
+  switch (topology) {
+  case ::tt::target::ttnn::Topology::Ring:
+    return ::ttnn::ccl::Topology::Ring;
+  case ::tt::target::ttnn::Topology::Linear:
+    return ::ttnn::ccl::Topology::Linear;
+  }
+  LOG_FATAL("Unsupported CCL topology");
+}
 } // namespace tt::runtime::ttnn::operations::utils
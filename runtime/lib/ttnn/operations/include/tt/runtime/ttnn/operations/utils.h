@@ -8,6 +8,7 @@
 #include "tt/runtime/detail/ttnn.h"
 #include "tt/runtime/ttnn/types.h"
 #include "ttmlir/Target/TTNN/program_generated.h"
+#include "ttnn/operations/ccl/ccl_host_types.hpp"
 #include "types_generated.h"
 #include <concepts>
 #include <cstdint>
@@ -23,13 +24,12 @@ getMemorySpace(const ::tt::target::TensorRef *tensorRef);
 
 ::ttnn::DataType getDataType(const ::tt::target::TensorRef *tensorRef);
 
-::tt::tt_metal::MemoryConfig
-createMemoryConfig(const ::tt::target::MemoryConfigDesc *memcfg,
-                   const ::tt::target::TensorRef *tensorRef);
-
 ::tt::tt_metal::DistributedTensorConfig distributedTensorConfigFromFlatbuffer(
     const ::tt::target::DistributionStrategy *strategy);
 
+::ttnn::ccl::Topology
+toTTNNTopology(::tt::target::ttnn::Topology topology);
+
 template <std::integral T>
 inline ::ttnn::Shape toTTNNShape(const flatbuffers::Vector<T> &vec) {
   std::vector<uint32_t> rawShape;
@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "operations/kv_cache/paged_update_cache.h"
+
+#include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/ttnn.h"
+
+namespace tt::runtime::ttnn::operations::kv_cache {
+void run(const ::tt::target::ttnn::PagedUpdateCacheOp *op,
+         ProgramContext &context) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
+
+  const ::ttnn::Tensor &cache = tensorPool.at(op->cache()->global_id());
+  const ::ttnn::Tensor &input = tensorPool.at(op->input()->global_id());
+  const ::ttnn::Tensor &updateIndex =
+      tensorPool.at(op->update_index()->global_id());
+  const ::ttnn::Tensor &pageTable =
+      tensorPool.at(op->page_table()->global_id());
+  DEBUG_ASSERT(cache.is_allocated());
+  DEBUG_ASSERT(input.is_allocated());
+
+  // The update positions are read by the kernel from the device tensor, so
+  // decoding does not have to wait for them on the host.
+  ::ttnn::experimental::paged_update_cache(
+      cache, input, /*update_idxs=*/{}, updateIndex,
+      /*share_cache=*/std::nullopt, pageTable);
+}
+} // namespace tt::runtime::ttnn::operations::kv_cache
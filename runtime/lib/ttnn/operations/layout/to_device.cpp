@@ -8,6 +8,8 @@
 #include "tt/runtime/ttnn/operations/utils.h"
 #include "tt/runtime/ttnn/utils.h"
 
+#include <type_traits>
+
 namespace tt::runtime::ttnn::operations::layout {
 void run(const ::tt::target::ttnn::ToDeviceOp *op, ProgramContext &context) {
   LOG_ASSERT(op->device(), "ToDeviceOp must have a device");
@@ -20,12 +22,22 @@ void run(const ::tt::target::ttnn::ToDeviceOp *op, ProgramContext &context) {
 
   if (op->memcfg()) {
     memoryConfig =
-        std::make_optional(utils::createMemoryConfig(op->memcfg(), op->out()));
+        std::make_optional(context.getMemoryConfig(op->memcfg(), op->out()));
   }
   DeviceVariant targetDevice =
       context.getTargetDevice(op->device()->global_id());
   ::ttnn::Tensor out = std::visit(
       [&](auto &&targetDevice) -> ::ttnn::Tensor {
+        // Multi-device host tensors are uploaded shard by shard, to all
+        // devices of the mesh at once.
+        using DeviceType = std::decay_t<decltype(targetDevice.get())>;
+        if constexpr (std::is_same_v<DeviceType, ::ttnn::MeshDevice>) {
+          if (inputTensor.storage_type() ==
+              ::tt::tt_metal::StorageType::MULTI_DEVICE_HOST) {
+            return ::tt::runtime::ttnn::utils::toMeshDevice(
+                inputTensor, targetDevice.get(), memoryConfig);
+          }
+        }
         return ::ttnn::to_device(inputTensor, &(targetDevice.get()),
                                  memoryConfig);
       },
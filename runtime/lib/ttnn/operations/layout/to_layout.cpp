@@ -40,7 +40,7 @@ void run(const ::tt::target::ttnn::ToLayoutOp *op, ProgramContext &context) {
 
   if (op->memcfg()) {
     memoryConfig =
-        std::make_optional(utils::createMemoryConfig(op->memcfg(), op->out()));
+        std::make_optional(context.getMemoryConfig(op->memcfg(), op->out()));
   }
 
   ::ttnn::Tensor out;
@@ -22,7 +22,7 @@ void run(const ::tt::target::ttnn::ToMemoryConfigOp *op,
              "Should not be converting memory config for host tensor");
 
   ::ttnn::MemoryConfig memoryConfig =
-      utils::createMemoryConfig(op->memcfg(), op->out());
+      context.getMemoryConfig(op->memcfg(), op->out());
   ::ttnn::Tensor out =
       ::ttnn::to_memory_config(inputTensor, memoryConfig, std::nullopt);
   tensorPool.insert_or_assign(op->out()->global_id(), out);
@@ -62,8 +62,7 @@ void run(const ::tt::target::ttnn::MaxPool2dOp *op, ProgramContext &context) {
         },
         targetDevice);
   }
-  ::ttnn::MemoryConfig outMemConfig =
-      ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+  ::ttnn::MemoryConfig outMemConfig = context.getMemoryConfig(op->out());
   ::ttnn::Tensor out =
       operation.invoke(::ttnn::DefaultQueueId, input, op->batch_size(),
                        op->input_height(), op->input_width(), op->channels(),
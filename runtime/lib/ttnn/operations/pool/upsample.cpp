@@ -30,7 +30,7 @@ void run(const ::tt::target::ttnn::UpsampleOp *op, ProgramContext &context) {
 
   std::string mode = op->mode()->str();
   std::optional<tt::tt_metal::MemoryConfig> memoryConfig =
-      op->memory_config() ? std::make_optional(utils::createMemoryConfig(
+      op->memory_config() ? std::make_optional(context.getMemoryConfig(
                                 op->memory_config(), op->out()))
                           : std::nullopt;
 
@@ -10,11 +10,11 @@
 
 namespace tt::runtime::ttnn::operations::reduction {
 static void runReductionProdOp(::tt::target::ttnn::ReductionProdOp const *op,
-                               ProgramTensorPool &tensorPool) {
-
+                               ProgramContext &context) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
   std::optional<::tt::tt_metal::MemoryConfig> outputMemoryConfig =
       op->memcfg() ? std::make_optional(
-                         utils::createMemoryConfig(op->memcfg(), op->out()))
+                         context.getMemoryConfig(op->memcfg(), op->out()))
                    : std::nullopt;
 
   const ::ttnn::Tensor &in = tensorPool.at(op->in()->global_id());
@@ -29,7 +29,6 @@ static void runReductionProdOp(::tt::target::ttnn::ReductionProdOp const *op,
 
 void run(const ::tt::target::ttnn::ReductionProdOp *op,
          ProgramContext &context) {
-  ProgramTensorPool &tensorPool = context.getTensorPool();
-  runReductionProdOp(op, tensorPool);
+  runReductionProdOp(op, context);
 }
 } // namespace tt::runtime::ttnn::operations::reduction
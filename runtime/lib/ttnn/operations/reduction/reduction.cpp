@@ -10,15 +10,16 @@
 
 namespace tt::runtime::ttnn::operations::reduction {
 static void runReductionOp(
-    ::tt::target::ttnn::ReductionOp const *op, ProgramTensorPool &tensorPool,
+    ::tt::target::ttnn::ReductionOp const *op, ProgramContext &context,
     const std::function<::ttnn::Tensor(
         const ::ttnn::Tensor &,
         const std::optional<std::variant<int, ::ttnn::SmallVector<int>>> &,
         const bool, const std::optional<::tt::tt_metal::MemoryConfig> &,
         const std::optional<::ttnn::DeviceComputeKernelConfig> &, float)>
         &ttnnOp) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
   ::tt::tt_metal::MemoryConfig outputMemoryConfig =
-      ::tt::runtime::ttnn::utils::createMemoryConfig(op->out());
+      context.getMemoryConfig(op->out());
   const ::ttnn::Tensor &in = tensorPool.at(op->in()->global_id());
   DEBUG_ASSERT(in.is_allocated());
 
@@ -36,22 +37,21 @@ static void runReductionOp(
 }
 
 void run(const ::tt::target::ttnn::ReductionOp *op, ProgramContext &context) {
-  ProgramTensorPool &tensorPool = context.getTensorPool();
   switch (op->type()) {
   case ::tt::target::ttnn::ReductionOpType::Sum: {
-    runReductionOp(op, tensorPool, ::ttnn::sum);
+    runReductionOp(op, context, ::ttnn::sum);
     break;
   }
   case ::tt::target::ttnn::ReductionOpType::Mean: {
-    runReductionOp(op, tensorPool, ::ttnn::mean);
+    runReductionOp(op, context, ::ttnn::mean);
     break;
   }
   case ::tt::target::ttnn::ReductionOpType::Max: {
-    runReductionOp(op, tensorPool, ::ttnn::max);
+    runReductionOp(op, context, ::ttnn::max);
     break;
   }
   case ::tt::target::ttnn::ReductionOpType::Min: {
-    runReductionOp(op, tensorPool, ::ttnn::min);
+    runReductionOp(op, context, ::ttnn::min);
     break;
   }
   }
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "operations/transformer/scaled_dot_product_attention.h"
+#include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/ttnn.h"
+#include "tt/runtime/ttnn/operations/utils.h"
+#include "tt/runtime/ttnn/utils.h"
+
+#include <optional>
+
+namespace tt::runtime::ttnn::operations::transformer {
+void run(const ::tt::target::ttnn::ScaledDotProductAttentionOp *op,
+         ProgramContext &context) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
+  const ::ttnn::Tensor &query = tensorPool.at(op->query()->global_id());
+  const ::ttnn::Tensor &key = tensorPool.at(op->key()->global_id());
+  const ::ttnn::Tensor &value = tensorPool.at(op->value()->global_id());
+  DEBUG_ASSERT(query.is_allocated());
+  DEBUG_ASSERT(key.is_allocated());
+  DEBUG_ASSERT(value.is_allocated());
+
+  std::optional<::ttnn::Tensor> attentionMask = std::nullopt;
+  if (op->attention_mask()) {
+    attentionMask = tensorPool.at(op->attention_mask()->global_id());
+  }
+  std::optional<float> scale = op->scale()
+                                   ? std::make_optional(*op->scale())
+                                   : std::nullopt;
+  ::tt::tt_metal::MemoryConfig outputMemoryConfig =
+      context.getMemoryConfig(op->out());
+
+  ::ttnn::Tensor out = ::ttnn::transformer::scaled_dot_product_attention(
+      query, key, value, attentionMask, op->is_causal(), scale,
+      outputMemoryConfig);
+  tensorPool.insert_or_assign(op->out()->global_id(), out);
+}
+
+void run(const ::tt::target::ttnn::PagedScaledDotProductAttentionDecodeOp *op,
+         ProgramContext &context) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
+  const ::ttnn::Tensor &query = tensorPool.at(op->query()->global_id());
+  const ::ttnn::Tensor &keyCache = tensorPool.at(op->key_cache()->global_id());
+  const ::ttnn::Tensor &valueCache =
+      tensorPool.at(op->value_cache()->global_id());
+  const ::ttnn::Tensor &pageTable =
+      tensorPool.at(op->page_table()->global_id());
+  const ::ttnn::Tensor &curPos = tensorPool.at(op->cur_pos()->global_id());
+  DEBUG_ASSERT(query.is_allocated());
+  DEBUG_ASSERT(keyCache.is_allocated());
+  DEBUG_ASSERT(valueCache.is_allocated());
+
+  std::optional<float> scale = op->scale()
+                                   ? std::make_optional(*op->scale())
+                                   : std::nullopt;
+  ::tt::tt_metal::MemoryConfig outputMemoryConfig =
+      context.getMemoryConfig(op->out());
+
+  // Decoding attends to every cached position up to cur_pos of each user,
+  // which is what the kernel's causal mode does.
+  ::ttnn::Tensor out =
+      ::ttnn::transformer::paged_scaled_dot_product_attention_decode(
+          query, keyCache, valueCache, pageTable, /*is_causal=*/true,
+          /*attn_mask=*/std::nullopt, curPos, scale, outputMemoryConfig);
+  tensorPool.insert_or_assign(op->out()->global_id(), out);
+}
+} // namespace tt::runtime::ttnn::operations::transformer
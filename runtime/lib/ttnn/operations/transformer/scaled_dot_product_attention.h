@@ -0,0 +1,18 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef RUNTIME_LIB_TTNN_OPERATIONS_TRANSFORMER_SCALED_DOT_PRODUCT_ATTENTION_H
+#define RUNTIME_LIB_TTNN_OPERATIONS_TRANSFORMER_SCALED_DOT_PRODUCT_ATTENTION_H
+
+#include "tt/runtime/ttnn/types.h"
+#include "ttmlir/Target/TTNN/program_generated.h"
+
+namespace tt::runtime::ttnn::operations::transformer {
+void run(const ::tt::target::ttnn::ScaledDotProductAttentionOp *op,
+         ProgramContext &context);
+void run(const ::tt::target::ttnn::PagedScaledDotProductAttentionDecodeOp *op,
+         ProgramContext &context);
+} // namespace tt::runtime::ttnn::operations::transformer
+
+#endif
@@ -8,6 +8,7 @@
 #include "operations/conv/conv2d.h"
 #include "operations/conv/conv_transpose2d.h"
 #include "operations/creation/arange.h"
+#include "operations/creation/constant.h"
 #include "operations/creation/empty.h"
 #include "operations/creation/full.h"
 #include "operations/creation/ones.h"
@@ -29,6 +30,7 @@
 #include "operations/embedding/embedding.h"
 #include "operations/embedding/embedding_backward.h"
 #include "operations/kv_cache/fill_cache.h"
+#include "operations/kv_cache/paged_update_cache.h"
 #include "operations/kv_cache/update_cache.h"
 #include "operations/layout/from_device.h"
 #include "operations/layout/to_device.h"
@@ -43,6 +45,7 @@
 #include "operations/pool/upsample.h"
 #include "operations/reduction/prod.h"
 #include "operations/reduction/reduction.h"
+#include "operations/transformer/scaled_dot_product_attention.h"
 #include "tt/runtime/detail/debug.h"
 #include "tt/runtime/detail/logger.h"
 #include "tt/runtime/ttnn/types.h"
@@ -50,6 +53,8 @@
 #include "tt/runtime/utils.h"
 #include "ttmlir/Target/TTNN/program_generated.h"
 
+#include <unordered_set>
+
 #ifdef TT_RUNTIME_ENABLE_PERF_TRACE
 #include "tracy/Tracy.hpp"
 #endif
@@ -57,16 +62,17 @@
 namespace tt::runtime::ttnn {
 using LogType = ::tt::runtime::logger::LogType;
 
-static void tracyLogOpLocation(const ::tt::target::ttnn::Operation *op) {
+static void tracyLogOpLocation(const Binary &binary,
+                               const ::tt::target::ttnn::Operation *op) {
 #ifdef TT_RUNTIME_ENABLE_PERF_TRACE
-  TracyMessage(op->loc_info()->c_str(), op->loc_info()->size());
+  std::string locInfo = utils::getOpLocInfo(binary, op);
+  TracyMessage(locInfo.c_str(), locInfo.size());
 #endif
 }
 
 static ::tt::target::ttnn::TTNNBinary const *getBinary(Flatbuffer binary) {
-  bool isTTNN = ::tt::target::ttnn::SizePrefixedTTNNBinaryBufferHasIdentifier(
-      binary.handle.get());
-  LOG_ASSERT(isTTNN, "Unsupported binary format");
+  LOG_ASSERT(binary.getFormat() == FlatbufferFormat::TTNN,
+             "Unsupported binary format");
   return ::tt::target::ttnn::GetSizePrefixedTTNNBinary(binary.handle.get());
 }
 
@@ -79,18 +85,24 @@ public:
       const std::vector<uint32_t> &programOutputs,
       ::ttnn::MeshDevice *meshDevice)
       : executableHandle(executableHandle),
-        context(ProgramContext(liveTensors, programInputs, programOutputs,
-                               meshDevice)) {}
+        context(ProgramContext(executableHandle, liveTensors, programInputs,
+                               programOutputs, meshDevice)) {}
 
   void runCallback(Binary &executableHandle,
                    const ::tt::target::ttnn::Operation *opContext,
                    ProgramContext *programContext);
 
-  void execute(const ::tt::target::ttnn::Program *program) {
-    for (const ::tt::target::ttnn::Operation *op : *program->operations()) {
+  // Runs the operations of `program`, except for the ones in `skippedOps`.
+  void execute(const ::tt::target::ttnn::Program *program,
+               const std::unordered_set<uint32_t> &skippedOps) {
+    for (uint32_t i = 0; i < program->operations()->size(); ++i) {
+      if (skippedOps.contains(i)) {
+        continue;
+      }
+      const ::tt::target::ttnn::Operation *op = program->operations()->Get(i);
       LOG_DEBUG(LogType::LogRuntimeTTNN,
                 "Executing operation: ", op->debug_info()->c_str());
-      tracyLogOpLocation(op);
+      tracyLogOpLocation(executableHandle, op);
       runOperation(op);
       runCallback(executableHandle, op, &context);
     }
@@ -190,6 +202,9 @@ void ProgramExecutor::runOperation(const ::tt::target::ttnn::Operation *op) {
   case ::tt::target::ttnn::OpType::FullOp: {
     return operations::creation::run(op->type_as_FullOp(), context);
   }
+  case ::tt::target::ttnn::OpType::ConstantOp: {
+    return operations::creation::run(op->type_as_ConstantOp(), context);
+  }
   case ::tt::target::ttnn::OpType::EltwiseOp: {
     return runEltwiseOperation(op->type_as_EltwiseOp());
   }
@@ -275,6 +290,17 @@ void ProgramExecutor::runOperation(const ::tt::target::ttnn::Operation *op) {
   case ::tt::target::ttnn::OpType::FillCacheOp: {
     return operations::kv_cache::run(op->type_as_FillCacheOp(), context);
   }
+  case ::tt::target::ttnn::OpType::PagedUpdateCacheOp: {
+    return operations::kv_cache::run(op->type_as_PagedUpdateCacheOp(), context);
+  }
+  case ::tt::target::ttnn::OpType::ScaledDotProductAttentionOp: {
+    return operations::transformer::run(
+        op->type_as_ScaledDotProductAttentionOp(), context);
+  }
+  case ::tt::target::ttnn::OpType::PagedScaledDotProductAttentionDecodeOp: {
+    return operations::transformer::run(
+        op->type_as_PagedScaledDotProductAttentionDecodeOp(), context);
+  }
   case ::tt::target::ttnn::OpType::UpsampleOp: {
     return operations::pool::run(op->type_as_UpsampleOp(), context);
   }
@@ -297,9 +323,26 @@ std::vector<Tensor> runProgram(::ttnn::MeshDevice &meshDevice,
   LOG_ASSERT(program->inputs()->size() == inputs.size(),
              "Program input size mismatch: ", program->inputs()->size(),
              " != ", inputs.size());
+  // Inputs passed in the layout of their contract are bound to the end of
+  // the conversions the program starts them with, which are skipped.
+  const auto *inputContracts = program->input_contracts();
+  LOG_ASSERT(!inputContracts ||
+                 inputContracts->size() == program->inputs()->size(),
+             "Program input contract size mismatch");
+  std::unordered_set<uint32_t> skippedOps;
   for (::tt::target::TensorRef const *input : *program->inputs()) {
-    auto [iter, inserted] =
-        liveTensors.try_emplace(input->global_id(), inputs[inputIndex++]);
+    ::ttnn::Tensor *tensor = inputs[inputIndex];
+    if (inputContracts) {
+      const ::tt::target::ttnn::InputContract *contract =
+          inputContracts->Get(inputIndex);
+      if (utils::hasLayoutOf(*tensor, contract->tensor())) {
+        input = contract->tensor();
+        skippedOps.insert(contract->skipped_ops()->begin(),
+                          contract->skipped_ops()->end());
+      }
+    }
+    inputIndex++;
+    auto [iter, inserted] = liveTensors.try_emplace(input->global_id(), tensor);
     LOG_ASSERT(inserted, "Duplicate input tensor");
     programInputs.push_back(input->global_id());
   }
@@ -309,7 +352,7 @@ std::vector<Tensor> runProgram(::ttnn::MeshDevice &meshDevice,
   }
   ProgramExecutor executor(executableHandle, liveTensors, programInputs,
                            programOutputs, &meshDevice);
-  executor.execute(program);
+  executor.execute(program, skippedOps);
   std::vector<Tensor> outputTensors = executor.gatherOutputTensors();
   return outputTensors;
 }
@@ -13,8 +13,15 @@
 #include "tt/runtime/utils.h"
 #include "ttmlir/Target/TTNN/Target.h"
 #include "ttmlir/Version.h"
+#include "ttnn/operations/data_movement/slice/slice.hpp"
 #include "ttnn/tensor/types.hpp"
 
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <optional>
+#include <string>
+
 namespace tt::runtime::ttnn {
 
 using ::tt::runtime::DeviceRuntime;
@@ -65,16 +72,27 @@ static StorageType createStorage(void *ptr, std::uint32_t numElements,
   case ::tt::target::DataType::UInt16:
     return createStorage<StorageType>(static_cast<uint16_t *>(ptr),
                                       numElements);
+  case ::tt::target::DataType::Int32:
+    return createStorage<StorageType>(static_cast<int32_t *>(ptr),
+                                      numElements);
   default:
     LOG_FATAL("Unsupported data type");
   }
 }
 
+// Checks that callers describe the elements of their data consistently.
+static void checkItemsize(std::uint32_t itemsize,
+                          ::tt::target::DataType dataType) {
+  LOG_ASSERT(itemsize == ::tt::runtime::utils::dataTypeElementSize(dataType),
+             "Item size ", itemsize, " does not match the data type");
+}
+
 static ::ttnn::Tensor
 createOwnedTensor(std::shared_ptr<void> data,
                   std::vector<std::uint32_t> const &shape,
                   std::vector<std::uint32_t> const &stride,
                   std::uint32_t itemsize, ::tt::target::DataType dataType) {
+  checkItemsize(itemsize, dataType);
   std::uint32_t numElements = shape[0] * stride[0];
 
   return ::ttnn::Tensor(
@@ -83,6 +101,85 @@ createOwnedTensor(std::shared_ptr<void> data,
       ::ttnn::Layout::ROW_MAJOR);
 }
 
+// Returns whether the elements of a tensor of `shape` laid out with `stride`
+// are contiguous in memory.
+static bool isContiguous(std::vector<std::uint32_t> const &shape,
+                         std::vector<std::uint32_t> const &stride) {
+  std::uint32_t expectedStride = 1;
+  for (std::size_t i = shape.size(); i-- > 0;) {
+    if (shape[i] != 1 && stride[i] != expectedStride) {
+      return false;
+    }
+    expectedStride *= shape[i];
+  }
+  return true;
+}
+
+// Creates the owned storage of a shard of `shape` starting at `ptr` in the
+// data of the full tensor, laid out with the strides `stride` of the full
+// tensor. Multi-device host storage only holds owned buffers, so the shard is
+// always copied: in one go if it is contiguous, row by row otherwise.
+template <typename ElementType>
+static ::tt::tt_metal::Storage
+createShardStorage(ElementType const *ptr,
+                   std::vector<std::uint32_t> const &shape,
+                   std::vector<std::uint32_t> const &stride) {
+  std::uint32_t numElements = std::accumulate(
+      shape.begin(), shape.end(), 1u, std::multiplies<std::uint32_t>());
+  if (isContiguous(shape, stride)) {
+    return OwnedStorage(::tt::tt_metal::owned_buffer::create<ElementType>(
+        std::vector<ElementType>(ptr, ptr + numElements)));
+  }
+
+  std::size_t rank = shape.size();
+  std::uint32_t rowSize = shape[rank - 1];
+  std::vector<ElementType> shardData(numElements);
+  std::vector<std::uint32_t> index(rank, 0);
+  for (std::uint32_t offset = 0; offset < numElements; offset += rowSize) {
+    ElementType const *row = ptr;
+    for (std::size_t i = 0; i + 1 < rank; ++i) {
+      row += index[i] * stride[i];
+    }
+    for (std::uint32_t j = 0; j < rowSize; ++j) {
+      shardData[offset + j] = row[j * stride[rank - 1]];
+    }
+    for (std::size_t i = rank - 1; i-- > 0;) {
+      if (++index[i] < shape[i]) {
+        break;
+      }
+      index[i] = 0;
+    }
+  }
+  return OwnedStorage(
+      ::tt::tt_metal::owned_buffer::create<ElementType>(std::move(shardData)));
+}
+
+static ::tt::tt_metal::Storage
+createShardStorage(void const *data, std::size_t offset,
+                   std::vector<std::uint32_t> const &shape,
+                   std::vector<std::uint32_t> const &stride,
+                   ::tt::target::DataType dataType) {
+  switch (dataType) {
+  case ::tt::target::DataType::Float32:
+    return createShardStorage(static_cast<float const *>(data) + offset, shape,
+                              stride);
+  case ::tt::target::DataType::BFloat16:
+    return createShardStorage(static_cast<bfloat16 const *>(data) + offset,
+                              shape, stride);
+  case ::tt::target::DataType::UInt32:
+    return createShardStorage(static_cast<uint32_t const *>(data) + offset,
+                              shape, stride);
+  case ::tt::target::DataType::UInt16:
+    return createShardStorage(static_cast<uint16_t const *>(data) + offset,
+                              shape, stride);
+  case ::tt::target::DataType::Int32:
+    return createShardStorage(static_cast<int32_t const *>(data) + offset,
+                              shape, stride);
+  default:
+    LOG_FATAL("Unsupported data type");
+  }
+}
+
 static Tensor createNullTensor() {
   return Tensor(nullptr, nullptr, DeviceRuntime::TTNN);
 }
@@ -108,9 +205,8 @@ createMemoryView(tt::tt_metal::detail::MemoryView const &memoryView) {
 }
 
 static ::tt::target::ttnn::TTNNBinary const *getBinary(Flatbuffer binary) {
-  bool isTTNN = ::tt::target::ttnn::SizePrefixedTTNNBinaryBufferHasIdentifier(
-      binary.handle.get());
-  LOG_ASSERT(isTTNN, "Unsupported binary format");
+  LOG_ASSERT(binary.getFormat() == FlatbufferFormat::TTNN,
+             "Unsupported binary format");
   return ::tt::target::ttnn::GetSizePrefixedTTNNBinary(binary.handle.get());
 }
 
@@ -119,6 +215,7 @@ Tensor createTensor(std::shared_ptr<void> data,
                     std::vector<std::uint32_t> const &shape,
                     std::vector<std::uint32_t> const &stride,
                     std::uint32_t itemsize, ::tt::target::DataType dataType) {
+  checkItemsize(itemsize, dataType);
   std::uint32_t numElements = shape[0] * stride[0];
 
   auto tensor = std::make_shared<::ttnn::Tensor>(
@@ -153,6 +250,79 @@ createTensor(std::vector<std::shared_ptr<void>> &data,
                 DeviceRuntime::TTNN);
 }
 
+// Create an owned multi-device host tensor from user-owned data of the full
+// tensor. Each device's shard is copied straight out of the user data, all of
+// them concurrently, without materializing the full tensor first. Devices
+// along a replicated mesh axis share their shards.
+Tensor createTensor(std::shared_ptr<void> data,
+                    std::vector<std::uint32_t> const &shape,
+                    std::vector<std::uint32_t> const &stride,
+                    std::uint32_t itemsize, ::tt::target::DataType dataType,
+                    std::vector<std::uint32_t> const &meshShape,
+                    std::vector<std::int64_t> const &shardDims) {
+  LOG_ASSERT(meshShape.size() == 2, "Only 2D meshes are supported");
+  LOG_ASSERT(shardDims.size() == meshShape.size(),
+             "Expected a shard dim per mesh axis");
+  LOG_ASSERT(shape.size() == stride.size(), "Shape and stride rank mismatch");
+  checkItemsize(itemsize, dataType);
+
+  std::vector<std::uint32_t> shardShape(shape);
+  // Number of distinct shards along each mesh axis.
+  std::array<std::uint32_t, 2> numShards = {1, 1};
+  for (std::size_t axis = 0; axis < meshShape.size(); ++axis) {
+    std::int64_t dim = shardDims[axis];
+    if (dim < 0) {
+      continue;
+    }
+    LOG_ASSERT(static_cast<std::size_t>(dim) < shape.size(),
+               "Shard dim out of range: ", dim);
+    LOG_ASSERT(shardShape[dim] == shape[dim], "Tensor dim ", dim,
+               " is sharded along both mesh axes");
+    LOG_ASSERT(shape[dim] % meshShape[axis] == 0, "Tensor dim ", dim,
+               " does not divide evenly over mesh axis ", axis);
+    shardShape[dim] /= meshShape[axis];
+    numShards[axis] = meshShape[axis];
+  }
+
+  std::vector<::ttnn::Tensor> shards(numShards[0] * numShards[1]);
+  utils::parallelFor(shards.size(), [&](std::size_t i) {
+    std::array<std::size_t, 2> meshCoord = {i / numShards[1],
+                                            i % numShards[1]};
+    std::size_t offset = 0;
+    for (std::size_t axis = 0; axis < meshShape.size(); ++axis) {
+      if (shardDims[axis] >= 0) {
+        offset += meshCoord[axis] * shardShape[shardDims[axis]] *
+                  stride[shardDims[axis]];
+      }
+    }
+    shards[i] = ::ttnn::Tensor(
+        createShardStorage(data.get(), offset, shardShape, stride, dataType),
+        ::ttnn::Shape(shardShape), utils::toTTNNDataType(dataType),
+        ::ttnn::Layout::ROW_MAJOR);
+  });
+
+  std::vector<::ttnn::Tensor> tensorShards;
+  tensorShards.reserve(meshShape[0] * meshShape[1]);
+  for (std::uint32_t row = 0; row < meshShape[0]; ++row) {
+    for (std::uint32_t col = 0; col < meshShape[1]; ++col) {
+      tensorShards.push_back(shards[(row % numShards[0]) * numShards[1] +
+                                    col % numShards[1]]);
+    }
+  }
+  DistributedTensorConfig distributionStrategy =
+      shards.size() == 1
+          ? DistributedTensorConfig(
+                ::tt::tt_metal::ReplicateTensor(tensorShards.size()))
+          : DistributedTensorConfig(::tt::tt_metal::ShardTensor2D(
+                ::tt::tt_metal::ShardMesh(meshShape[0], meshShape[1])));
+  std::shared_ptr<::ttnn::Tensor> tensor = std::make_shared<::ttnn::Tensor>(
+      ::ttnn::distributed::create_multi_device_tensor(
+          tensorShards, ::tt::tt_metal::StorageType::MULTI_DEVICE_HOST,
+          distributionStrategy));
+  return Tensor(std::static_pointer_cast<void>(tensor), nullptr,
+                DeviceRuntime::TTNN);
+}
+
 // Create an owned empty tensor on host/device
 Tensor createTensor(Device device, Layout layout,
                     std::vector<std::uint32_t> const &shape,
@@ -331,32 +501,54 @@ Tensor toLayout(Tensor tensor, Device device, Layout layout) {
                 DeviceRuntime::TTNN);
 }
 
-Layout getLayout(Binary executableHandle, std::uint32_t programIndex,
-                 std::uint32_t inputIndex) {
-  const ::tt::target::ttnn::TTNNBinary &fbb = *getBinary(executableHandle);
-  LOG_ASSERT(programIndex < fbb.programs()->size(), "Invalid program index");
-  const ::tt::target::ttnn::Program *program =
-      fbb.programs()->Get(programIndex);
-  LOG_ASSERT(inputIndex < program->inputs()->size(), "Invalid input index");
-  const ::tt::target::TensorRef *input = program->inputs()->Get(inputIndex);
-
-  ::ttnn::BufferType inputBufferType = utils::toTTNNBufferType(
-      input->desc()->layout()->memory_desc()->memory_space());
-  ::ttnn::Layout inputLayout = utils::inferLayoutFromTileShape(input);
-  ::ttnn::DataType inputDataType = utils::toTTNNDataType(
-      input->desc()->layout()->memory_desc()->data_type());
-  std::optional<::ttnn::MemoryConfig> inputMemoryConfig = std::nullopt;
-  if (inputBufferType != ::ttnn::BufferType::SYSTEM_MEMORY) {
-    inputMemoryConfig = utils::createMemoryConfig(input);
+static Layout createLayout(const ::tt::target::TensorRef *tensorRef) {
+  ::ttnn::BufferType bufferType = utils::toTTNNBufferType(
+      tensorRef->desc()->layout()->memory_desc()->memory_space());
+  ::ttnn::Layout layout = utils::inferLayoutFromTileShape(tensorRef);
+  ::ttnn::DataType dataType = utils::toTTNNDataType(
+      tensorRef->desc()->layout()->memory_desc()->data_type());
+  std::optional<::ttnn::MemoryConfig> memoryConfig = std::nullopt;
+  if (bufferType != ::ttnn::BufferType::SYSTEM_MEMORY) {
+    memoryConfig = utils::createMemoryConfig(tensorRef);
   }
 
   std::shared_ptr<LayoutDesc> layoutDesc = std::make_shared<LayoutDesc>(
-      inputBufferType, inputLayout, inputDataType, inputMemoryConfig);
+      bufferType, layout, dataType, memoryConfig);
 
   return Layout(std::static_pointer_cast<void>(layoutDesc),
                 DeviceRuntime::TTNN);
 }
 
+static const ::tt::target::ttnn::Program *
+getProgram(Binary executableHandle, std::uint32_t programIndex) {
+  const ::tt::target::ttnn::TTNNBinary &fbb = *getBinary(executableHandle);
+  LOG_ASSERT(programIndex < fbb.programs()->size(), "Invalid program index");
+  return fbb.programs()->Get(programIndex);
+}
+
+Layout getLayout(Binary executableHandle, std::uint32_t programIndex,
+                 std::uint32_t inputIndex) {
+  const ::tt::target::ttnn::Program *program =
+      getProgram(executableHandle, programIndex);
+  LOG_ASSERT(inputIndex < program->inputs()->size(), "Invalid input index");
+  return createLayout(program->inputs()->Get(inputIndex));
+}
+
+Layout getPreparedInputLayout(Binary executableHandle,
+                              std::uint32_t programIndex,
+                              std::uint32_t inputIndex) {
+  const ::tt::target::ttnn::Program *program =
+      getProgram(executableHandle, programIndex);
+  LOG_ASSERT(inputIndex < program->inputs()->size(), "Invalid input index");
+  // Binaries without contracts only take inputs in the program input layout.
+  if (!program->input_contracts()) {
+    return createLayout(program->inputs()->Get(inputIndex));
+  }
+  LOG_ASSERT(program->input_contracts()->size() == program->inputs()->size(),
+             "Program input contract size mismatch");
+  return createLayout(program->input_contracts()->Get(inputIndex)->tensor());
+}
+
 void memcpy(void *dst, Tensor src) {
   const ::ttnn::Tensor &srcTensor = src.as<::ttnn::Tensor>(DeviceRuntime::TTNN);
   if (utils::isOnHost(srcTensor.storage_type())) {
@@ -401,10 +593,10 @@ std::string getOpDebugString(OpContext opContextHandle) {
   return std::string(opContext.debug_info()->c_str());
 }
 
-std::string getOpLocInfo(OpContext opContextHandle) {
+std::string getOpLocInfo(Binary executableHandle, OpContext opContextHandle) {
   auto const &opContext =
       opContextHandle.as<::tt::target::ttnn::Operation>(DeviceRuntime::TTNN);
-  return std::string(opContext.loc_info()->c_str());
+  return utils::getOpLocInfo(executableHandle, &opContext);
 }
 
 Tensor getOpOutputTensor(OpContext opContextHandle,
@@ -459,6 +651,10 @@ Tensor getOpOutputTensor(OpContext opContextHandle,
     globalId = opContext.type_as_FullOp()->out()->global_id();
     break;
   }
+  case ::tt::target::ttnn::OpType::ConstantOp: {
+    globalId = opContext.type_as_ConstantOp()->out()->global_id();
+    break;
+  }
   case ::tt::target::ttnn::OpType::EltwiseOp: {
     globalId = opContext.type_as_EltwiseOp()->out()->global_id();
     break;
@@ -479,6 +675,17 @@ Tensor getOpOutputTensor(OpContext opContextHandle,
     globalId = opContext.type_as_SoftmaxOp()->out()->global_id();
     break;
   }
+  case ::tt::target::ttnn::OpType::ScaledDotProductAttentionOp: {
+    globalId =
+        opContext.type_as_ScaledDotProductAttentionOp()->out()->global_id();
+    break;
+  }
+  case ::tt::target::ttnn::OpType::PagedScaledDotProductAttentionDecodeOp: {
+    globalId = opContext.type_as_PagedScaledDotProductAttentionDecodeOp()
+                   ->out()
+                   ->global_id();
+    break;
+  }
   case ::tt::target::ttnn::OpType::TransposeOp: {
     globalId = opContext.type_as_TransposeOp()->out()->global_id();
     break;
@@ -550,14 +757,29 @@ std::vector<Tensor> submit(Device deviceHandle, Binary executableHandle,
   ::ttnn::MeshDevice &meshDevice =
       deviceHandle.as<::ttnn::MeshDevice>(DeviceRuntime::TTNN);
 
-  // Convert input tensors to the layout expected by the program
+  const ::tt::target::ttnn::Program *program =
+      getProgram(executableHandle, programIndex);
+  const auto *inputContracts = program->input_contracts();
+  LOG_ASSERT(!inputContracts || inputContracts->size() == inputHandles.size(),
+             "Program input contract size mismatch");
+
+  // Convert input tensors to the layout expected by the program, unless they
+  // already are in the layout of their contract, in which case the program
+  // skips its own conversions of them.
   std::vector<Tensor> inputsWithLayout;
   inputsWithLayout.reserve(inputHandles.size());
   std::transform(
       inputHandles.begin(), inputHandles.end(),
       std::back_inserter(inputsWithLayout), [&](const Tensor &input) -> Tensor {
+        std::uint32_t inputIndex = inputsWithLayout.size();
+        if (inputContracts &&
+            utils::hasLayoutOf(
+                input.as<::ttnn::Tensor>(DeviceRuntime::TTNN),
+                inputContracts->Get(inputIndex)->tensor())) {
+          return input;
+        }
         Layout inputLayout = ::tt::runtime::ttnn::getLayout(
-            executableHandle, programIndex, inputsWithLayout.size());
+            executableHandle, programIndex, inputIndex);
         return ::tt::runtime::ttnn::toLayout(input, deviceHandle, inputLayout);
       });
 
@@ -574,4 +796,121 @@ std::vector<Tensor> submit(Device deviceHandle, Binary executableHandle,
   return outputs;
 }
 
+// Returns the length of the bucketed dimensions of the inputs, which all
+// have the same length.
+static std::uint32_t
+getBucketedLength(const ::tt::target::ttnn::ShapeBucket *bucket,
+                  std::vector<Tensor> const &inputHandles) {
+  std::optional<std::uint32_t> length;
+  for (std::uint32_t i = 0; i < inputHandles.size(); ++i) {
+    const ::ttnn::Tensor &input =
+        inputHandles[i].as<::ttnn::Tensor>(DeviceRuntime::TTNN);
+    for (std::uint32_t dim : *bucket->input_dims()->Get(i)->dims()) {
+      LOG_ASSERT(dim < input.get_logical_shape().rank(), "Input ", i,
+                 " has no bucketed dimension ", dim);
+      std::uint32_t size = input.get_logical_shape()[dim];
+      LOG_ASSERT(!length || *length == size,
+                 "Bucketed dimensions of the inputs differ in length");
+      length = size;
+    }
+  }
+  LOG_ASSERT(length, "Program has no bucketed input dimensions");
+  return *length;
+}
+
+std::vector<Tensor> submitBucketed(Device deviceHandle, Binary executableHandle,
+                                   std::string const &group,
+                                   std::vector<Tensor> const &inputHandles) {
+  const ::tt::target::ttnn::TTNNBinary &fbb = *getBinary(executableHandle);
+
+  // Pick the smallest bucket the inputs fit in.
+  std::optional<std::uint32_t> programIndex;
+  const ::tt::target::ttnn::ShapeBucket *bucket = nullptr;
+  std::uint32_t length = 0;
+  for (std::uint32_t i = 0; i < fbb.programs()->size(); ++i) {
+    const ::tt::target::ttnn::ShapeBucket *candidate =
+        fbb.programs()->Get(i)->bucket();
+    if (!candidate || candidate->group()->str() != group) {
+      continue;
+    }
+    LOG_ASSERT(candidate->input_dims()->size() == inputHandles.size(),
+               "Expected ", candidate->input_dims()->size(), " inputs, got ",
+               inputHandles.size());
+    if (!bucket) {
+      length = getBucketedLength(candidate, inputHandles);
+    }
+    if (candidate->size() >= length &&
+        (!bucket || candidate->size() < bucket->size())) {
+      programIndex = i;
+      bucket = candidate;
+    }
+  }
+  LOG_ASSERT(programIndex, "No shape bucket of ", group, " fits length ",
+             length);
+
+  // Pad the bucketed dimensions of the inputs up to the bucket size.
+  const ::tt::target::ttnn::Program *program =
+      fbb.programs()->Get(*programIndex);
+  std::vector<Tensor> paddedInputs;
+  paddedInputs.reserve(inputHandles.size());
+  for (std::uint32_t i = 0; i < inputHandles.size(); ++i) {
+    const ::ttnn::Tensor &input =
+        inputHandles[i].as<::ttnn::Tensor>(DeviceRuntime::TTNN);
+    const auto *expectedShape = program->inputs()->Get(i)->desc()->shape();
+    const auto *dims = bucket->input_dims()->Get(i)->dims();
+    LOG_ASSERT(input.get_logical_shape().rank() == expectedShape->size(),
+               "Input ", i, " has rank ", input.get_logical_shape().rank(),
+               ", expected ", expectedShape->size());
+    std::vector<std::pair<uint32_t, uint32_t>> padding;
+    for (std::uint32_t dim = 0; dim < expectedShape->size(); ++dim) {
+      std::uint32_t size = input.get_logical_shape()[dim];
+      bool bucketed = std::find(dims->begin(), dims->end(), dim) != dims->end();
+      LOG_ASSERT(bucketed || size == expectedShape->Get(dim),
+                 "Input ", i, " has size ", size, " in dimension ", dim,
+                 ", expected ", expectedShape->Get(dim));
+      padding.emplace_back(0, bucketed ? bucket->size() - size : 0);
+    }
+    if (dims->size() == 0 || length == bucket->size()) {
+      paddedInputs.push_back(inputHandles[i]);
+      continue;
+    }
+    auto padded = std::make_shared<::ttnn::Tensor>(
+        ::ttnn::pad(::ttnn::DefaultQueueId, input, padding,
+                    bucket->input_pad_values()->Get(i),
+                    /*use_multicore=*/true, std::nullopt));
+    paddedInputs.push_back(Tensor(std::static_pointer_cast<void>(padded),
+                                  nullptr, DeviceRuntime::TTNN));
+  }
+
+  std::vector<Tensor> outputs = ::tt::runtime::ttnn::submit(
+      deviceHandle, executableHandle, *programIndex, paddedInputs);
+  if (length == bucket->size()) {
+    return outputs;
+  }
+
+  // Slice the padding off the bucketed dimensions of the outputs.
+  for (std::uint32_t i = 0; i < outputs.size(); ++i) {
+    const auto *dims = bucket->output_dims()->Get(i)->dims();
+    if (dims->size() == 0) {
+      continue;
+    }
+    const ::ttnn::Tensor &output =
+        outputs[i].as<::ttnn::Tensor>(DeviceRuntime::TTNN);
+    const ::ttnn::Shape &shape = output.get_logical_shape();
+    ::ttnn::SmallVector<int32_t> begins(shape.rank(), 0);
+    ::ttnn::SmallVector<int32_t> ends(shape.cbegin(), shape.cend());
+    ::ttnn::SmallVector<int32_t> step(shape.rank(), 1);
+    for (std::uint32_t dim : *dims) {
+      LOG_ASSERT(dim < shape.rank(), "Output ", i,
+                 " has no bucketed dimension ", dim);
+      ends[dim] = length;
+    }
+    auto sliced = std::make_shared<::ttnn::Tensor>(
+        ::ttnn::slice(output, begins, ends, step));
+    outputs[i] = Tensor(std::static_pointer_cast<void>(sliced), nullptr,
+                        DeviceRuntime::TTNN);
+  }
+  return outputs;
+}
+
 } // namespace tt::runtime::ttnn
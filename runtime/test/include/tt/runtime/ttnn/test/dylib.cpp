@@ -61,9 +61,9 @@ std::vector<Tensor> runSoProgram(void *so, std::string func_name,
   // Get function from the shared object
   //
   using ForwardFunctionWithDevice = std::vector<::ttnn::Tensor> (*)(
-      std::vector<::ttnn::Tensor>, ::ttnn::IDevice *);
+      const std::vector<::ttnn::Tensor> &, ::ttnn::IDevice *);
   using ForwardFunctionNoDevice =
-      std::vector<::ttnn::Tensor> (*)(std::vector<::ttnn::Tensor>);
+      std::vector<::ttnn::Tensor> (*)(const std::vector<::ttnn::Tensor> &);
 
   const char *dlsym_error;
   void *symbol;
@@ -4,6 +4,7 @@
 
 import pytest
 import ttrt
+import ttrt.binary
 import ttrt.runtime
 import torch
 from ttrt.common.util import *
@@ -200,3 +201,158 @@ def test_runtime_stitching_eltwise_binary_op_chain(helper: Helper, request):
     )
     assert_pcc(golden, torch_result_tensor, threshold=0.99)
     helper.teardown()
+
+
+def test_runtime_stitching_prepared_inputs(helper: Helper, request):
+    binary_path = f"{TT_MLIR_HOME}/build/test/ttmlir/Silicon/TTNN/n150/runtime_stitching/Output/eltwise_binary_op_chain.mlir.tmp.ttnn"
+    helper.initialize(request.node.name, binary_path)
+    helper.check_constraints()
+
+    first_program: Binary.Program = helper.binary.get_program(0)
+    inputs_torch = []
+    inputs_runtime = []
+    for program_input in first_program.program["inputs"]:
+        torch_tensor = torch.randn(
+            program_input["desc"]["shape"],
+            dtype=Binary.Program.from_data_type(
+                program_input["desc"]["layout"]["memory_desc"]["data_type"]
+            ),
+        )
+        inputs_torch.append(torch_tensor)
+        inputs_runtime.append(
+            ttrt.runtime.create_tensor(
+                torch_tensor.data_ptr(),
+                list(torch_tensor.shape),
+                list(torch_tensor.stride()),
+                torch_tensor.element_size(),
+                Binary.Program.to_data_type(torch_tensor.dtype),
+            )
+        )
+
+    program_indices = list(range(helper.binary.get_num_programs()))
+    last_program: Binary.Program = helper.binary.get_program(program_indices[-1])
+    torch_result_tensor = torch.randn(
+        last_program.program["outputs"][0]["desc"]["shape"],
+        dtype=Binary.Program.from_data_type(
+            last_program.program["outputs"][0]["desc"]["layout"]["memory_desc"][
+                "data_type"
+            ]
+        ),
+    )
+
+    # The weights are converted to the layout the programs consume them in
+    # once, and reused by all of them without further conversions.
+    activations, weights = inputs_runtime
+    activations_layout = ttrt.runtime.get_layout(
+        executable=helper.binary.fbb, program_index=0, input_index=0
+    )
+    weights_layout = ttrt.runtime.get_prepared_input_layout(
+        executable=helper.binary.fbb, program_index=0, input_index=1
+    )
+    with DeviceContext(helper.query.device_ids) as device:
+        activations = ttrt.runtime.to_layout(activations, device, activations_layout)
+        weights = ttrt.runtime.to_layout(weights, device, weights_layout)
+        for program_index in program_indices:
+            outputs = ttrt.runtime.submit(
+                device, helper.binary.fbb, program_index, [activations, weights]
+            )
+            activations = ttrt.runtime.to_layout(outputs[0], device, activations_layout)
+            ttrt.runtime.deallocate_tensor(outputs[0])
+        final_result = ttrt.runtime.to_host(activations, untilize=True)
+        ttrt.runtime.memcpy(torch_result_tensor.data_ptr(), final_result)
+        ttrt.runtime.deallocate_tensor(activations, force=True)
+        ttrt.runtime.deallocate_tensor(weights, force=True)
+        ttrt.runtime.deallocate_tensor(final_result, force=True)
+
+    golden = (
+        (inputs_torch[0] + inputs_torch[1]).mul(inputs_torch[1]).sub(inputs_torch[1])
+    )
+    assert_pcc(golden, torch_result_tensor, threshold=0.99)
+    helper.teardown()
+
+
+@pytest.mark.parametrize("length", [20, 32, 50])
+def test_submit_bucketed(helper: Helper, length, request):
+    binary_path = f"{TT_MLIR_HOME}/build/test/ttmlir/Silicon/TTNN/n150/shape_buckets/Output/bucketed_add.mlir.tmp.ttnn"
+    helper.initialize(request.node.name, binary_path)
+    helper.check_constraints()
+
+    shape = (1, length, 64)
+    inputs_torch = [torch.randn(shape, dtype=torch.bfloat16) for _ in range(2)]
+    inputs_runtime = [
+        ttrt.runtime.create_tensor(
+            torch_tensor.data_ptr(),
+            list(torch_tensor.shape),
+            list(torch_tensor.stride()),
+            torch_tensor.element_size(),
+            Binary.Program.to_data_type(torch_tensor.dtype),
+        )
+        for torch_tensor in inputs_torch
+    ]
+    torch_result_tensor = torch.zeros(shape, dtype=torch.bfloat16)
+
+    # The inputs are padded to the smallest bucket they fit in, 32 or 64, and
+    # the output is sliced back to their length.
+    with DeviceContext(helper.query.device_ids) as device:
+        outputs = ttrt.runtime.submit_bucketed(
+            device, helper.binary.fbb, "forward", inputs_runtime
+        )
+        result = ttrt.runtime.to_host(outputs[0], untilize=True)
+        ttrt.runtime.memcpy(torch_result_tensor.data_ptr(), result)
+        ttrt.runtime.deallocate_tensor(outputs[0], force=True)
+        ttrt.runtime.deallocate_tensor(result, force=True)
+
+    golden = inputs_torch[0] + inputs_torch[1]
+    assert_pcc(golden, torch_result_tensor, threshold=0.99)
+    helper.teardown()
+
+
+def test_compact_locations(helper: Helper, request):
+    binary_path = (
+        f"{TT_MLIR_HOME}/build/test/python/golden/test_compact_locations.ttnn"
+    )
+    helper.initialize(request.node.name, binary_path)
+    helper.check_constraints()
+
+    # Ops only store the ID of their location, which resolves to the location
+    # their goldens are keyed by.
+    goldens = 0
+    for program_index in range(helper.binary.get_num_programs()):
+        program = helper.binary.get_program(program_index)
+        for op in program.program["operations"]:
+            assert "loc_info" not in op
+            loc = helper.binary.fbb.get_debug_info_location(op["loc_id"])
+            assert loc is not None and not loc.startswith("#")
+            if helper.binary.fbb.get_debug_info_golden(loc) is not None:
+                goldens += 1
+    assert goldens >= 2
+
+    assert helper.binary.fbb.get_debug_info_location(2**32 - 1) is None
+    helper.teardown()
+
+
+def test_debug_info_sidecar(helper: Helper, request):
+    output_dir = f"{TT_MLIR_HOME}/build/test/ttmlir/Translate/TTNN/Output"
+    binary_path = f"{output_dir}/debug_info_sidecar.mlir.tmp.ttnn"
+    sidecar_path = f"{output_dir}/debug_info_sidecar.mlir.tmp.ttnnd"
+    other_sidecar_path = f"{output_dir}/debug_info_sidecar.mlir.tmp.other.ttnnd"
+    helper.initialize(request.node.name, binary_path)
+
+    # The binary is stripped of its debug info and links to the sidecar by the
+    # hash of its content.
+    debug_info_hash = helper.binary.fbb_dict["debug_info_hash"]
+    assert debug_info_hash != 0
+    for program in helper.binary.fbb_dict["programs"]:
+        assert "debug_info" not in program
+    sidecar = ttrt.binary.as_dict(ttrt.binary.load_from_path(sidecar_path))
+    assert sidecar["content_hash"] == debug_info_hash
+    assert "func.func @add" in sidecar["debug_info"]["mlir"]["source"]
+
+    # The sidecar of another module is rejected.
+    other_sidecar = ttrt.binary.as_dict(ttrt.binary.load_from_path(other_sidecar_path))
+    assert other_sidecar["content_hash"] != debug_info_hash
+    with pytest.raises(RuntimeError):
+        helper.binary.fbb.load_debug_info(other_sidecar_path)
+
+    helper.binary.fbb.load_debug_info(sidecar_path)
+    helper.teardown()
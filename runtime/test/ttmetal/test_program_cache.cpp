@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "tt/runtime/detail/program_cache.h"
+
+namespace {
+
+using ::tt::runtime::ttmetal::makeProgramCacheKey;
+using ::tt::runtime::ttmetal::ProgramCache;
+using ::tt::runtime::ttmetal::ProgramCacheKey;
+
+struct KernelSpec {
+  std::string source;
+  ::tt::target::metal::NocIndex nocIndex = ::tt::target::metal::NocIndex::Noc0;
+  ::tt::target::Dim2dRange coreRange = {::tt::target::Dim2d(0, 0),
+                                        ::tt::target::Dim2d(1, 1)};
+  std::uint64_t sourceHash = 0;
+};
+
+// Serializes a program made of data movement kernels and returns its key.
+ProgramCacheKey makeKey(std::vector<KernelSpec> const &specs) {
+  ::flatbuffers::FlatBufferBuilder fbb;
+  std::vector<::flatbuffers::Offset<::tt::target::metal::KernelDesc>> kernels;
+  for (KernelSpec const &spec : specs) {
+    auto config = ::tt::target::metal::CreateNocConfig(fbb, spec.nocIndex);
+    auto source = ::tt::target::metal::CreateKernelSource(
+        fbb, fbb.CreateSharedString(spec.source),
+        ::tt::target::metal::KernelConfig::NocConfig, config.Union(),
+        spec.sourceHash);
+    std::vector<::tt::target::Dim2dRange> coreRangeSet = {spec.coreRange};
+    kernels.push_back(::tt::target::metal::CreateKernelDescDirect(
+        fbb, ::tt::target::metal::Kernel::KernelSource, source.Union(),
+        &coreRangeSet));
+  }
+  fbb.Finish(::tt::target::metal::CreateProgramDescDirect(fbb, &kernels));
+  return makeProgramCacheKey(
+      ::flatbuffers::GetRoot<::tt::target::metal::ProgramDesc>(
+          fbb.GetBufferPointer()));
+}
+
+// Stands in for a tt-metal program; records how many times it was built.
+struct FakeProgram {
+  int id;
+};
+
+struct FakeBuilder {
+  int numBuilds = 0;
+  FakeProgram operator()() { return FakeProgram{numBuilds++}; }
+};
+
+} // namespace
+
+TEST(ProgramCache, BuildsOncePerProgram) {
+  ProgramCache<FakeProgram> cache;
+  FakeBuilder builder;
+  ProgramCacheKey key = makeKey({{"kernel_main() {}"}});
+
+  for (int i = 0; i < 10; ++i) {
+    FakeProgram &program = cache.getOrBuild(key, std::ref(builder));
+    EXPECT_EQ(program.id, 0);
+  }
+  EXPECT_EQ(builder.numBuilds, 1);
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_EQ(cache.misses(), 1u);
+  EXPECT_EQ(cache.hits(), 9u);
+}
+
+TEST(ProgramCache, IdenticalProgramsShareAnEntry) {
+  ProgramCache<FakeProgram> cache;
+  FakeBuilder builder;
+
+  // Same kernels serialized into two different buffers.
+  cache.getOrBuild(makeKey({{"a"}, {"b"}}), std::ref(builder));
+  cache.getOrBuild(makeKey({{"a"}, {"b"}}), std::ref(builder));
+  EXPECT_EQ(builder.numBuilds, 1);
+}
+
+TEST(ProgramCache, KeyCoversSourceCoreRangeAndConfig) {
+  ProgramCacheKey base = makeKey({{"a"}});
+
+  EXPECT_EQ(base, makeKey({{"a"}}));
+  EXPECT_NE(base, makeKey({{"b"}}));
+  EXPECT_NE(base, makeKey({{"a", ::tt::target::metal::NocIndex::Noc1}}));
+  EXPECT_NE(base, makeKey({{"a", ::tt::target::metal::NocIndex::Noc0,
+                            {::tt::target::Dim2d(0, 1),
+                             ::tt::target::Dim2d(1, 1)}}}));
+  EXPECT_NE(base, makeKey({{"a"}, {"a"}}));
+}
+
+TEST(ProgramCache, PrefersCompilerSourceHash) {
+  // Kernels carrying the same compiler-provided hash are considered identical
+  // without looking at the source.
+  EXPECT_EQ(makeKey({{"a", ::tt::target::metal::NocIndex::Noc0,
+                      {::tt::target::Dim2d(0, 0), ::tt::target::Dim2d(1, 1)},
+                      42}}),
+            makeKey({{"b", ::tt::target::metal::NocIndex::Noc0,
+                      {::tt::target::Dim2d(0, 0), ::tt::target::Dim2d(1, 1)},
+                      42}}));
+}
+
+TEST(ProgramCache, Clear) {
+  ProgramCache<FakeProgram> cache;
+  FakeBuilder builder;
+  ProgramCacheKey key = makeKey({{"a"}});
+
+  cache.getOrBuild(key, std::ref(builder));
+  EXPECT_TRUE(cache.contains(key));
+  cache.clear();
+  EXPECT_FALSE(cache.contains(key));
+  cache.getOrBuild(key, std::ref(builder));
+  EXPECT_EQ(builder.numBuilds, 2);
+}
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <variant>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "tt/runtime/detail/ttnn.h"
+#include "tt/runtime/utils.h"
+#include "ttnn/distributed/api.hpp"
+
+#ifndef TT_RUNTIME_ENABLE_TTNN
+#error "TT_RUNTIME_ENABLE_TTNN must be defined"
+#endif
+
+namespace {
+
+constexpr std::uint32_t kRows = 4;
+constexpr std::uint32_t kCols = 6;
+
+// A row-major kRows x kCols float tensor holding 0, 1, 2, ...
+std::shared_ptr<void> createIotaData() {
+  std::shared_ptr<void> data =
+      ::tt::runtime::utils::malloc_shared(kRows * kCols * sizeof(float));
+  float *values = static_cast<float *>(data.get());
+  std::iota(values, values + kRows * kCols, 0.0f);
+  return data;
+}
+
+std::vector<::ttnn::Tensor>
+createShards(std::shared_ptr<void> data,
+             std::vector<std::uint32_t> const &meshShape,
+             std::vector<std::int64_t> const &shardDims) {
+  ::tt::runtime::Tensor tensor = ::tt::runtime::ttnn::createTensor(
+      data, {kRows, kCols}, {kCols, 1}, sizeof(float),
+      ::tt::target::DataType::Float32, meshShape, shardDims);
+  const ::ttnn::Tensor &ttnnTensor =
+      tensor.as<::ttnn::Tensor>(::tt::runtime::DeviceRuntime::TTNN);
+  EXPECT_EQ(ttnnTensor.storage_type(),
+            ::tt::tt_metal::StorageType::MULTI_DEVICE_HOST);
+  EXPECT_TRUE(std::holds_alternative<::tt::tt_metal::MultiDeviceHostStorage>(
+      ttnnTensor.get_storage()));
+  return ::ttnn::distributed::get_tensors_from_multi_device_storage(
+      ttnnTensor);
+}
+
+// Checks that `shard` holds the rows x cols block of the iota tensor that
+// starts at (row, col).
+void expectBlock(const ::ttnn::Tensor &shard, std::uint32_t row,
+                 std::uint32_t col, std::uint32_t rows, std::uint32_t cols) {
+  ASSERT_EQ(shard.get_logical_shape(), ::ttnn::Shape({rows, cols}));
+  std::vector<float> values = shard.to_vector<float>();
+  ASSERT_EQ(values.size(), rows * cols);
+  for (std::uint32_t i = 0; i < rows; ++i) {
+    for (std::uint32_t j = 0; j < cols; ++j) {
+      EXPECT_EQ(values[i * cols + j],
+                static_cast<float>((row + i) * kCols + col + j));
+    }
+  }
+}
+
+} // namespace
+
+TEST(TTNNShardedTensor, Shard2D) {
+  std::vector<::ttnn::Tensor> shards =
+      createShards(createIotaData(), {2, 3}, {0, 1});
+  ASSERT_EQ(shards.size(), 6u);
+  for (std::uint32_t row = 0; row < 2; ++row) {
+    for (std::uint32_t col = 0; col < 3; ++col) {
+      expectBlock(shards[row * 3 + col], row * 2, col * 2, 2, 2);
+    }
+  }
+}
+
+TEST(TTNNShardedTensor, ContiguousShardsAreCopied) {
+  // Row blocks are contiguous in the data, each is copied in one go. The
+  // shards own their data, so they don't see later writes to the user data.
+  std::shared_ptr<void> data = createIotaData();
+  std::vector<::ttnn::Tensor> shards = createShards(data, {2, 1}, {0, -1});
+  float *values = static_cast<float *>(data.get());
+  std::fill(values, values + kRows * kCols, -1.0f);
+  ASSERT_EQ(shards.size(), 2u);
+  for (std::uint32_t row = 0; row < 2; ++row) {
+    EXPECT_EQ(shards[row].storage_type(), ::tt::tt_metal::StorageType::OWNED);
+    expectBlock(shards[row], row * 2, 0, 2, kCols);
+  }
+}
+
+TEST(TTNNShardedTensor, StridedShardsAreCopied) {
+  // Column blocks are strided in the data and are gathered into a copy.
+  std::vector<::ttnn::Tensor> shards =
+      createShards(createIotaData(), {1, 3}, {-1, 1});
+  ASSERT_EQ(shards.size(), 3u);
+  for (std::uint32_t col = 0; col < 3; ++col) {
+    EXPECT_EQ(shards[col].storage_type(), ::tt::tt_metal::StorageType::OWNED);
+    expectBlock(shards[col], 0, col * 2, kRows, 2);
+  }
+}
+
+TEST(TTNNShardedTensor, ReplicatedAxisSharesShards) {
+  // Devices of the same column get the same column block.
+  std::vector<::ttnn::Tensor> shards =
+      createShards(createIotaData(), {2, 3}, {-1, 1});
+  ASSERT_EQ(shards.size(), 6u);
+  for (std::uint32_t row = 0; row < 2; ++row) {
+    for (std::uint32_t col = 0; col < 3; ++col) {
+      expectBlock(shards[row * 3 + col], 0, col * 2, kRows, 2);
+    }
+  }
+}
+
+TEST(TTNNShardedTensor, RejectsItemsizeMismatch) {
+  EXPECT_ANY_THROW(::tt::runtime::ttnn::createTensor(
+      createIotaData(), {kRows, kCols}, {kCols, 1}, sizeof(std::uint16_t),
+      ::tt::target::DataType::Float32, {2, 1}, {0, -1}));
+}
@@ -32,8 +32,11 @@ PYBIND11_MODULE(_C, m) {
                              &tt::runtime::Binary::getFileIdentifier)
       .def("as_json", &tt::runtime::Binary::asJson)
       .def("store", &tt::runtime::Binary::store)
+      .def("load_debug_info", &::tt::runtime::Binary::loadDebugInfo)
       .def("get_debug_info_golden", &::tt::runtime::Binary::getDebugInfoGolden,
-           py::return_value_policy::reference);
+           py::return_value_policy::reference)
+      .def("get_debug_info_location",
+           &::tt::runtime::Binary::getDebugInfoLocation, py::arg("loc_id"));
   py::class_<tt::runtime::SystemDesc>(m, "SystemDesc")
       .def_property_readonly("version", &tt::runtime::SystemDesc::getVersion)
       .def_property_readonly("ttmlir_git_hash",
@@ -103,6 +106,11 @@ PYBIND11_MODULE(_C, m) {
           size = sizeof(uint32_t);
           break;
 
+        case tt::target::DataType::Int32:
+          format = py::format_descriptor<int32_t>::format();
+          size = sizeof(int32_t);
+          break;
+
         case tt::target::DataType::Float32:
           format = py::format_descriptor<float>::format();
           size = sizeof(float);
@@ -110,7 +118,7 @@ PYBIND11_MODULE(_C, m) {
 
         default:
           throw std::runtime_error(
-              "Only 32-bit floats and unsigned ints are currently supported "
+              "Only 32-bit floats and integers are currently supported "
               "for GoldenTensor bindings");
         }
 
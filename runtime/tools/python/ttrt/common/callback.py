@@ -202,7 +202,7 @@ def golden(callback_runtime_config, binary, program_context, op_context):
     logging = callback_runtime_config.logging
     logging.debug("executing golden comparison")
 
-    loc = ttrt.runtime.get_op_loc_info(op_context)
+    loc = ttrt.runtime.get_op_loc_info(binary, op_context)
 
     op_golden_tensor = binary.get_debug_info_golden(loc)
 
@@ -300,7 +300,7 @@ def memory(callback_runtime_config, binary, program_context, op_context):
     device = callback_runtime_config.device
     logging = callback_runtime_config.logging
     logging.debug("executing memory dump")
-    loc = ttrt.runtime.get_op_loc_info(op_context)
+    loc = ttrt.runtime.get_op_loc_info(binary, op_context)
     debug_str = ttrt.runtime.get_op_debug_str(op_context)
     device_id = 0
 
@@ -610,7 +610,7 @@ class Run:
                                 # Create symbol string to read from dylib
                                 fwd_func_name = program.program["name"]
                                 fwd_func_name_len = len(fwd_func_name)
-                                fwd_func_sym = f"_Z{fwd_func_name_len}{fwd_func_name}St6vectorIN2tt8tt_metal6TensorESaIS2_EE"
+                                fwd_func_sym = f"_Z{fwd_func_name_len}{fwd_func_name}RKSt6vectorIN2tt8tt_metal6TensorESaIS2_EE"
 
                                 for loop in range(self["--loops"]):
                                     inputs_converted = convert_input_layouts(
@@ -852,7 +852,7 @@ class Run:
         def randn(shape, dtype):
             import torch
 
-            if dtype in (torch.uint8, torch.uint16, torch.uint32):
+            if dtype in (torch.uint8, torch.uint16, torch.uint32, torch.int32):
                 high = torch.iinfo(dtype).max + 1
                 return torch.randint(0, high, shape, dtype=dtype)
 
@@ -23,8 +23,8 @@ def ttrt_datatype_to_torch_dtype(dtype) -> torch.dtype:
 
     """Converts a PyBound `::tt::target::DataType` into a `torch.dtype`.
 
-    Currently, only `float32`, `uint32`, `uint16`, & `uint8` are supported for
-    this conversion
+    Currently, only `float32`, `uint32`, `uint16`, `uint8` & `int32` are
+    supported for this conversion
 
     Arguments
     ---------
@@ -40,7 +40,8 @@ def ttrt_datatype_to_torch_dtype(dtype) -> torch.dtype:
     Throws
     ------
 
-    A `ValueError` if `dtype` is not one of `Float32`, `UInt32`, `UInt16`, or `UInt8`
+    A `ValueError` if `dtype` is not one of `Float32`, `UInt32`, `UInt16`, `UInt8`,
+    or `Int32`
 
     """
     from ttrt.runtime._C import DataType
@@ -53,8 +54,12 @@ def ttrt_datatype_to_torch_dtype(dtype) -> torch.dtype:
         return torch.uint16
     elif dtype == DataType.UInt8:
         return torch.uint8
+    elif dtype == DataType.Int32:
+        return torch.int32
     else:
-        raise ValueError("Only F32 and unsigned integers are supported in the runtime")
+        raise ValueError(
+            "Only F32, Int32 and unsigned integers are supported in the runtime"
+        )
 
 
 def get_ttrt_metal_home_path():
@@ -663,6 +668,8 @@ class Binary(Flatbuffer):
                 return ttrt.runtime.DataType.UInt16
             if dtype == torch.uint8:
                 return ttrt.runtime.DataType.UInt8
+            if dtype == torch.int32:
+                return ttrt.runtime.DataType.Int32
             raise ValueError(f"unsupported dtype: {dtype}")
 
         @staticmethod
@@ -681,6 +688,8 @@ class Binary(Flatbuffer):
                 return torch.uint16
             if dtype == "UInt8":
                 return torch.uint8
+            if dtype == "Int32":
+                return torch.int32
             raise ValueError(f"unsupported dtype: {dtype}")
 
 
@@ -20,6 +20,7 @@ try:
         open_device,
         close_device,
         submit,
+        submit_bucketed,
         create_tensor,
         create_empty_tensor,
         create_multi_device_tensor,
@@ -27,6 +28,7 @@ try:
         to_host,
         to_layout,
         get_layout,
+        get_prepared_input_layout,
         get_op_output_tensor,
         get_op_debug_str,
         memcpy,
@@ -60,7 +60,8 @@ PYBIND11_MODULE(_C, m) {
       .value("BFP_BFloat2", ::tt::target::DataType::BFP_BFloat2)
       .value("UInt32", ::tt::target::DataType::UInt32)
       .value("UInt16", ::tt::target::DataType::UInt16)
-      .value("UInt8", ::tt::target::DataType::UInt8);
+      .value("UInt8", ::tt::target::DataType::UInt8)
+      .value("Int32", ::tt::target::DataType::Int32);
   py::enum_<::tt::runtime::DeviceRuntime>(m, "DeviceRuntime")
       .value("Disabled", ::tt::runtime::DeviceRuntime::Disabled)
       .value("TTNN", ::tt::runtime::DeviceRuntime::TTNN)
@@ -117,6 +118,20 @@ PYBIND11_MODULE(_C, m) {
                                          dataType, strategy);
       },
       "Create a multi-device host tensor with owned memory");
+  m.def(
+      "create_sharded_tensor",
+      [](std::uintptr_t ptr, std::vector<std::uint32_t> const &shape,
+         std::vector<std::uint32_t> const &stride, std::uint32_t itemsize,
+         ::tt::target::DataType dataType,
+         std::vector<std::uint32_t> const &meshShape,
+         std::vector<std::int64_t> const &shardDims) {
+        return tt::runtime::createTensor(
+            ::tt::runtime::utils::unsafe_borrow_shared(
+                reinterpret_cast<void *>(ptr)),
+            shape, stride, itemsize, dataType, meshShape, shardDims);
+      },
+      "Create a multi-device host tensor sharded over a mesh, copying the "
+      "shards out of borrowed memory");
   m.def("get_num_available_devices", &tt::runtime::getNumAvailableDevices,
         "Get the number of available devices");
   m.def("open_device", &tt::runtime::openDevice, py::arg("device_ids"),
@@ -134,6 +149,11 @@ PYBIND11_MODULE(_C, m) {
   m.def("get_layout", &tt::runtime::getLayout, py::arg("executable"),
         py::arg("program_index"), py::arg("input_index"),
         "Get the layout of the input tensor");
+  m.def("get_prepared_input_layout", &tt::runtime::getPreparedInputLayout,
+        py::arg("executable"), py::arg("program_index"),
+        py::arg("input_index"),
+        "Get the layout the program consumes the input tensor in, inputs "
+        "submitted in it skip the conversions of the program");
   m.def(
       "submit",
       [](::tt::runtime::Device device, ::tt::runtime::Binary executable,
@@ -158,6 +178,10 @@ PYBIND11_MODULE(_C, m) {
       py::arg("device"), py::arg("executable"), py::arg("program_index"),
       py::arg("inputs"), py::arg("outputs"),
       "Submit a ttmetal binary for execution. returns event wrapper");
+  m.def("submit_bucketed", &tt::runtime::submitBucketed, py::arg("device"),
+        py::arg("executable"), py::arg("group"), py::arg("inputs"),
+        "Submit the smallest shape bucket of the group that fits the inputs, "
+        "returns a vector of output tensors");
   m.def(
       "wait", [](::tt::runtime::Event event) { ::tt::runtime::wait(event); },
       py::arg("event"));
@@ -181,8 +205,8 @@ PYBIND11_MODULE(_C, m) {
       "Get the input tensor of the op");
   m.def("get_op_debug_str", &tt::runtime::getOpDebugString,
         "Get the debug string of the op");
-  m.def("get_op_loc_info", &tt::runtime::getOpLocInfo,
-        "Get the location info of the op");
+  m.def("get_op_loc_info", &tt::runtime::getOpLocInfo, py::arg("binary"),
+        py::arg("op_context"), "Get the location info of the op");
   m.def(
       "memcpy",
       [](std::uintptr_t dst, ::tt::runtime::Tensor src) {
@@ -462,6 +462,16 @@ def test_mnist(
     return builder.softmax(add_6, dimension=1)
 
 
+# Ops refer to their location by ID, the runtime looks it up in the location
+# table to find their goldens.
+@compile_to_flatbuffer(
+    [(64, 128), (64, 128)], targets=["ttnn"], compact_locations=True
+)
+def test_compact_locations(in0: Operand, in1: Operand, builder: TTIRBuilder):
+    add = builder.add(in0, in1)
+    return builder.multiply(add, in1)
+
+
 if __name__ == "__main__":
     test_functions = inspect.getmembers(
         inspect.getmodule(inspect.currentframe()), inspect.isfunction
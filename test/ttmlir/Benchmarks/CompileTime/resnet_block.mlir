@@ -0,0 +1,22 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline %s | ttmlir-translate --ttnn-to-flatbuffer -o %t.ttnn
+
+// A ResNet basic block: two 3x3 convolutions with relu activations and a
+// residual add.
+// Part of the compile-time benchmark corpus, see
+// tools/scripts/benchmark-compile-time.py.
+
+module @ResNetBasicBlock attributes {} {
+  func.func @forward(%arg0: tensor<1x56x56x64xbf16>, %arg1: tensor<64x64x3x3xbf16>, %arg2: tensor<1x1x1x64xbf16>, %arg3: tensor<64x64x3x3xbf16>, %arg4: tensor<1x1x1x64xbf16>) -> tensor<1x56x56x64xbf16> {
+    %0 = tensor.empty() : tensor<1x56x56x64xbf16>
+    %1 = "ttir.conv2d"(%arg0, %arg1, %arg2, %0) <{stride_height=1: si32, stride_width=1: si32, dilation_height=1: si32, dilation_width=1: si32, groups=1: si32, padding_left=1: si32, padding_right=1: si32, padding_top=1: si32, padding_bottom=1: si32, is_convtranspose2d=0: si32, output_height_transpose=0: si32, output_width_transpose=0: si32, stride_transpose=0: si32}> : (tensor<1x56x56x64xbf16>, tensor<64x64x3x3xbf16>, tensor<1x1x1x64xbf16>, tensor<1x56x56x64xbf16>) -> tensor<1x56x56x64xbf16>
+    %2 = tensor.empty() : tensor<1x56x56x64xbf16>
+    %3 = "ttir.relu"(%1, %2) <{operandSegmentSizes = array<i32: 1, 1>}> : (tensor<1x56x56x64xbf16>, tensor<1x56x56x64xbf16>) -> tensor<1x56x56x64xbf16>
+    %4 = tensor.empty() : tensor<1x56x56x64xbf16>
+    %5 = "ttir.conv2d"(%3, %arg3, %arg4, %4) <{stride_height=1: si32, stride_width=1: si32, dilation_height=1: si32, dilation_width=1: si32, groups=1: si32, padding_left=1: si32, padding_right=1: si32, padding_top=1: si32, padding_bottom=1: si32, is_convtranspose2d=0: si32, output_height_transpose=0: si32, output_width_transpose=0: si32, stride_transpose=0: si32}> : (tensor<1x56x56x64xbf16>, tensor<64x64x3x3xbf16>, tensor<1x1x1x64xbf16>, tensor<1x56x56x64xbf16>) -> tensor<1x56x56x64xbf16>
+    %6 = tensor.empty() : tensor<1x56x56x64xbf16>
+    %7 = "ttir.add"(%5, %arg0, %6) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<1x56x56x64xbf16>, tensor<1x56x56x64xbf16>, tensor<1x56x56x64xbf16>) -> tensor<1x56x56x64xbf16>
+    %8 = tensor.empty() : tensor<1x56x56x64xbf16>
+    %9 = "ttir.relu"(%7, %8) <{operandSegmentSizes = array<i32: 1, 1>}> : (tensor<1x56x56x64xbf16>, tensor<1x56x56x64xbf16>) -> tensor<1x56x56x64xbf16>
+    return %9 : tensor<1x56x56x64xbf16>
+  }
+}
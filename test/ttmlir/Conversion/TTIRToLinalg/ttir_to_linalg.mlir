@@ -139,4 +139,36 @@ module attributes{} {
     // CHECK: %{{.+}} = linalg.add
     return %1 : tensor<32x32xf32>
   }
+
+  // CHECK: func.func @div
+  func.func @div(%arg0: tensor<32x32xf32>, %arg1: tensor<32x32xf32>, %arg2: tensor<32x32xf32>) -> tensor<32x32xf32> {
+    %1 = "ttir.div"(%arg0, %arg1, %arg2) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    // CHECK: %{{.+}} = linalg.div
+    return %1 : tensor<32x32xf32>
+  }
+
+  // CHECK: func.func @transpose
+  func.func @transpose(%arg0: tensor<64x128xf32>) -> tensor<128x64xf32> {
+    %0 = tensor.empty() : tensor<128x64xf32>
+    %1 = "ttir.transpose"(%arg0, %0) <{dim0 = -2 : si32, dim1 = -1 : si32}> : (tensor<64x128xf32>, tensor<128x64xf32>) -> tensor<128x64xf32>
+    // CHECK: %{{.+}} = linalg.transpose ins(%arg0 : tensor<64x128xf32>) outs(%{{.+}} : tensor<128x64xf32>) permutation = [1, 0]
+    return %1 : tensor<128x64xf32>
+  }
+
+  // CHECK: func.func @permute
+  func.func @permute(%arg0: tensor<2x3x4xf32>) -> tensor<4x2x3xf32> {
+    %0 = tensor.empty() : tensor<4x2x3xf32>
+    %1 = "ttir.permute"(%arg0, %0) <{permutation = array<i64: 2, 0, 1>}> : (tensor<2x3x4xf32>, tensor<4x2x3xf32>) -> tensor<4x2x3xf32>
+    // CHECK: %{{.+}} = linalg.transpose ins(%arg0 : tensor<2x3x4xf32>) outs(%{{.+}} : tensor<4x2x3xf32>) permutation = [2, 0, 1]
+    return %1 : tensor<4x2x3xf32>
+  }
+
+  // CHECK: func.func @reshape
+  func.func @reshape(%arg0: tensor<4x2x32xf32>) -> tensor<2x4x32xf32> {
+    %0 = tensor.empty() : tensor<2x4x32xf32>
+    %1 = "ttir.reshape"(%arg0, %0) <{shape = [2 : i32, 4 : i32, 32 : i32]}> : (tensor<4x2x32xf32>, tensor<2x4x32xf32>) -> tensor<2x4x32xf32>
+    // CHECK: %[[FLAT:.+]] = tensor.collapse_shape %arg0 {{\[\[}}0, 1, 2{{\]\]}} : tensor<4x2x32xf32> into tensor<256xf32>
+    // CHECK: %{{.+}} = tensor.expand_shape %[[FLAT]] {{\[\[}}0, 1, 2{{\]\]}}
+    return %1 : tensor<2x4x32xf32>
+  }
 }
@@ -0,0 +1,75 @@
+// RUN: ttmlir-opt --convert-ttnn-to-emitc %s | FileCheck %s
+
+#device = #tt.device<workerGrid = #tt.grid<8x8, (d0, d1) -> (0, d0, d1)>, l1Map = (d0, d1)[s0, s1] -> (0, d0 floordiv s0, d1 floordiv s1, (d0 mod s0) * s1 + d1 mod s1), dramMap = (d0, d1)[s0, s1] -> (0, 0, ((((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) floordiv 8192) mod 12, (((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) floordiv 98304 + (((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) mod 8192), meshShape = , chipIds = [0]>
+#dram = #ttnn.buffer_type<dram>
+#system_memory = #ttnn.buffer_type<system_memory>
+#ttnn_layout = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <1x1>, memref<32x32xbf16, #system_memory>>
+#ttnn_layout1 = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <1x1>, memref<32x32xbf16, #dram>, <interleaved>>
+#ttnn_layout2 = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <1x1>, memref<1x1x!tt.tile<32x32, bf16>, #dram>, <interleaved>>
+module {
+  // Tensors are passed by const reference, and identical memory configs and
+  // shapes are constructed once per module, as static globals bound to
+  // const references at each use.
+  //
+  // CHECK: emitc.global static @memory_config_0 : !emitc.opaque<"const ttnn::MemoryConfig &"> = #emitc.opaque<"ttnn::MemoryConfig(ttnn::TensorMemoryLayout::INTERLEAVED, ttnn::BufferType::DRAM)">
+  // CHECK-NEXT: emitc.global static @shape_1 : !emitc.opaque<"const ttnn::Shape &"> = #emitc.opaque<"ttnn::Shape({32, 32})">
+  // CHECK-NOT: emitc.global
+  // CHECK-LABEL: func.func @add
+  // CHECK-SAME: (%arg0: !emitc.opaque<"const ttnn::Tensor &">, %arg1: !emitc.opaque<"const ttnn::Tensor &">) -> !emitc.opaque<"ttnn::Tensor">
+  // CHECK-NOT: emitc.call_opaque "ttnn::MemoryConfig"
+  // CHECK-NOT: emitc.call_opaque "ttnn::Shape"
+  // CHECK: %[[MEMCFG0_REF:.*]] = emitc.get_global @memory_config_0 : !emitc.lvalue<!emitc.opaque<"const ttnn::MemoryConfig &">>
+  // CHECK-NEXT: %[[MEMCFG0:.*]] = emitc.load %[[MEMCFG0_REF]]
+  // CHECK-NEXT: emitc.call_opaque "ttnn::to_device"(%arg0, %{{.*}}, %[[MEMCFG0]])
+  // CHECK: %[[MEMCFG1_REF:.*]] = emitc.get_global @memory_config_0
+  // CHECK-NEXT: %[[MEMCFG1:.*]] = emitc.load %[[MEMCFG1_REF]]
+  // CHECK-NEXT: emitc.call_opaque "ttnn::to_device"(%arg1, %{{.*}}, %[[MEMCFG1]])
+  // CHECK: %[[SHAPE_REF:.*]] = emitc.get_global @shape_1
+  // CHECK-NEXT: %[[SHAPE:.*]] = emitc.load %[[SHAPE_REF]]
+  // CHECK: emitc.call_opaque "ttnn::empty"(%[[SHAPE]], %{{.*}}, %{{.*}})
+  func.func @add(%arg0: tensor<32x32xbf16, #ttnn_layout>, %arg1: tensor<32x32xbf16, #ttnn_layout>) -> tensor<32x32xbf16, #ttnn_layout2> {
+    %0 = "ttnn.get_device"() <{mesh_shape = #ttnn<mesh_shape 1x1>}> : () -> !tt.device<#device>
+    %1 = "ttnn.to_device"(%arg0, %0) <{memory_config = #ttnn.memory_config<#dram, <<1x1>>, <interleaved>>}> : (tensor<32x32xbf16, #ttnn_layout>, !tt.device<#device>) -> tensor<32x32xbf16, #ttnn_layout1>
+    %2 = "ttnn.to_layout"(%1) <{layout = #ttnn.layout<tile>}> : (tensor<32x32xbf16, #ttnn_layout1>) -> tensor<32x32xbf16, #ttnn_layout2>
+    %3 = "ttnn.to_device"(%arg1, %0) <{memory_config = #ttnn.memory_config<#dram, <<1x1>>, <interleaved>>}> : (tensor<32x32xbf16, #ttnn_layout>, !tt.device<#device>) -> tensor<32x32xbf16, #ttnn_layout1>
+    %4 = "ttnn.to_layout"(%3) <{layout = #ttnn.layout<tile>}> : (tensor<32x32xbf16, #ttnn_layout1>) -> tensor<32x32xbf16, #ttnn_layout2>
+    %5 = "ttnn.empty"(%0) <{dtype = #tt.supportedDataTypes<bf16>, layout = #ttnn.layout<tile>, memory_config = #ttnn.memory_config<#dram, <<1x1>>, <interleaved>>, shape = #ttnn.shape<32x32>}> : (!tt.device<#device>) -> tensor<32x32xbf16, #ttnn_layout2>
+    %6 = "ttnn.add"(%2, %4, %5) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<32x32xbf16, #ttnn_layout2>, tensor<32x32xbf16, #ttnn_layout2>, tensor<32x32xbf16, #ttnn_layout2>) -> tensor<32x32xbf16, #ttnn_layout2>
+    return %6 : tensor<32x32xbf16, #ttnn_layout2>
+  }
+
+  // Elements of tuples are bound to const references, and tensors are moved
+  // into returned tuples at their last use.
+  //
+  // CHECK-LABEL: func.func @forward
+  // CHECK-SAME: (%arg0: !emitc.opaque<"const std::vector<ttnn::Tensor> &">)
+  // CHECK: %[[ELEM0:.*]] = emitc.subscript %arg0{{.*}} -> !emitc.lvalue<!emitc.opaque<"const ttnn::Tensor &">>
+  // CHECK: %[[ARG0:.*]] = emitc.load %[[ELEM0]]
+  // CHECK: %[[ELEM1:.*]] = emitc.subscript %arg0{{.*}} -> !emitc.lvalue<!emitc.opaque<"const ttnn::Tensor &">>
+  // CHECK: %[[ARG1:.*]] = emitc.load %[[ELEM1]]
+  // CHECK: %[[TILED:.*]] = emitc.call_opaque "ttnn::to_layout"(%[[ARG0]])
+  // CHECK: emitc.expression
+  // CHECK-NEXT: %[[MOVED:.*]] = emitc.call_opaque "std::move"(%[[TILED]])
+  // CHECK-NEXT: emitc.call_opaque "utilCreateVec"(%[[MOVED]], %[[ARG1]])
+  func.func @forward(%arg0: tuple<tensor<32x32xbf16, #ttnn_layout1>, tensor<32x32xbf16, #ttnn_layout1>>) -> tuple<tensor<32x32xbf16, #ttnn_layout2>, tensor<32x32xbf16, #ttnn_layout1>> {
+    %0 = tt.get_tuple_element %arg0[0] : (tuple<tensor<32x32xbf16, #ttnn_layout1>, tensor<32x32xbf16, #ttnn_layout1>>) -> tensor<32x32xbf16, #ttnn_layout1>
+    %1 = tt.get_tuple_element %arg0[1] : (tuple<tensor<32x32xbf16, #ttnn_layout1>, tensor<32x32xbf16, #ttnn_layout1>>) -> tensor<32x32xbf16, #ttnn_layout1>
+    %2 = "ttnn.to_layout"(%0) <{layout = #ttnn.layout<tile>}> : (tensor<32x32xbf16, #ttnn_layout1>) -> tensor<32x32xbf16, #ttnn_layout2>
+    %3 = tt.tuple %2, %1 : tuple<tensor<32x32xbf16, #ttnn_layout2>, tensor<32x32xbf16, #ttnn_layout1>>
+    return %3 : tuple<tensor<32x32xbf16, #ttnn_layout2>, tensor<32x32xbf16, #ttnn_layout1>>
+  }
+
+  // Tensors passed to functions that take const references are cast to them.
+  //
+  // CHECK-LABEL: func.func @main
+  // CHECK: emitc.get_global @shape_1
+  // CHECK: %[[INPUT:.*]] = emitc.call_opaque "ttnn::ones"
+  // CHECK: %[[REF0:.*]] = emitc.cast %[[INPUT]] {{.*}} to !emitc.opaque<"const ttnn::Tensor &">
+  // CHECK: %[[REF1:.*]] = emitc.cast %[[INPUT]] {{.*}} to !emitc.opaque<"const ttnn::Tensor &">
+  // CHECK: call @add(%[[REF0]], %[[REF1]])
+  func.func @main() -> tensor<32x32xbf16, #ttnn_layout2> {
+    %0 = "ttnn.ones"() <{dtype = #tt.supportedDataTypes<bf16>, layout = #ttnn.layout<row_major>, shape = #ttnn.shape<32x32>}> : () -> tensor<32x32xbf16, #ttnn_layout>
+    %1 = call @add(%0, %0) : (tensor<32x32xbf16, #ttnn_layout>, tensor<32x32xbf16, #ttnn_layout>) -> tensor<32x32xbf16, #ttnn_layout2>
+    return %1 : tensor<32x32xbf16, #ttnn_layout2>
+  }
+}
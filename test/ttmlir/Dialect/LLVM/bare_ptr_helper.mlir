@@ -0,0 +1,26 @@
+// RUN: ttmlir-opt --emit-calling-convention-wrappers="batched-wrappers=true" %s | FileCheck %s
+
+module attributes {ttir.cpu_module} {
+  llvm.func @add(%arg0: !llvm.ptr, %arg1: !llvm.ptr, %arg2: i64, %arg3: i64, %arg4: i64, %arg5: i64, %arg6: i64, %arg7: !llvm.ptr, %arg8: !llvm.ptr, %arg9: i64, %arg10: i64, %arg11: i64, %arg12: i64, %arg13: i64, %arg14: !llvm.ptr, %arg15: !llvm.ptr, %arg16: i64, %arg17: i64, %arg18: i64, %arg19: i64, %arg20: i64) attributes {arg_ranks = [2, 2, 2], arg_shapes = [array<i64: 32, 3>, array<i64: 32, 3>, array<i64: 32, 3>]} {
+    llvm.return
+  }
+}
+
+// Static shapes let the helper fold the sizes, but the strides are still
+// loaded since the caller may pass strided tensors.
+// CHECK-LABEL: llvm.func @add_helper(%arg0: !llvm.ptr)
+// CHECK: llvm.extractvalue %{{.*}}[3]
+// CHECK: llvm.mlir.constant(32 : i64) : i64
+// CHECK: llvm.mlir.constant(3 : i64) : i64
+// CHECK: llvm.load %{{.*}} : !llvm.ptr -> i64
+// CHECK: llvm.call @add(
+
+// CHECK-LABEL: llvm.func @add_bare(%arg0: !llvm.ptr)
+// CHECK-DAG: llvm.mlir.constant(32 : i64) : i64
+// CHECK-DAG: llvm.mlir.constant(3 : i64) : i64
+// CHECK: llvm.call @add(
+
+// CHECK-LABEL: llvm.func @add_batched(%arg0: !llvm.ptr, %arg1: i64)
+// CHECK: llvm.icmp "slt"
+// CHECK: llvm.cond_br
+// CHECK: llvm.call @add(
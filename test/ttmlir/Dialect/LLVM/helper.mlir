@@ -8,3 +8,5 @@ module attributes {ttir.cpu_module} {
 }
 
 // CHECK: llvm.func @add_helper(%arg0: !llvm.ptr)
+// CHECK-NOT: llvm.func @add_bare
+// CHECK-NOT: llvm.func @add_batched
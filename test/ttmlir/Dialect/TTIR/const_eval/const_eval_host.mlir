@@ -0,0 +1,29 @@
+// RUN: ttmlir-opt --ttir-const-eval-host %s | FileCheck %s
+
+module {
+  // CHECK-LABEL: func.func @transpose_add
+  func.func @transpose_add(%arg0: tensor<2x2xf32>) -> tensor<2x2xf32> {
+    // CHECK-NOT: "ttir.transpose"
+    // CHECK: %[[CST:.*]] = "ttir.constant"() <{value = dense<{{\[\[}}2.000000e+00, 4.000000e+00], [3.000000e+00, 5.000000e+00]]> : tensor<2x2xf32>}>
+    %0 = "ttir.constant"() <{value = dense<[[1.0, 2.0], [3.0, 4.0]]> : tensor<2x2xf32>}> : () -> tensor<2x2xf32>
+    %1 = "ttir.constant"() <{value = dense<1.0> : tensor<2x2xf32>}> : () -> tensor<2x2xf32>
+    %2 = tensor.empty() : tensor<2x2xf32>
+    %3 = "ttir.transpose"(%0, %2) <{dim0 = 0 : si32, dim1 = 1 : si32}> : (tensor<2x2xf32>, tensor<2x2xf32>) -> tensor<2x2xf32>
+    %4 = tensor.empty() : tensor<2x2xf32>
+    %5 = "ttir.add"(%3, %1, %4) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<2x2xf32>, tensor<2x2xf32>, tensor<2x2xf32>) -> tensor<2x2xf32>
+    // CHECK: "ttir.multiply"(%arg0, %[[CST]]
+    %6 = tensor.empty() : tensor<2x2xf32>
+    %7 = "ttir.multiply"(%arg0, %5, %6) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<2x2xf32>, tensor<2x2xf32>, tensor<2x2xf32>) -> tensor<2x2xf32>
+    return %7 : tensor<2x2xf32>
+  }
+
+  // CHECK-LABEL: func.func @reshape
+  func.func @reshape() -> tensor<4xf32> {
+    // CHECK: "ttir.constant"() <{value = dense<[1.000000e+00, 2.000000e+00, 3.000000e+00, 4.000000e+00]> : tensor<4xf32>}>
+    // CHECK-NOT: "ttir.reshape"
+    %0 = "ttir.constant"() <{value = dense<[[1.0, 2.0], [3.0, 4.0]]> : tensor<2x2xf32>}> : () -> tensor<2x2xf32>
+    %1 = tensor.empty() : tensor<4xf32>
+    %2 = "ttir.reshape"(%0, %1) <{shape = [4 : i32]}> : (tensor<2x2xf32>, tensor<4xf32>) -> tensor<4xf32>
+    return %2 : tensor<4xf32>
+  }
+}
@@ -0,0 +1,84 @@
+// RUN: ttmlir-opt --ttir-fuse-attention %s | FileCheck %s
+module attributes {} {
+  // CHECK-LABEL: func.func @softmax
+  func.func @softmax(%arg0: tensor<1x8x128x128xf32>) -> tensor<1x8x128x128xf32> {
+    // CHECK: "ttir.softmax"(%arg0, {{.*}}) <{dimension = 3 : si32}>
+    // CHECK-NOT: "ttir.exp"
+    %0 = tensor.empty() : tensor<1x8x128xf32>
+    %1 = "ttir.max"(%arg0, %0) <{dim_arg = [3 : i32], keep_dim = false}> : (tensor<1x8x128x128xf32>, tensor<1x8x128xf32>) -> tensor<1x8x128xf32>
+    %2 = tensor.empty() : tensor<1x8x128x1xf32>
+    %3 = "ttir.reshape"(%1, %2) <{shape = [1 : i32, 8 : i32, 128 : i32, 1 : i32]}> : (tensor<1x8x128xf32>, tensor<1x8x128x1xf32>) -> tensor<1x8x128x1xf32>
+    %4 = tensor.empty() : tensor<1x8x128x128xf32>
+    %5 = "ttir.broadcast"(%3, %4) <{broadcast_dimensions = array<i64: 1, 1, 1, 128>}> : (tensor<1x8x128x1xf32>, tensor<1x8x128x128xf32>) -> tensor<1x8x128x128xf32>
+    %6 = tensor.empty() : tensor<1x8x128x128xf32>
+    %7 = "ttir.subtract"(%arg0, %5, %6) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<1x8x128x128xf32>, tensor<1x8x128x128xf32>, tensor<1x8x128x128xf32>) -> tensor<1x8x128x128xf32>
+    %8 = tensor.empty() : tensor<1x8x128x128xf32>
+    %9 = "ttir.exp"(%7, %8) <{operandSegmentSizes = array<i32: 1, 1>}> : (tensor<1x8x128x128xf32>, tensor<1x8x128x128xf32>) -> tensor<1x8x128x128xf32>
+    %10 = tensor.empty() : tensor<1x8x128x1xf32>
+    %11 = "ttir.sum"(%9, %10) <{dim_arg = [-1 : i32], keep_dim = true}> : (tensor<1x8x128x128xf32>, tensor<1x8x128x1xf32>) -> tensor<1x8x128x1xf32>
+    %12 = tensor.empty() : tensor<1x8x128x128xf32>
+    %13 = "ttir.broadcast"(%11, %12) <{broadcast_dimensions = array<i64: 1, 1, 1, 128>}> : (tensor<1x8x128x1xf32>, tensor<1x8x128x128xf32>) -> tensor<1x8x128x128xf32>
+    %14 = tensor.empty() : tensor<1x8x128x128xf32>
+    %15 = "ttir.div"(%9, %13, %14) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<1x8x128x128xf32>, tensor<1x8x128x128xf32>, tensor<1x8x128x128xf32>) -> tensor<1x8x128x128xf32>
+    return %15 : tensor<1x8x128x128xf32>
+  }
+
+  // Reductions over different dimensions are not a softmax.
+  // CHECK-LABEL: func.func @softmax_mismatched_dims
+  func.func @softmax_mismatched_dims(%arg0: tensor<8x8xf32>) -> tensor<8x8xf32> {
+    // CHECK-NOT: "ttir.softmax"
+    %0 = tensor.empty() : tensor<8x1xf32>
+    %1 = "ttir.max"(%arg0, %0) <{dim_arg = [1 : i32], keep_dim = true}> : (tensor<8x8xf32>, tensor<8x1xf32>) -> tensor<8x1xf32>
+    %2 = tensor.empty() : tensor<8x8xf32>
+    %3 = "ttir.broadcast"(%1, %2) <{broadcast_dimensions = array<i64: 1, 8>}> : (tensor<8x1xf32>, tensor<8x8xf32>) -> tensor<8x8xf32>
+    %4 = tensor.empty() : tensor<8x8xf32>
+    %5 = "ttir.subtract"(%arg0, %3, %4) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<8x8xf32>, tensor<8x8xf32>, tensor<8x8xf32>) -> tensor<8x8xf32>
+    %6 = tensor.empty() : tensor<8x8xf32>
+    %7 = "ttir.exp"(%5, %6) <{operandSegmentSizes = array<i32: 1, 1>}> : (tensor<8x8xf32>, tensor<8x8xf32>) -> tensor<8x8xf32>
+    %8 = tensor.empty() : tensor<1x8xf32>
+    %9 = "ttir.sum"(%7, %8) <{dim_arg = [0 : i32], keep_dim = true}> : (tensor<8x8xf32>, tensor<1x8xf32>) -> tensor<1x8xf32>
+    %10 = tensor.empty() : tensor<8x8xf32>
+    %11 = "ttir.broadcast"(%9, %10) <{broadcast_dimensions = array<i64: 8, 1>}> : (tensor<1x8xf32>, tensor<8x8xf32>) -> tensor<8x8xf32>
+    %12 = tensor.empty() : tensor<8x8xf32>
+    %13 = "ttir.div"(%7, %11, %12) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<8x8xf32>, tensor<8x8xf32>, tensor<8x8xf32>) -> tensor<8x8xf32>
+    return %13 : tensor<8x8xf32>
+  }
+
+  // CHECK-LABEL: func.func @attention
+  func.func @attention(%q: tensor<1x8x128x64xbf16>, %k: tensor<1x8x128x64xbf16>, %v: tensor<1x8x128x64xbf16>, %mask: tensor<1x1x128x128xbf16>) -> tensor<1x8x128x64xbf16> {
+    // CHECK: "ttir.scaled_dot_product_attention"(%arg0, %arg1, %arg2, %arg3, {{.*}})
+    // CHECK-SAME: scale = 1.250000e-01 : f32
+    // CHECK-NOT: "ttir.matmul"
+    %0 = tensor.empty() : tensor<1x8x64x128xbf16>
+    %1 = "ttir.permute"(%k, %0) <{permutation = array<i64: 0, 1, 3, 2>}> : (tensor<1x8x128x64xbf16>, tensor<1x8x64x128xbf16>) -> tensor<1x8x64x128xbf16>
+    %2 = tensor.empty() : tensor<1x8x128x128xbf16>
+    %3 = "ttir.matmul"(%q, %1, %2) : (tensor<1x8x128x64xbf16>, tensor<1x8x64x128xbf16>, tensor<1x8x128x128xbf16>) -> tensor<1x8x128x128xbf16>
+    %4 = "ttir.constant"() <{value = dense<8.0> : tensor<1x8x128x128xbf16>}> : () -> tensor<1x8x128x128xbf16>
+    %5 = tensor.empty() : tensor<1x8x128x128xbf16>
+    %6 = "ttir.div"(%3, %4, %5) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<1x8x128x128xbf16>, tensor<1x8x128x128xbf16>, tensor<1x8x128x128xbf16>) -> tensor<1x8x128x128xbf16>
+    %7 = tensor.empty() : tensor<1x8x128x128xbf16>
+    %8 = "ttir.broadcast"(%mask, %7) <{broadcast_dimensions = array<i64: 1, 8, 1, 1>}> : (tensor<1x1x128x128xbf16>, tensor<1x8x128x128xbf16>) -> tensor<1x8x128x128xbf16>
+    %9 = tensor.empty() : tensor<1x8x128x128xbf16>
+    %10 = "ttir.add"(%6, %8, %9) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<1x8x128x128xbf16>, tensor<1x8x128x128xbf16>, tensor<1x8x128x128xbf16>) -> tensor<1x8x128x128xbf16>
+    %11 = tensor.empty() : tensor<1x8x128x128xbf16>
+    %12 = "ttir.softmax"(%10, %11) <{dimension = -1 : si32}> : (tensor<1x8x128x128xbf16>, tensor<1x8x128x128xbf16>) -> tensor<1x8x128x128xbf16>
+    %13 = tensor.empty() : tensor<1x8x128x64xbf16>
+    %14 = "ttir.matmul"(%12, %v, %13) : (tensor<1x8x128x128xbf16>, tensor<1x8x128x64xbf16>, tensor<1x8x128x64xbf16>) -> tensor<1x8x128x64xbf16>
+    return %14 : tensor<1x8x128x64xbf16>
+  }
+
+  // Attention probabilities used elsewhere are kept decomposed.
+  // CHECK-LABEL: func.func @attention_probabilities_returned
+  func.func @attention_probabilities_returned(%q: tensor<1x8x128x64xbf16>, %k: tensor<1x8x128x64xbf16>, %v: tensor<1x8x128x64xbf16>) -> (tensor<1x8x128x64xbf16>, tensor<1x8x128x128xbf16>) {
+    // CHECK-NOT: "ttir.scaled_dot_product_attention"
+    %0 = tensor.empty() : tensor<1x8x64x128xbf16>
+    %1 = "ttir.transpose"(%k, %0) <{dim0 = -2 : si32, dim1 = -1 : si32}> : (tensor<1x8x128x64xbf16>, tensor<1x8x64x128xbf16>) -> tensor<1x8x64x128xbf16>
+    %2 = tensor.empty() : tensor<1x8x128x128xbf16>
+    %3 = "ttir.matmul"(%q, %1, %2) : (tensor<1x8x128x64xbf16>, tensor<1x8x64x128xbf16>, tensor<1x8x128x128xbf16>) -> tensor<1x8x128x128xbf16>
+    %4 = tensor.empty() : tensor<1x8x128x128xbf16>
+    %5 = "ttir.softmax"(%3, %4) <{dimension = 3 : si32}> : (tensor<1x8x128x128xbf16>, tensor<1x8x128x128xbf16>) -> tensor<1x8x128x128xbf16>
+    %6 = tensor.empty() : tensor<1x8x128x64xbf16>
+    %7 = "ttir.matmul"(%5, %v, %6) : (tensor<1x8x128x128xbf16>, tensor<1x8x128x64xbf16>, tensor<1x8x128x64xbf16>) -> tensor<1x8x128x64xbf16>
+    return %7, %5 : tensor<1x8x128x64xbf16>, tensor<1x8x128x128xbf16>
+  }
+}
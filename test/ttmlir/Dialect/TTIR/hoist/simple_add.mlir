@@ -43,3 +43,5 @@ func.func @add4(%arg0: tensor<32x32xbf16>, %arg1: tensor<32x32xbf16>) -> tensor<
 // CHECK: func.func @hoisted_ttir_add_32x32xbf16_32x32xbf16_32x32xbf16_func
 // CHECK: func.func @hoisted_ttir_add_32x32xf32_32x32xf32_32x32xf32_func
 // CHECK: func.func @hoisted_ttir_add_32x3xf32_32x3xf32_32x3xf32_func
+// CHECK-SAME: arg_ranks = [2, 2, 2]
+// CHECK-SAME: arg_shapes = [array<i64: 32, 3>, array<i64: 32, 3>, array<i64: 32, 3>]
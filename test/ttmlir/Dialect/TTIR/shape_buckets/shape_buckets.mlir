@@ -0,0 +1,35 @@
+// RUN: ttmlir-opt --ttir-shape-buckets="bucket-sizes=64,32" %s | FileCheck %s
+module attributes {} {
+  // CHECK-NOT: func.func @forward(
+  // CHECK-LABEL: func.func @forward_bucket_32
+  // CHECK-SAME: (%arg0: tensor<1x32x64xbf16>, %arg1: tensor<1x1x64xbf16>, %arg2: tensor<1x32xbf16>) -> (tensor<1x32x64xbf16>, tensor<1x32x1xbf16>)
+  // CHECK-SAME: tt.shape_bucket = #tt.shape_bucket<group = "forward", size = 32, inputDims = [array<i64: 1>, array<i64>, array<i64: 1>], outputDims = [array<i64: 1>, array<i64: 1>], padValues = array<f32: 0.000000e+00, 0.000000e+00, -1.000000e+09>>
+  // CHECK-NOT: ttir.bucket_pad_value
+  // CHECK: "ttir.broadcast"
+  // CHECK-SAME: broadcast_dimensions = array<i64: 1, 32, 1>
+  // CHECK-SAME: -> tensor<1x32x64xbf16>
+  // CHECK: "ttir.reshape"
+  // CHECK-SAME: shape = [1 : i32, 32 : i32, 1 : i32]
+  // CHECK-SAME: -> tensor<1x32x1xbf16>
+  // CHECK-LABEL: func.func @forward_bucket_64
+  // CHECK-SAME: (%arg0: tensor<1x64x64xbf16>, %arg1: tensor<1x1x64xbf16>, %arg2: tensor<1x64xbf16>) -> (tensor<1x64x64xbf16>, tensor<1x64x1xbf16>)
+  // CHECK-SAME: size = 64
+  func.func @forward(%arg0: tensor<1x?x64xbf16>, %arg1: tensor<1x1x64xbf16>, %arg2: tensor<1x?xbf16> {ttir.bucket_pad_value = -1.0e+09 : f32}) -> (tensor<1x?x64xbf16>, tensor<1x?x1xbf16>) {
+    %c1 = arith.constant 1 : index
+    %dim = tensor.dim %arg0, %c1 : tensor<1x?x64xbf16>
+    %0 = tensor.empty(%dim) : tensor<1x?x64xbf16>
+    %1 = "ttir.broadcast"(%arg1, %0) <{broadcast_dimensions = array<i64: 1, 1, 1>}> : (tensor<1x1x64xbf16>, tensor<1x?x64xbf16>) -> tensor<1x?x64xbf16>
+    %2 = tensor.empty(%dim) : tensor<1x?x1xbf16>
+    %3 = "ttir.reshape"(%arg2, %2) <{shape = [1 : i32, -1 : i32, 1 : i32]}> : (tensor<1x?xbf16>, tensor<1x?x1xbf16>) -> tensor<1x?x1xbf16>
+    %4 = tensor.empty(%dim) : tensor<1x?x64xbf16>
+    %5 = "ttir.add"(%arg0, %1, %4) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<1x?x64xbf16>, tensor<1x?x64xbf16>, tensor<1x?x64xbf16>) -> tensor<1x?x64xbf16>
+    return %5, %3 : tensor<1x?x64xbf16>, tensor<1x?x1xbf16>
+  }
+
+  // Functions with static shapes are left as they are.
+  // CHECK-LABEL: func.func @static
+  // CHECK-NOT: tt.shape_bucket
+  func.func @static(%arg0: tensor<1x32xbf16>) -> tensor<1x32xbf16> {
+    return %arg0 : tensor<1x32xbf16>
+  }
+}
@@ -0,0 +1,43 @@
+// RUN: not ttmlir-opt --split-input-file --ttir-shape-buckets="bucket-sizes=32" %s 2>&1 | FileCheck %s
+// Negative tests for the shape buckets pass.
+
+module attributes {} {
+  func.func @forward(%arg0: tensor<?x64xbf16>) -> tensor<?x64xbf16> {
+    return %arg0 : tensor<?x64xbf16>
+  }
+  // CHECK: error: 'func.func' op shape bucket name 'forward_bucket_32' is already taken
+  func.func @forward_bucket_32(%arg0: tensor<32x64xbf16>) -> tensor<32x64xbf16> {
+    return %arg0 : tensor<32x64xbf16>
+  }
+}
+
+// -----
+module attributes {} {
+  // CHECK: error: 'func.func' op with dynamic dimensions must be public and defined to be specialized for shape buckets
+  func.func private @forward(%arg0: tensor<?x64xbf16>) -> tensor<?x64xbf16> {
+    return %arg0 : tensor<?x64xbf16>
+  }
+}
+
+// -----
+module attributes {} {
+  // Reshaping a bucketed dimension into a fixed size only holds for one size.
+  // CHECK: error: 'func.func' op could not be specialized for shape bucket 32
+  func.func @forward(%arg0: tensor<?x64xbf16>) -> tensor<2x?xbf16> {
+    %c2048 = arith.constant 2048 : index
+    %1 = tensor.empty(%c2048) : tensor<2x?xbf16>
+    %2 = "ttir.reshape"(%arg0, %1) <{shape = [2 : i32, -1 : i32]}> : (tensor<?x64xbf16>, tensor<2x?xbf16>) -> tensor<2x?xbf16>
+    return %2 : tensor<2x?xbf16>
+  }
+}
+
+// -----
+module attributes {} {
+  // The padded positions would be summed too.
+  func.func @forward(%arg0: tensor<1x?xbf16>) -> tensor<1x1xbf16> {
+    %0 = tensor.empty() : tensor<1x1xbf16>
+    // CHECK: error: 'ttir.sum' op reduces over dimension 1, which is padded for shape buckets
+    %1 = "ttir.sum"(%arg0, %0) <{dim_arg = [-1 : i32], keep_dim = true}> : (tensor<1x?xbf16>, tensor<1x1xbf16>) -> tensor<1x1xbf16>
+    return %1 : tensor<1x1xbf16>
+  }
+}
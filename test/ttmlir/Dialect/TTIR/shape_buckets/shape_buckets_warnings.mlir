@@ -0,0 +1,16 @@
+// RUN: ttmlir-opt --ttir-shape-buckets="bucket-sizes=32" %s -o /dev/null 2>&1 | FileCheck %s
+// Softmax and matmul contractions over a bucketed dimension are only correct
+// if the padding is masked out, which the pass can't check.
+module attributes {} {
+  func.func @forward(%arg0: tensor<1x?xbf16>, %arg1: tensor<?x64xbf16>) -> tensor<1x64xbf16> {
+    %c1 = arith.constant 1 : index
+    %dim = tensor.dim %arg0, %c1 : tensor<1x?xbf16>
+    %0 = tensor.empty(%dim) : tensor<1x?xbf16>
+    // CHECK: warning: normalizes over dimension 1, which is padded for shape buckets
+    %1 = "ttir.softmax"(%arg0, %0) <{dimension = 1 : si32}> : (tensor<1x?xbf16>, tensor<1x?xbf16>) -> tensor<1x?xbf16>
+    %2 = tensor.empty() : tensor<1x64xbf16>
+    // CHECK: warning: contracts over a dimension which is padded for shape buckets
+    %3 = "ttir.matmul"(%1, %arg1, %2) : (tensor<1x?xbf16>, tensor<?x64xbf16>, tensor<1x64xbf16>) -> tensor<1x64xbf16>
+    return %3 : tensor<1x64xbf16>
+  }
+}
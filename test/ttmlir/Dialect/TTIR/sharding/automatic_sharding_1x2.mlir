@@ -0,0 +1,66 @@
+// RUN: ttmlir-opt --ttir-automatic-sharding="mesh-shape=1,2" %s | FileCheck %s
+// Unit tests for automatic sharding on a 1x2 mesh.
+
+module {
+  // Verify that a matmul with a sharded contraction dimension shards its
+  // other operand to match and sums the partial results, which moves fewer
+  // bytes than gathering the sharded operand.
+  // CHECK-LABEL: func.func @matmul_contracted
+  func.func @matmul_contracted(%arg0: tensor<64x1024xf32> {ttir.shard_dims = array<i64: -1, 1>}, %arg1: tensor<1024x64xf32>) -> tensor<64x64xf32> {
+    // CHECK-NOT: ttir.shard_dims
+    // CHECK: %[[A:.*]] = "ttir.mesh_shard"(%arg0
+    // CHECK-SAME: shard_dims = array<i64: -1, 1>
+    // CHECK-SAME: shard_direction = #tt.shard_direction<full_to_shard>
+    // CHECK-SAME: -> tensor<64x512xf32>
+    // CHECK: %[[B:.*]] = "ttir.mesh_shard"(%arg1
+    // CHECK-SAME: shard_dims = array<i64: -1, 0>
+    // CHECK-SAME: -> tensor<512x64xf32>
+    // CHECK: %[[MATMUL:.*]] = "ttir.matmul"(%[[A]], %[[B]]
+    // CHECK-SAME: -> tensor<64x64xf32>
+    // CHECK: %[[REDUCED:.*]] = "ttir.all_reduce"(%[[MATMUL]]
+    // CHECK-SAME: reduce_type = #tt.reduce_type<sum>
+    // CHECK-SAME: replica_groups = dense<{{\[\[}}0, 1]]> : tensor<1x2xi64>
+    // CHECK: %[[RESULT:.*]] = "ttir.mesh_shard"(%[[REDUCED]]
+    // CHECK-SAME: shard_direction = #tt.shard_direction<shard_to_full>
+    // CHECK-SAME: shard_type = #tt.shard_type<replicate>
+    // CHECK: return %[[RESULT]]
+    %0 = tensor.empty() : tensor<64x64xf32>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<64x1024xf32>, tensor<1024x64xf32>, tensor<64x64xf32>) -> tensor<64x64xf32>
+    return %1 : tensor<64x64xf32>
+  }
+
+  // Verify that a matmul with a small sharded contraction dimension gathers
+  // it instead and shards its result along the columns.
+  // CHECK-LABEL: func.func @matmul_gathered
+  func.func @matmul_gathered(%arg0: tensor<1024x64xf32> {ttir.shard_dims = array<i64: -1, 1>}, %arg1: tensor<64x1024xf32>) -> tensor<1024x1024xf32> {
+    // CHECK: %[[A:.*]] = "ttir.mesh_shard"(%arg0
+    // CHECK-SAME: -> tensor<1024x32xf32>
+    // CHECK: %[[B:.*]] = "ttir.mesh_shard"(%arg1
+    // CHECK-SAME: shard_dims = array<i64: -1, 1>
+    // CHECK-SAME: -> tensor<64x512xf32>
+    // CHECK: %[[GATHERED:.*]] = "ttir.all_gather"(%[[A]]
+    // CHECK-SAME: cluster_axis = 1 : si32, dim = 1 : si32
+    // CHECK-SAME: -> tensor<1024x64xf32>
+    // CHECK: %[[MATMUL:.*]] = "ttir.matmul"(%[[GATHERED]], %[[B]]
+    // CHECK-SAME: -> tensor<1024x512xf32>
+    // CHECK-NOT: "ttir.all_reduce"
+    // CHECK: %[[RESULT:.*]] = "ttir.mesh_shard"(%[[MATMUL]]
+    // CHECK-SAME: shard_dims = array<i64: -1, 1>
+    // CHECK-SAME: shard_shape = array<i64: 1, 2>
+    // CHECK-SAME: shard_type = #tt.shard_type<devices>
+    // CHECK-SAME: -> tensor<1024x1024xf32>
+    // CHECK: return %[[RESULT]]
+    %0 = tensor.empty() : tensor<1024x1024xf32>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<1024x64xf32>, tensor<64x1024xf32>, tensor<1024x1024xf32>) -> tensor<1024x1024xf32>
+    return %1 : tensor<1024x1024xf32>
+  }
+
+  // Verify that functions without seeds are left alone.
+  // CHECK-LABEL: func.func @no_seeds
+  func.func @no_seeds(%arg0: tensor<64x64xf32>) -> tensor<64x64xf32> {
+    // CHECK-NOT: "ttir.mesh_shard"
+    %0 = tensor.empty() : tensor<64x64xf32>
+    %1 = "ttir.relu"(%arg0, %0) <{operandSegmentSizes = array<i32: 1, 1>}> : (tensor<64x64xf32>, tensor<64x64xf32>) -> tensor<64x64xf32>
+    return %1 : tensor<64x64xf32>
+  }
+}
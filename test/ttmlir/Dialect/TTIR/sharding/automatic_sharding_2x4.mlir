@@ -0,0 +1,68 @@
+// RUN: ttmlir-opt --ttir-automatic-sharding="mesh-shape=2,4" %s | FileCheck %s
+// Unit tests for automatic sharding on a 2x4 mesh.
+
+module {
+  // Verify that shardings propagate through elementwise ops, reductions and
+  // reshapes, and that a sum over a sharded dimension is finished with an
+  // all_reduce along the mesh rows.
+  // CHECK-LABEL: func.func @propagate
+  func.func @propagate(%arg0: tensor<8x128x64xf32> {ttir.shard_dims = array<i64: 0, 1>}, %arg1: tensor<8x128x64xf32>) -> tensor<8x64xf32> {
+    // CHECK: %[[A:.*]] = "ttir.mesh_shard"(%arg0
+    // CHECK-SAME: shard_shape = array<i64: 2, 4, 1>
+    // CHECK-SAME: -> tensor<4x32x64xf32>
+    // CHECK: %[[B:.*]] = "ttir.mesh_shard"(%arg1
+    // CHECK-SAME: shard_dims = array<i64: 0, 1>
+    // CHECK-SAME: -> tensor<4x32x64xf32>
+    // CHECK: %[[ADD:.*]] = "ttir.add"(%[[A]], %[[B]]
+    // CHECK-SAME: -> tensor<4x32x64xf32>
+    // CHECK: %[[SUM:.*]] = "ttir.sum"(%[[ADD]]
+    // CHECK-SAME: -> tensor<4x1x64xf32>
+    // CHECK: %[[REDUCED:.*]] = "ttir.all_reduce"(%[[SUM]]
+    // CHECK-SAME: replica_groups = dense<{{\[\[}}0, 1, 2, 3], [4, 5, 6, 7]]>
+    // CHECK: %[[RESHAPE:.*]] = "ttir.reshape"(%[[REDUCED]]
+    // CHECK-SAME: shape = [4 : i32, 64 : i32]
+    // CHECK-SAME: -> tensor<4x64xf32>
+    // CHECK: %[[RESULT:.*]] = "ttir.mesh_shard"(%[[RESHAPE]]
+    // CHECK-SAME: shard_dims = array<i64: 0, -1>
+    // CHECK-SAME: shard_shape = array<i64: 2, 1>
+    // CHECK-SAME: -> tensor<8x64xf32>
+    // CHECK: return %[[RESULT]]
+    %0 = tensor.empty() : tensor<8x128x64xf32>
+    %1 = "ttir.add"(%arg0, %arg1, %0) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<8x128x64xf32>, tensor<8x128x64xf32>, tensor<8x128x64xf32>) -> tensor<8x128x64xf32>
+    %2 = tensor.empty() : tensor<8x1x64xf32>
+    %3 = "ttir.sum"(%1, %2) <{dim_arg = [1 : i32], keep_dim = true}> : (tensor<8x128x64xf32>, tensor<8x1x64xf32>) -> tensor<8x1x64xf32>
+    %4 = tensor.empty() : tensor<8x64xf32>
+    %5 = "ttir.reshape"(%3, %4) <{shape = [8 : i32, 64 : i32]}> : (tensor<8x1x64xf32>, tensor<8x64xf32>) -> tensor<8x64xf32>
+    return %5 : tensor<8x64xf32>
+  }
+
+  // Verify that a mean over a sharded dimension gathers its input first.
+  // CHECK-LABEL: func.func @mean_gathers
+  func.func @mean_gathers(%arg0: tensor<32x256xf32> {ttir.shard_dims = array<i64: -1, 1>}) -> tensor<32x1xf32> {
+    // CHECK: %[[A:.*]] = "ttir.mesh_shard"(%arg0
+    // CHECK-SAME: -> tensor<32x64xf32>
+    // CHECK: %[[GATHERED:.*]] = "ttir.all_gather"(%[[A]]
+    // CHECK-SAME: cluster_axis = 1 : si32, dim = 1 : si32
+    // CHECK-SAME: -> tensor<32x256xf32>
+    // CHECK: "ttir.mean"(%[[GATHERED]]
+    // CHECK-SAME: -> tensor<32x1xf32>
+    // CHECK-NOT: "ttir.all_reduce"
+    %0 = tensor.empty() : tensor<32x1xf32>
+    %1 = "ttir.mean"(%arg0, %0) <{dim_arg = [1 : i32], keep_dim = true}> : (tensor<32x256xf32>, tensor<32x1xf32>) -> tensor<32x1xf32>
+    return %1 : tensor<32x1xf32>
+  }
+
+  // Verify that ops without a sharding rule run on replicated operands.
+  // CHECK-LABEL: func.func @unsupported_op
+  func.func @unsupported_op(%arg0: tensor<64x128xf32> {ttir.shard_dims = array<i64: 0, -1>}) -> tensor<128x64xf32> {
+    // CHECK: %[[A:.*]] = "ttir.mesh_shard"(%arg0
+    // CHECK-SAME: -> tensor<32x128xf32>
+    // CHECK: %[[GATHERED:.*]] = "ttir.all_gather"(%[[A]]
+    // CHECK-SAME: cluster_axis = 0 : si32, dim = 0 : si32
+    // CHECK-SAME: -> tensor<64x128xf32>
+    // CHECK: "ttir.transpose"(%[[GATHERED]]
+    %0 = tensor.empty() : tensor<128x64xf32>
+    %1 = "ttir.transpose"(%arg0, %0) <{dim0 = 0 : si32, dim1 = 1 : si32}> : (tensor<64x128xf32>, tensor<128x64xf32>) -> tensor<128x64xf32>
+    return %1 : tensor<128x64xf32>
+  }
+}
@@ -0,0 +1,50 @@
+// RUN: ttmlir-opt --ttir-load-system-desc --ttir-implicit-device --ttir-attach-metal-layout="select-grid=true" %s | FileCheck %s
+// RUN: ttmlir-opt --ttir-load-system-desc --ttir-implicit-device --ttir-attach-metal-layout %s | FileCheck %s --check-prefix=SINGLE
+
+// Tensors without a layout are spread over the largest grid that evenly
+// divides their tile counts, capped by the 8x8 worker grid.
+// CHECK-DAG: #[[GRID_2x4:layout[0-9]*]] = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <2x4>, memref<32x32xf32, #l1_>
+// CHECK-DAG: #[[GRID_8x8:layout[0-9]*]] = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <8x8>, memref<32x128xf32, #l1_>
+// CHECK-DAG: #[[GRID_8x4:layout[0-9]*]] = #tt.metal_layout<(d0, d1, d2) -> (d0 * 64 + d1, d2), undef, <8x4>, memref<64x32xf32, #l1_>
+// CHECK-DAG: #[[GRID_1x6:layout[0-9]*]] = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <1x6>, memref<50x32xf32, #l1_>
+// SINGLE-NOT: #tt.metal_layout<{{.*}}<2x4>
+// SINGLE: #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <1x1>, memref<64x128xf32, #l1_>
+
+// Operands and result share a shape and therefore a grid, so the shards line
+// up without a relayout.
+// CHECK-LABEL: func.func @eltwise(
+// CHECK-SAME: %arg0: tensor<64x128xf32, #[[GRID_2x4]]>
+// CHECK-SAME: %arg1: tensor<64x128xf32, #[[GRID_2x4]]>
+// CHECK-SAME: ) -> tensor<64x128xf32, #[[GRID_2x4]]>
+func.func @eltwise(%arg0: tensor<64x128xf32>, %arg1: tensor<64x128xf32>) -> tensor<64x128xf32> {
+  // CHECK: tensor.empty() : tensor<64x128xf32, #[[GRID_2x4]]>
+  %0 = tensor.empty() : tensor<64x128xf32>
+  %1 = "ttir.add"(%arg0, %arg1, %0) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<64x128xf32>, tensor<64x128xf32>, tensor<64x128xf32>) -> tensor<64x128xf32>
+  return %1 : tensor<64x128xf32>
+}
+
+// CHECK-LABEL: func.func @capped_by_worker_grid(
+// CHECK-SAME: tensor<256x1024xf32, #[[GRID_8x8]]>
+func.func @capped_by_worker_grid(%arg0: tensor<256x1024xf32>) -> tensor<256x1024xf32> {
+  %0 = tensor.empty() : tensor<256x1024xf32>
+  %1 = "ttir.exp"(%arg0, %0) <{operandSegmentSizes = array<i32: 1, 1>}> : (tensor<256x1024xf32>, tensor<256x1024xf32>) -> tensor<256x1024xf32>
+  return %1 : tensor<256x1024xf32>
+}
+
+// 8x64 rows collapse onto 16 row tiles, which split evenly over 8 cores.
+// CHECK-LABEL: func.func @collapsed(
+// CHECK-SAME: tensor<8x64x128xf32, #[[GRID_8x4]]>
+func.func @collapsed(%arg0: tensor<8x64x128xf32>) -> tensor<8x64x128xf32> {
+  %0 = tensor.empty() : tensor<8x64x128xf32>
+  %1 = "ttir.exp"(%arg0, %0) <{operandSegmentSizes = array<i32: 1, 1>}> : (tensor<8x64x128xf32>, tensor<8x64x128xf32>) -> tensor<8x64x128xf32>
+  return %1 : tensor<8x64x128xf32>
+}
+
+// Rows that are not tile aligned stay on a single row of cores.
+// CHECK-LABEL: func.func @unaligned(
+// CHECK-SAME: tensor<50x192xf32, #[[GRID_1x6]]>
+func.func @unaligned(%arg0: tensor<50x192xf32>) -> tensor<50x192xf32> {
+  %0 = tensor.empty() : tensor<50x192xf32>
+  %1 = "ttir.exp"(%arg0, %0) <{operandSegmentSizes = array<i32: 1, 1>}> : (tensor<50x192xf32>, tensor<50x192xf32>) -> tensor<50x192xf32>
+  return %1 : tensor<50x192xf32>
+}
@@ -0,0 +1,39 @@
+// RUN: ttmlir-opt --ttir-to-ttmetal-backend-pipeline="enable-multicast=true" %s | FileCheck %s
+// RUN: ttmlir-opt --ttir-to-ttmetal-backend-pipeline %s | FileCheck %s --check-prefix=UNICAST
+#l1_ = #tt.memory_space<l1>
+#layout_lhs = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <2x4>, memref<32x2048xf32, #l1_>>
+#layout_rhs = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <4x2>, memref<2048x32xf32, #l1_>>
+#layout_out = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <2x2>, memref<32x32xf32, #l1_>>
+
+// Every core of an output row reads the same K blocks of A, and every core of
+// an output column the same K blocks of B. With multicast, only the first
+// core of each row (column) reads them and multicasts every K block to the
+// rest, which take part in a ready/valid semaphore handshake instead of
+// reading.
+func.func @matmul(%arg0: tensor<64x8192xf32, #layout_lhs>, %arg1: tensor<8192x64xf32, #layout_rhs>) -> tensor<64x64xf32, #layout_out> {
+  %0 = tensor.empty() : tensor<64x64xf32, #layout_out>
+  // CHECK: "ttmetal.enqueue_program"
+  // CHECK: "ttkernel.matmul_tiles"
+  // A sender reads a K block, waits for its receivers and multicasts it.
+  // CHECK: scf.for
+  // CHECK: "ttkernel.noc_async_read"
+  // CHECK: "ttkernel.noc_async_read_barrier"
+  // CHECK: "ttkernel.noc_semaphore_wait"
+  // CHECK: "ttkernel.noc_semaphore_set"
+  // CHECK: "ttkernel.noc_async_write_multicast_loopback_src"
+  // CHECK: "ttkernel.noc_semaphore_set_multicast_loopback_src"
+  // CHECK: "ttkernel.cb_push_back"
+  // A receiver signals the sender once its slot is reserved and waits for the
+  // block rather than reading it.
+  // CHECK: scf.for
+  // CHECK: "ttkernel.cb_reserve_back"
+  // CHECK: "ttkernel.noc_semaphore_set"
+  // CHECK: "ttkernel.noc_semaphore_inc"
+  // CHECK: "ttkernel.noc_async_read_barrier"
+  // CHECK: "ttkernel.noc_semaphore_wait"
+  // CHECK: "ttkernel.cb_push_back"
+  // UNICAST-NOT: "ttkernel.noc_semaphore_inc"
+  // UNICAST-NOT: "ttkernel.noc_async_write_multicast_loopback_src"
+  %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<64x8192xf32, #layout_lhs>, tensor<8192x64xf32, #layout_rhs>, tensor<64x64xf32, #layout_out>) -> tensor<64x64xf32, #layout_out>
+  return %1 : tensor<64x64xf32, #layout_out>
+}
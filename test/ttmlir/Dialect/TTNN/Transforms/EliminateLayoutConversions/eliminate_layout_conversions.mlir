@@ -0,0 +1,79 @@
+// RUN: ttmlir-opt --ttnn-eliminate-layout-conversions %s | FileCheck %s
+#device = #tt.device<workerGrid = #tt.grid<8x8, (d0, d1) -> (0, d0, d1)>, l1Map = (d0, d1)[s0, s1] -> (0, d0 floordiv s0, d1 floordiv s1, (d0 mod s0) * s1 + d1 mod s1), dramMap = (d0, d1)[s0, s1] -> (0, 0, ((((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) floordiv 8192) mod 12, (((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) floordiv 98304 + (((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) mod 8192), meshShape = , chipIds = [0]>
+#system_desc = #tt.system_desc<[{role = host, target_triple = "x86_64-pc-linux"}], [{arch = <wormhole_b0>, grid = 8x8, l1_size = 1499136, num_dram_channels = 12, dram_channel_size = 1073741824, noc_l1_address_align_bytes = 16, pcie_address_align_bytes = 32, noc_dram_address_align_bytes = 32, l1_unreserved_base = 99104, erisc_l1_unreserved_base = 104480, dram_unreserved_base = 32, dram_unreserved_end = 1073196736, physical_cores = {worker = [ 18x18,  18x19,  18x20,  18x21,  18x22,  18x23,  18x24,  18x25,  19x18,  19x19,  19x20,  19x21,  19x22,  19x23,  19x24,  19x25,  20x18,  20x19,  20x20,  20x21,  20x22,  20x23,  20x24,  20x25,  21x18,  21x19,  21x20,  21x21,  21x22,  21x23,  21x24,  21x25,  22x18,  22x19,  22x20,  22x21,  22x22,  22x23,  22x24,  22x25,  23x18,  23x19,  23x20,  23x21,  23x22,  23x23,  23x24,  23x25,  24x18,  24x19,  24x20,  24x21,  24x22,  24x23,  24x24,  24x25,  25x18,  25x19,  25x20,  25x21,  25x22,  25x23,  25x24,  25x25] dram = [ 0x0,  0x1,  0x2,  0x3,  0x4,  0x5,  0x6,  0x7,  0x8,  0x9,  0x10,  0x11] eth = [ 17x25] eth_inactive = [ 16x18,  16x19,  16x20,  16x21,  16x22,  16x23,  16x24,  16x25,  17x19,  17x20,  17x22,  17x23,  17x24]}, supported_data_types = [<f32>, <f16>, <bf16>, <bfp_f8>, <bfp_bf8>, <bfp_f4>, <bfp_bf4>, <bfp_f2>, <bfp_bf2>, <u32>, <u16>, <u8>], supported_tile_sizes = [ 4x16,  16x16,  32x16,  4x32,  16x32,  32x32], num_cbs = 32}, {arch = <wormhole_b0>, grid = 8x8, l1_size = 1499136, num_dram_channels = 12, dram_channel_size = 1073741824, noc_l1_address_align_bytes = 16, pcie_address_align_bytes = 32, noc_dram_address_align_bytes = 32, l1_unreserved_base = 99104, erisc_l1_unreserved_base = 104480, dram_unreserved_base = 32, dram_unreserved_end = 1073196736, physical_cores = {worker = [ 18x18,  18x19,  18x20,  18x21,  18x22,  18x23,  18x24,  18x25,  19x18,  19x19,  19x20,  19x21,  19x22,  19x23,  19x24,  19x25,  20x18,  20x19,  20x20,  20x21,  20x22,  20x23,  20x24,  20x25,  21x18,  21x19,  21x20,  21x21,  21x22,  21x23,  21x24,  21x25,  22x18,  22x19,  22x20,  22x21,  22x22,  22x23,  22x24,  22x25,  23x18,  23x19,  23x20,  23x21,  23x22,  23x23,  23x24,  23x25,  24x18,  24x19,  24x20,  24x21,  24x22,  24x23,  24x24,  24x25,  25x18,  25x19,  25x20,  25x21,  25x22,  25x23,  25x24,  25x25] dram = [ 0x0,  0x1,  0x2,  0x3,  0x4,  0x5,  0x6,  0x7,  0x8,  0x9,  0x10,  0x11] eth = [ 16x25] eth_inactive = [ 16x19,  16x20,  16x21,  16x22,  16x23,  16x24,  17x18,  17x19,  17x20,  17x21,  17x22,  17x23,  17x24,  17x25]}, supported_data_types = [<f32>, <f16>, <bf16>, <bfp_f8>, <bfp_bf8>, <bfp_f4>, <bfp_bf4>, <bfp_f2>, <bfp_bf2>, <u32>, <u16>, <u8>], supported_tile_sizes = [ 4x16,  16x16,  32x16,  4x32,  16x32,  32x32], num_cbs = 32}], [0, 1], [3 : i32, 0 : i32], [ 0x0x0x0], [<[0, 8, 0], [1, 0, 0]>]>
+#dram = #ttnn.buffer_type<dram>
+#l1 = #ttnn.buffer_type<l1>
+#system_memory = #ttnn.buffer_type<system_memory>
+#ttnn_layout_host_rm = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <1x1>, memref<64x128xf32, #system_memory>>
+#ttnn_layout_device_rm = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <1x1>, memref<64x128xf32, #dram>, <interleaved>>
+#ttnn_layout_device_tile = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <1x1>, memref<2x4x!tt.tile<32x32, f32>, #dram>, <interleaved>>
+#ttnn_layout_device_tile_bf16 = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <1x1>, memref<2x4x!tt.tile<32x32, bf16>, #dram>, <interleaved>>
+#ttnn_layout_l1_tile = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <1x1>, memref<2x4x!tt.tile<32x32, f32>, #l1>, <interleaved>>
+module attributes {tt.device = #device, tt.system_desc = #system_desc} {
+  // CHECK-LABEL: func.func @untilize_tilize
+  func.func @untilize_tilize(%arg0: tensor<64x128xf32, #ttnn_layout_device_tile>) -> tensor<64x128xf32, #ttnn_layout_device_tile> {
+    // CHECK-NOT: "ttnn.to_layout"
+    // CHECK: return %arg0
+    %0 = "ttnn.to_layout"(%arg0) <{layout = #ttnn.layout<row_major>}> : (tensor<64x128xf32, #ttnn_layout_device_tile>) -> tensor<64x128xf32, #ttnn_layout_device_rm>
+    %1 = "ttnn.to_layout"(%0) <{layout = #ttnn.layout<tile>}> : (tensor<64x128xf32, #ttnn_layout_device_rm>) -> tensor<64x128xf32, #ttnn_layout_device_tile>
+    return %1 : tensor<64x128xf32, #ttnn_layout_device_tile>
+  }
+
+  // CHECK-LABEL: func.func @dram_l1_dram
+  func.func @dram_l1_dram(%arg0: tensor<64x128xf32, #ttnn_layout_device_tile>) -> tensor<64x128xf32, #ttnn_layout_device_tile> {
+    // CHECK-NOT: "ttnn.to_memory_config"
+    // CHECK: return %arg0
+    %0 = "ttnn.to_memory_config"(%arg0) <{memory_config = #ttnn.memory_config<#l1, <<2x4>>, <interleaved>>}> : (tensor<64x128xf32, #ttnn_layout_device_tile>) -> tensor<64x128xf32, #ttnn_layout_l1_tile>
+    %1 = "ttnn.to_memory_config"(%0) <{memory_config = #ttnn.memory_config<#dram, <<2x4>>, <interleaved>>}> : (tensor<64x128xf32, #ttnn_layout_l1_tile>) -> tensor<64x128xf32, #ttnn_layout_device_tile>
+    return %1 : tensor<64x128xf32, #ttnn_layout_device_tile>
+  }
+
+  // CHECK-LABEL: func.func @widening_typecast_round_trip
+  func.func @widening_typecast_round_trip(%arg0: tensor<64x128xbf16, #ttnn_layout_device_tile_bf16>) -> tensor<64x128xbf16, #ttnn_layout_device_tile_bf16> {
+    // CHECK-NOT: "ttnn.typecast"
+    // CHECK: return %arg0
+    %0 = "ttnn.typecast"(%arg0) <{dtype = #tt.supportedDataTypes<f32>}> : (tensor<64x128xbf16, #ttnn_layout_device_tile_bf16>) -> tensor<64x128xf32, #ttnn_layout_device_tile>
+    %1 = "ttnn.typecast"(%0) <{dtype = #tt.supportedDataTypes<bf16>}> : (tensor<64x128xf32, #ttnn_layout_device_tile>) -> tensor<64x128xbf16, #ttnn_layout_device_tile_bf16>
+    return %1 : tensor<64x128xbf16, #ttnn_layout_device_tile_bf16>
+  }
+
+  // Casting f32 to bf16 loses precision, so the round trip is kept.
+  // CHECK-LABEL: func.func @narrowing_typecast_round_trip
+  func.func @narrowing_typecast_round_trip(%arg0: tensor<64x128xf32, #ttnn_layout_device_tile>) -> tensor<64x128xf32, #ttnn_layout_device_tile> {
+    // CHECK: %[[CAST:.*]] = "ttnn.typecast"(%arg0)
+    // CHECK: %[[BACK:.*]] = "ttnn.typecast"(%[[CAST]])
+    // CHECK: return %[[BACK]]
+    %0 = "ttnn.typecast"(%arg0) <{dtype = #tt.supportedDataTypes<bf16>}> : (tensor<64x128xf32, #ttnn_layout_device_tile>) -> tensor<64x128xbf16, #ttnn_layout_device_tile_bf16>
+    %1 = "ttnn.typecast"(%0) <{dtype = #tt.supportedDataTypes<f32>}> : (tensor<64x128xbf16, #ttnn_layout_device_tile_bf16>) -> tensor<64x128xf32, #ttnn_layout_device_tile>
+    return %1 : tensor<64x128xf32, #ttnn_layout_device_tile>
+  }
+
+  // The same conversion feeding two consumers is done once.
+  // CHECK-LABEL: func.func @shared_conversion
+  func.func @shared_conversion(%arg0: tensor<64x128xf32, #ttnn_layout_host_rm>) -> (tensor<64x128xf32, #ttnn_layout_device_tile>, tensor<64x128xf32, #ttnn_layout_device_tile>) {
+    // CHECK: %[[TO_DEVICE:.*]] = "ttnn.to_device"
+    // CHECK: %[[TILIZED:.*]] = "ttnn.to_layout"(%[[TO_DEVICE]])
+    // CHECK-NOT: "ttnn.to_device"
+    // CHECK-NOT: "ttnn.to_layout"
+    // CHECK: return %[[TILIZED]], %[[TILIZED]]
+    %0 = "ttnn.get_device"() <{mesh_shape = #ttnn<mesh_shape 1x1>}> : () -> !tt.device<#device>
+    %1 = "ttnn.to_device"(%arg0, %0) <{memory_config = #ttnn.memory_config<#dram, <<64x128>>, <interleaved>>}> : (tensor<64x128xf32, #ttnn_layout_host_rm>, !tt.device<#device>) -> tensor<64x128xf32, #ttnn_layout_device_rm>
+    %2 = "ttnn.to_layout"(%1) <{layout = #ttnn.layout<tile>}> : (tensor<64x128xf32, #ttnn_layout_device_rm>) -> tensor<64x128xf32, #ttnn_layout_device_tile>
+    %3 = "ttnn.to_device"(%arg0, %0) <{memory_config = #ttnn.memory_config<#dram, <<64x128>>, <interleaved>>}> : (tensor<64x128xf32, #ttnn_layout_host_rm>, !tt.device<#device>) -> tensor<64x128xf32, #ttnn_layout_device_rm>
+    %4 = "ttnn.to_layout"(%3) <{layout = #ttnn.layout<tile>}> : (tensor<64x128xf32, #ttnn_layout_device_rm>) -> tensor<64x128xf32, #ttnn_layout_device_tile>
+    return %2, %4 : tensor<64x128xf32, #ttnn_layout_device_tile>, tensor<64x128xf32, #ttnn_layout_device_tile>
+  }
+
+  // Reusing the L1 tensor would keep it alive across the other op, so the
+  // round trip is kept.
+  // CHECK-LABEL: func.func @l1_round_trip_across_op
+  func.func @l1_round_trip_across_op(%arg0: tensor<64x128xf32, #ttnn_layout_l1_tile>) -> tensor<64x128xf32, #ttnn_layout_l1_tile> {
+    // CHECK: %[[TO_DRAM:.*]] = "ttnn.to_memory_config"(%arg0)
+    // CHECK: %[[TO_L1:.*]] = "ttnn.to_memory_config"(%[[TO_DRAM]])
+    // CHECK: return %[[TO_L1]]
+    %0 = "ttnn.to_memory_config"(%arg0) <{memory_config = #ttnn.memory_config<#dram, <<2x4>>, <interleaved>>}> : (tensor<64x128xf32, #ttnn_layout_l1_tile>) -> tensor<64x128xf32, #ttnn_layout_device_tile>
+    %1 = "ttnn.get_device"() <{mesh_shape = #ttnn<mesh_shape 1x1>}> : () -> !tt.device<#device>
+    %2 = "ttnn.to_memory_config"(%0) <{memory_config = #ttnn.memory_config<#l1, <<2x4>>, <interleaved>>}> : (tensor<64x128xf32, #ttnn_layout_device_tile>) -> tensor<64x128xf32, #ttnn_layout_l1_tile>
+    return %2 : tensor<64x128xf32, #ttnn_layout_l1_tile>
+  }
+}
@@ -0,0 +1,98 @@
+// RUN: ttmlir-opt --split-input-file --ttnn-lower-ccl %s | FileCheck %s
+// Unit tests for the lowering of ttnn all_reduce ops on a 2x4 mesh. With the
+// default cost model a ring along an axis of 4 devices beats a line for
+// tensors larger than 100000 bytes.
+
+#device = #tt.device<workerGrid = #tt.grid<8x8, (d0, d1) -> (0, d0, d1)>, l1Map = (d0, d1)[s0, s1] -> (0, d0 floordiv s0, d1 floordiv s1, (d0 mod s0) * s1 + d1 mod s1), dramMap = (d0, d1)[s0, s1] -> (0, 0, ((((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) floordiv 8192) mod 12, (((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) floordiv 98304 + (((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) mod 8192), meshShape = 2x4, chipIds = [0, 1, 2, 3, 4, 5, 6, 7]>
+#dram = #ttnn.buffer_type<dram>
+#ttnn_layout = #ttnn.ttnn_layout<(d0, d1, d2, d3) -> (d0 * 32 + d1 * 32 + d2, d3), <1x1>, memref<1x4x!tt.tile<32x32, f32>, #dram>, <interleaved>>
+module attributes {tt.device = #device} {
+  // Verify that a small all_reduce along mesh axis 1 is lowered to a line.
+  func.func @all_reduce_line(%arg0: tensor<1x1x32x128xf32, #ttnn_layout>) -> tensor<1x1x32x128xf32, #ttnn_layout> {
+    %0 = "ttnn.get_device"() <{mesh_shape = #ttnn<mesh_shape 2x4>}> : () -> !tt.device<#device>
+    // CHECK: "ttnn.reduce_scatter"
+    // CHECK-NOT: ring
+    // CHECK-SAME: -> tensor<1x1x32x32xf32
+    // CHECK: "ttnn.all_gather"
+    // CHECK-NOT: ring
+    // CHECK-SAME: -> tensor<1x1x32x128xf32
+    // CHECK-NOT: "ttnn.all_reduce"
+    %1 = "ttnn.all_reduce"(%arg0, %0) <{cluster_axis = 1 : si32, math_op = #tt.reduce_type<sum>, num_links = 1 : si32, scatter_dim = 3 : si32, scatter_num = 4 : si32}> : (tensor<1x1x32x128xf32, #ttnn_layout>, !tt.device<#device>) -> tensor<1x1x32x128xf32, #ttnn_layout>
+    return %1 : tensor<1x1x32x128xf32, #ttnn_layout>
+  }
+}
+
+// -----
+#device = #tt.device<workerGrid = #tt.grid<8x8, (d0, d1) -> (0, d0, d1)>, l1Map = (d0, d1)[s0, s1] -> (0, d0 floordiv s0, d1 floordiv s1, (d0 mod s0) * s1 + d1 mod s1), dramMap = (d0, d1)[s0, s1] -> (0, 0, ((((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) floordiv 8192) mod 12, (((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) floordiv 98304 + (((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) mod 8192), meshShape = 2x4, chipIds = [0, 1, 2, 3, 4, 5, 6, 7]>
+#dram = #ttnn.buffer_type<dram>
+#ttnn_layout = #ttnn.ttnn_layout<(d0, d1, d2, d3) -> (d0 * 128 + d1 * 128 + d2, d3), <1x1>, memref<4x32x!tt.tile<32x32, f32>, #dram>, <interleaved>>
+module attributes {tt.device = #device} {
+  // Verify that a large all_reduce along mesh axis 1 is lowered to a ring.
+  func.func @all_reduce_ring(%arg0: tensor<1x1x128x1024xf32, #ttnn_layout>) -> tensor<1x1x128x1024xf32, #ttnn_layout> {
+    %0 = "ttnn.get_device"() <{mesh_shape = #ttnn<mesh_shape 2x4>}> : () -> !tt.device<#device>
+    // CHECK: "ttnn.reduce_scatter"
+    // CHECK-SAME: topology = #ttnn.topology<ring>
+    // CHECK-SAME: -> tensor<1x1x128x256xf32
+    // CHECK: "ttnn.all_gather"
+    // CHECK-SAME: topology = #ttnn.topology<ring>
+    // CHECK-SAME: -> tensor<1x1x128x1024xf32
+    %1 = "ttnn.all_reduce"(%arg0, %0) <{cluster_axis = 1 : si32, math_op = #tt.reduce_type<sum>, num_links = 1 : si32, scatter_dim = 3 : si32, scatter_num = 4 : si32}> : (tensor<1x1x128x1024xf32, #ttnn_layout>, !tt.device<#device>) -> tensor<1x1x128x1024xf32, #ttnn_layout>
+    return %1 : tensor<1x1x128x1024xf32, #ttnn_layout>
+  }
+}
+
+// -----
+#device = #tt.device<workerGrid = #tt.grid<8x8, (d0, d1) -> (0, d0, d1)>, l1Map = (d0, d1)[s0, s1] -> (0, d0 floordiv s0, d1 floordiv s1, (d0 mod s0) * s1 + d1 mod s1), dramMap = (d0, d1)[s0, s1] -> (0, 0, ((((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) floordiv 8192) mod 12, (((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) floordiv 98304 + (((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) mod 8192), meshShape = 2x4, chipIds = [0, 1, 2, 3, 4, 5, 6, 7]>
+#dram = #ttnn.buffer_type<dram>
+#ttnn_layout = #ttnn.ttnn_layout<(d0, d1, d2, d3) -> (d0 * 128 + d1 * 128 + d2, d3), <1x1>, memref<4x32x!tt.tile<32x32, f32>, #dram>, <interleaved>>
+module attributes {tt.device = #device} {
+  // Verify that an all_reduce over the whole mesh reduces along mesh axis 1
+  // over a ring first and along mesh axis 0 over a line second.
+  func.func @all_reduce_torus(%arg0: tensor<1x1x128x1024xf32, #ttnn_layout>) -> tensor<1x1x128x1024xf32, #ttnn_layout> {
+    %0 = "ttnn.get_device"() <{mesh_shape = #ttnn<mesh_shape 2x4>}> : () -> !tt.device<#device>
+    // CHECK: "ttnn.reduce_scatter"
+    // CHECK-SAME: topology = #ttnn.topology<ring>
+    // CHECK-SAME: -> tensor<1x1x128x256xf32
+    // CHECK: "ttnn.reduce_scatter"
+    // CHECK-SAME: cluster_axis = 0 : si32
+    // CHECK-NOT: ring
+    // CHECK-SAME: -> tensor<1x1x128x128xf32
+    // CHECK: "ttnn.all_gather"
+    // CHECK-SAME: cluster_axis = 0 : si32
+    // CHECK-NOT: ring
+    // CHECK-SAME: -> tensor<1x1x128x256xf32
+    // CHECK: "ttnn.all_gather"
+    // CHECK-SAME: topology = #ttnn.topology<ring>
+    // CHECK-SAME: -> tensor<1x1x128x1024xf32
+    %1 = "ttnn.all_reduce"(%arg0, %0) <{math_op = #tt.reduce_type<sum>, num_links = 1 : si32, scatter_dim = 3 : si32, scatter_num = 8 : si32}> : (tensor<1x1x128x1024xf32, #ttnn_layout>, !tt.device<#device>) -> tensor<1x1x128x1024xf32, #ttnn_layout>
+    return %1 : tensor<1x1x128x1024xf32, #ttnn_layout>
+  }
+}
+
+// -----
+#device = #tt.device<workerGrid = #tt.grid<8x8, (d0, d1) -> (0, d0, d1)>, l1Map = (d0, d1)[s0, s1] -> (0, d0 floordiv s0, d1 floordiv s1, (d0 mod s0) * s1 + d1 mod s1), dramMap = (d0, d1)[s0, s1] -> (0, 0, ((((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) floordiv 8192) mod 12, (((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) floordiv 98304 + (((d0 floordiv s0) * 8 + d1 floordiv s1) * (s1 * s0) + (d0 mod s0) * s1 + d1 mod s1) mod 8192), meshShape = 2x4, chipIds = [0, 1, 2, 3, 4, 5, 6, 7]>
+#dram = #ttnn.buffer_type<dram>
+#ttnn_layout = #ttnn.ttnn_layout<(d0, d1, d2, d3) -> (d0 * 32 + d1 * 32 + d2, d3), <1x1>, memref<1x4x!tt.tile<32x32, f32>, #dram>, <interleaved>>
+module attributes {tt.device = #device} {
+  // Verify that independent small all_reduces are fused into a single one.
+  func.func @all_reduce_bucket(%arg0: tensor<1x1x32x128xf32, #ttnn_layout>, %arg1: tensor<1x1x32x128xf32, #ttnn_layout>) -> (tensor<1x1x32x128xf32, #ttnn_layout>, tensor<1x1x32x128xf32, #ttnn_layout>) {
+    %0 = "ttnn.get_device"() <{mesh_shape = #ttnn<mesh_shape 2x4>}> : () -> !tt.device<#device>
+    // CHECK: "ttnn.concat"
+    // CHECK-SAME: -> tensor<1x1x1x8192xf32
+    // CHECK: "ttnn.reduce_scatter"
+    // CHECK-SAME: -> tensor<1x1x1x2048xf32
+    // CHECK-NOT: "ttnn.reduce_scatter"
+    // CHECK: "ttnn.all_gather"
+    // CHECK-SAME: -> tensor<1x1x1x8192xf32
+    // CHECK-NOT: "ttnn.all_gather"
+    // CHECK: "ttnn.slice"
+    // CHECK-SAME: begins = [0 : i32, 0 : i32, 0 : i32, 0 : i32]
+    // CHECK-SAME: ends = [1 : i32, 1 : i32, 1 : i32, 4096 : i32]
+    // CHECK: "ttnn.slice"
+    // CHECK-SAME: begins = [0 : i32, 0 : i32, 0 : i32, 4096 : i32]
+    // CHECK-SAME: ends = [1 : i32, 1 : i32, 1 : i32, 8192 : i32]
+    %1 = "ttnn.all_reduce"(%arg0, %0) <{cluster_axis = 1 : si32, math_op = #tt.reduce_type<sum>, num_links = 1 : si32, scatter_dim = 3 : si32, scatter_num = 4 : si32}> : (tensor<1x1x32x128xf32, #ttnn_layout>, !tt.device<#device>) -> tensor<1x1x32x128xf32, #ttnn_layout>
+    %2 = "ttnn.all_reduce"(%arg1, %0) <{cluster_axis = 1 : si32, math_op = #tt.reduce_type<sum>, num_links = 1 : si32, scatter_dim = 3 : si32, scatter_num = 4 : si32}> : (tensor<1x1x32x128xf32, #ttnn_layout>, !tt.device<#device>) -> tensor<1x1x32x128xf32, #ttnn_layout>
+    return %1, %2 : tensor<1x1x32x128xf32, #ttnn_layout>, tensor<1x1x32x128xf32, #ttnn_layout>
+  }
+}
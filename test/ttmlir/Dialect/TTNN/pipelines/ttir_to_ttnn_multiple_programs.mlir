@@ -0,0 +1,33 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline %s | FileCheck %s
+// RUN: ttmlir-opt --mlir-disable-threading --ttir-to-ttnn-backend-pipeline %s | FileCheck %s
+
+// The function passes of the pipeline run on each program of the module
+// independently, so both programs are lowered the same way whether or not
+// threading is enabled.
+module attributes {} {
+  // CHECK-LABEL: func.func @prefill
+  func.func @prefill(%arg0: tensor<64x128xbf16>, %arg1: tensor<64x128xbf16>) -> tensor<64x128xbf16> {
+    %0 = tensor.empty() : tensor<64x128xbf16>
+    // CHECK: "ttnn.to_device"
+    // CHECK: %[[ADD:.*]] = "ttnn.add"
+    %1 = "ttir.add"(%arg0, %arg1, %0) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<64x128xbf16>, tensor<64x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+    %2 = tensor.empty() : tensor<64x128xbf16>
+    // CHECK: "ttnn.multiply"(%[[ADD]]
+    // CHECK: "ttnn.deallocate"(%[[ADD]])
+    %3 = "ttir.multiply"(%1, %arg1, %2) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<64x128xbf16>, tensor<64x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+    return %3 : tensor<64x128xbf16>
+  }
+
+  // CHECK-LABEL: func.func @decode
+  func.func @decode(%arg0: tensor<32x128xbf16>, %arg1: tensor<32x128xbf16>) -> tensor<32x128xbf16> {
+    %0 = tensor.empty() : tensor<32x128xbf16>
+    // CHECK: "ttnn.to_device"
+    // CHECK: %[[ADD:.*]] = "ttnn.add"
+    %1 = "ttir.add"(%arg0, %arg1, %0) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<32x128xbf16>, tensor<32x128xbf16>, tensor<32x128xbf16>) -> tensor<32x128xbf16>
+    %2 = tensor.empty() : tensor<32x128xbf16>
+    // CHECK: "ttnn.multiply"(%[[ADD]]
+    // CHECK: "ttnn.deallocate"(%[[ADD]])
+    %3 = "ttir.multiply"(%1, %arg1, %2) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<32x128xbf16>, tensor<32x128xbf16>, tensor<32x128xbf16>) -> tensor<32x128xbf16>
+    return %3 : tensor<32x128xbf16>
+  }
+}
@@ -83,4 +83,19 @@ module attributes {} {
     %0 = "ttir.constant"() <{value = dense<1.000000e+00> : tensor<64x128xf32>}> : () -> tensor<64x128xf32>
     return %0 : tensor<64x128xf32>
   }
+
+  func.func @test_constant_non_splat_float() -> tensor<2x4xf32> {
+    // CHECK: %{{[0-9]+}} = "ttnn.constant"
+    // CHECK-SAME: value = dense<{{.*}}> : tensor<2x4xf32>
+    // CHECK-SAME: tensor<2x4xf32
+    %0 = "ttir.constant"() <{value = dense<[[1.0, 2.0, 3.0, 4.0], [5.0, 6.0, 7.0, 8.0]]> : tensor<2x4xf32>}> : () -> tensor<2x4xf32>
+    return %0 : tensor<2x4xf32>
+  }
+
+  func.func @test_constant_non_splat_int() -> tensor<4xi32> {
+    // CHECK: %{{[0-9]+}} = "ttnn.constant"
+    // CHECK-SAME: value = dense<[1, 2, 3, 4]> : tensor<4xi32>
+    %0 = "ttir.constant"() <{value = dense<[1, 2, 3, 4]> : tensor<4xi32>}> : () -> tensor<4xi32>
+    return %0 : tensor<4xi32>
+  }
 }
@@ -0,0 +1,9 @@
+// RUN: not ttmlir-opt --ttir-to-ttnn-backend-pipeline %s 2>&1 | FileCheck %s
+// Negative test: non-splat f16 constants have no data type in TTNN.
+module {
+  func.func @constant_f16() -> tensor<4xf16> {
+    // CHECK: error: 'ttnn.constant' op Output data type f16 is not supported
+    %0 = "ttir.constant"() <{value = dense<[1.0, -2.0, 3.0, 4.0]> : tensor<4xf16>}> : () -> tensor<4xf16>
+    return %0 : tensor<4xf16>
+  }
+}
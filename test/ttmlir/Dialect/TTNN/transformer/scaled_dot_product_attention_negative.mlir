@@ -0,0 +1,47 @@
+// RUN: not ttmlir-opt --split-input-file %s 2>&1 | FileCheck %s
+// Negative tests for attention ops
+
+// CHECK: error: 'ttir.scaled_dot_product_attention' op Number of query heads must be a multiple of the number of key and value heads
+func.func @sdpa_heads(%arg0: tensor<1x8x128x64xbf16>, %arg1: tensor<1x3x128x64xbf16>, %arg2: tensor<1x3x128x64xbf16>) -> tensor<1x8x128x64xbf16> {
+  %0 = tensor.empty() : tensor<1x8x128x64xbf16>
+  %1 = "ttir.scaled_dot_product_attention"(%arg0, %arg1, %arg2, %0) : (tensor<1x8x128x64xbf16>, tensor<1x3x128x64xbf16>, tensor<1x3x128x64xbf16>, tensor<1x8x128x64xbf16>) -> tensor<1x8x128x64xbf16>
+  return %1 : tensor<1x8x128x64xbf16>
+}
+
+// -----
+// CHECK: error: 'ttir.scaled_dot_product_attention' op Attention mask must be absent for causal attention
+func.func @sdpa_causal_mask(%arg0: tensor<1x8x128x64xbf16>, %arg1: tensor<1x8x128x64xbf16>, %arg2: tensor<1x8x128x64xbf16>, %arg3: tensor<1x1x128x128xbf16>) -> tensor<1x8x128x64xbf16> {
+  %0 = tensor.empty() : tensor<1x8x128x64xbf16>
+  %1 = "ttir.scaled_dot_product_attention"(%arg0, %arg1, %arg2, %arg3, %0) <{is_causal = true}> : (tensor<1x8x128x64xbf16>, tensor<1x8x128x64xbf16>, tensor<1x8x128x64xbf16>, tensor<1x1x128x128xbf16>, tensor<1x8x128x64xbf16>) -> tensor<1x8x128x64xbf16>
+  return %1 : tensor<1x8x128x64xbf16>
+}
+
+// -----
+// CHECK: error: 'ttir.scaled_dot_product_attention' op Attention mask must be of the shape (batch or 1, num_heads or 1, 128, 128)
+func.func @sdpa_mask_shape(%arg0: tensor<1x8x128x64xbf16>, %arg1: tensor<1x8x128x64xbf16>, %arg2: tensor<1x8x128x64xbf16>, %arg3: tensor<1x1x128x64xbf16>) -> tensor<1x8x128x64xbf16> {
+  %0 = tensor.empty() : tensor<1x8x128x64xbf16>
+  %1 = "ttir.scaled_dot_product_attention"(%arg0, %arg1, %arg2, %arg3, %0) : (tensor<1x8x128x64xbf16>, tensor<1x8x128x64xbf16>, tensor<1x8x128x64xbf16>, tensor<1x1x128x64xbf16>, tensor<1x8x128x64xbf16>) -> tensor<1x8x128x64xbf16>
+  return %1 : tensor<1x8x128x64xbf16>
+}
+
+// -----
+// CHECK: error: 'ttir.paged_update_cache' op Input tensor must be of the shape (1, batch, 8, 64)
+func.func @paged_update_cache_input(%arg0: tensor<128x8x32x64xbf16>, %arg1: tensor<1x4x8x32xbf16>, %arg2: tensor<4xi32>, %arg3: tensor<4x32xi32>) -> tensor<128x8x32x64xbf16> {
+  %0 = "ttir.paged_update_cache"(%arg0, %arg1, %arg2, %arg3) : (tensor<128x8x32x64xbf16>, tensor<1x4x8x32xbf16>, tensor<4xi32>, tensor<4x32xi32>) -> tensor<128x8x32x64xbf16>
+  return %0 : tensor<128x8x32x64xbf16>
+}
+
+// -----
+// CHECK: error: 'ttir.paged_update_cache' op Page table tensor must have 4 rows, one per sequence
+func.func @paged_update_cache_page_table(%arg0: tensor<128x8x32x64xbf16>, %arg1: tensor<1x4x8x64xbf16>, %arg2: tensor<4xi32>, %arg3: tensor<2x32xi32>) -> tensor<128x8x32x64xbf16> {
+  %0 = "ttir.paged_update_cache"(%arg0, %arg1, %arg2, %arg3) : (tensor<128x8x32x64xbf16>, tensor<1x4x8x64xbf16>, tensor<4xi32>, tensor<2x32xi32>) -> tensor<128x8x32x64xbf16>
+  return %0 : tensor<128x8x32x64xbf16>
+}
+
+// -----
+// CHECK: error: 'ttir.paged_scaled_dot_product_attention_decode' op Query tensor must have the head size of the caches and a multiple of their number of heads
+func.func @paged_decode_heads(%arg0: tensor<1x4x12x64xbf16>, %arg1: tensor<128x8x32x64xbf16>, %arg2: tensor<128x8x32x64xbf16>, %arg3: tensor<4x32xi32>, %arg4: tensor<4xi32>) -> tensor<1x4x12x64xbf16> {
+  %0 = tensor.empty() : tensor<1x4x12x64xbf16>
+  %1 = "ttir.paged_scaled_dot_product_attention_decode"(%arg0, %arg1, %arg2, %arg3, %arg4, %0) : (tensor<1x4x12x64xbf16>, tensor<128x8x32x64xbf16>, tensor<128x8x32x64xbf16>, tensor<4x32xi32>, tensor<4xi32>, tensor<1x4x12x64xbf16>) -> tensor<1x4x12x64xbf16>
+  return %1 : tensor<1x4x12x64xbf16>
+}
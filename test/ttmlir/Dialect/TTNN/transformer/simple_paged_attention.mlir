@@ -0,0 +1,14 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline %s | FileCheck %s
+module attributes {} {
+  func.func @decode(%cache_k: tensor<128x8x32x64xbf16>, %cache_v: tensor<128x8x32x64xbf16>, %k: tensor<1x4x8x64xbf16>, %v: tensor<1x4x8x64xbf16>, %q: tensor<1x4x32x64xbf16>, %page_table: tensor<4x32xi32>, %cur_pos: tensor<4xi32>) -> tensor<1x4x32x64xbf16> {
+    // The page table and the positions are read by the kernels as int32.
+    // CHECK: "ttnn.paged_update_cache"{{.*}}tensor<4xsi32{{.*}}tensor<4x32xsi32
+    %0 = "ttir.paged_update_cache"(%cache_k, %k, %cur_pos, %page_table) : (tensor<128x8x32x64xbf16>, tensor<1x4x8x64xbf16>, tensor<4xi32>, tensor<4x32xi32>) -> tensor<128x8x32x64xbf16>
+    // CHECK: "ttnn.paged_update_cache"{{.*}}tensor<4xsi32{{.*}}tensor<4x32xsi32
+    %1 = "ttir.paged_update_cache"(%cache_v, %v, %cur_pos, %page_table) : (tensor<128x8x32x64xbf16>, tensor<1x4x8x64xbf16>, tensor<4xi32>, tensor<4x32xi32>) -> tensor<128x8x32x64xbf16>
+    %2 = tensor.empty() : tensor<1x4x32x64xbf16>
+    // CHECK: "ttnn.paged_scaled_dot_product_attention_decode"{{.*}}tensor<4x32xsi32{{.*}}tensor<4xsi32
+    %3 = "ttir.paged_scaled_dot_product_attention_decode"(%q, %0, %1, %page_table, %cur_pos, %2) : (tensor<1x4x32x64xbf16>, tensor<128x8x32x64xbf16>, tensor<128x8x32x64xbf16>, tensor<4x32xi32>, tensor<4xi32>, tensor<1x4x32x64xbf16>) -> tensor<1x4x32x64xbf16>
+    return %3 : tensor<1x4x32x64xbf16>
+  }
+}
@@ -0,0 +1,18 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline %s | FileCheck %s
+module attributes {} {
+  func.func @causal(%arg0: tensor<1x8x128x64xbf16>, %arg1: tensor<1x8x128x64xbf16>, %arg2: tensor<1x8x128x64xbf16>) -> tensor<1x8x128x64xbf16> {
+    %0 = tensor.empty() : tensor<1x8x128x64xbf16>
+    // CHECK: "ttnn.scaled_dot_product_attention"
+    // CHECK-SAME: is_causal = true
+    %1 = "ttir.scaled_dot_product_attention"(%arg0, %arg1, %arg2, %0) <{is_causal = true}> : (tensor<1x8x128x64xbf16>, tensor<1x8x128x64xbf16>, tensor<1x8x128x64xbf16>, tensor<1x8x128x64xbf16>) -> tensor<1x8x128x64xbf16>
+    return %1 : tensor<1x8x128x64xbf16>
+  }
+
+  func.func @masked_gqa(%arg0: tensor<1x8x128x64xbf16>, %arg1: tensor<1x2x128x64xbf16>, %arg2: tensor<1x2x128x64xbf16>, %arg3: tensor<1x1x128x128xbf16>) -> tensor<1x8x128x64xbf16> {
+    %0 = tensor.empty() : tensor<1x8x128x64xbf16>
+    // CHECK: "ttnn.scaled_dot_product_attention"
+    // CHECK-SAME: scale = 1.250000e-01 : f32
+    %1 = "ttir.scaled_dot_product_attention"(%arg0, %arg1, %arg2, %arg3, %0) <{scale = 0.125 : f32}> : (tensor<1x8x128x64xbf16>, tensor<1x2x128x64xbf16>, tensor<1x2x128x64xbf16>, tensor<1x1x128x128xbf16>, tensor<1x8x128x64xbf16>) -> tensor<1x8x128x64xbf16>
+    return %1 : tensor<1x8x128x64xbf16>
+  }
+}
@@ -0,0 +1,19 @@
+// RUN: ttmlir-opt --ttir-to-ttmetal-backend-pipeline="system-desc-path=%system_desc_path% enable-multicast=true" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttmetal-to-flatbuffer %t.mlir > %t.ttm
+#l1_ = #tt.memory_space<l1>
+#layout_lhs = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <2x4>, memref<32x2048xf32, #l1_>>
+#layout_rhs = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <4x2>, memref<2048x32xf32, #l1_>>
+#layout_out = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <2x2>, memref<32x32xf32, #l1_>>
+
+// Same as matmul_multicore.mlir, with the K blocks of A (B) read once per row
+// (column) of cores and multicast to the rest of it.
+func.func @matmul(%arg0: tensor<64x8192xf32, #layout_lhs>, %arg1: tensor<8192x64xf32, #layout_rhs>) -> tensor<64x64xf32, #layout_out> {
+  %0 = tensor.empty() : tensor<64x64xf32, #layout_out>
+  // CHECK: "ttmetal.enqueue_program"
+  // CHECK: "ttkernel.matmul_tiles"
+  // CHECK: "ttkernel.noc_async_write_multicast_loopback_src"
+  // CHECK: "ttkernel.noc_semaphore_inc"
+  %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<64x8192xf32, #layout_lhs>, tensor<8192x64xf32, #layout_rhs>, tensor<64x64xf32, #layout_out>) -> tensor<64x64xf32, #layout_out>
+  return %1 : tensor<64x64xf32, #layout_out>
+}
@@ -0,0 +1,30 @@
+// RUN: ttmlir-opt --ttir-to-ttmetal-backend-pipeline="system-desc-path=%system_desc_path%" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttmetal-to-flatbuffer %t.mlir > %t.ttm
+#l1_ = #tt.memory_space<l1>
+#layout_lhs = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <2x4>, memref<32x2048xf32, #l1_>>
+#layout_rhs = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <4x2>, memref<2048x32xf32, #l1_>>
+#layout_out = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <2x2>, memref<32x32xf32, #l1_>>
+
+// K is too large to stream whole, so the inputs are read in double-buffered
+// K blocks and partial sums are carried between blocks in an intermediate CB.
+func.func @matmul(%arg0: tensor<64x8192xf32, #layout_lhs>, %arg1: tensor<8192x64xf32, #layout_rhs>) -> tensor<64x64xf32, #layout_out> {
+  %0 = tensor.empty() : tensor<64x64xf32, #layout_out>
+  // CHECK: "ttmetal.enqueue_program"
+  // CHECK: "ttkernel.mm_init"
+  // CHECK: "ttkernel.cb_wait_front"(%{{.*}}, %{{.*}}) : (!ttkernel.cb<{{.*}}, 2>, i32)
+  // CHECK: "ttkernel.tile_regs_acquire"
+  // CHECK: "ttkernel.matmul_tiles"
+  // CHECK: "ttkernel.tile_regs_commit"
+  // CHECK: "ttkernel.pack_tile"
+  // CHECK: "ttkernel.cb_push_back"
+  // CHECK: "ttkernel.copy_tile"
+  // CHECK: "ttkernel.mm_init_short"
+  // CHECK: "ttkernel.matmul_tiles"
+  // Readers fill the CB rings one K block at a time.
+  // CHECK: "ttkernel.cb_reserve_back"
+  // CHECK: "ttkernel.noc_async_read"
+  // CHECK: "ttkernel.cb_push_back"
+  %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<64x8192xf32, #layout_lhs>, tensor<8192x64xf32, #layout_rhs>, tensor<64x64xf32, #layout_out>) -> tensor<64x64xf32, #layout_out>
+  return %1 : tensor<64x64xf32, #layout_out>
+}
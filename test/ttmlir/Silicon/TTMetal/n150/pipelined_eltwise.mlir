@@ -0,0 +1,29 @@
+// RUN: ttmlir-opt --ttir-to-ttmetal-backend-pipeline="system-desc-path=%system_desc_path% num-stream-buffers=2" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttmetal-to-flatbuffer %t.mlir > %t.ttm
+#l1_ = #tt.memory_space<l1>
+#layout_in = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <2x1>, memref<64x64xf32, #l1_>>
+#layout_out = #tt.metal_layout<(d0, d1) -> (d0, d1), undef, <1x1>, memref<128x64xf32, #l1_>>
+
+// Inputs are sharded on a different grid than the op, so they are streamed
+// into double-buffered CBs that hold a single row of tiles per buffer.
+func.func @add(%arg0: tensor<128x64xf32, #layout_in>, %arg1: tensor<128x64xf32, #layout_in>) -> tensor<128x64xf32, #layout_out> {
+  %0 = tensor.empty() : tensor<128x64xf32, #layout_out>
+  // CHECK: "ttmetal.enqueue_program"
+  // Compute kernel waits for and releases one block per outer loop iteration.
+  // CHECK: scf.for
+  // CHECK: "ttkernel.cb_wait_front"(%{{.*}}, %{{.*}}) : (!ttkernel.cb<{{.*}}memref<1x2x!tt.tile<{{.*}}>, {{[0-9]+}}, 2>, i32)
+  // CHECK: scf.for
+  // CHECK: "ttkernel.add_tiles"
+  // CHECK: "ttkernel.cb_pop_front"
+  // Reader fills the CB ring one block at a time.
+  // CHECK: "ttkernel.noc_transactions_table"
+  // CHECK: scf.for
+  // CHECK: "ttkernel.cb_reserve_back"
+  // CHECK: scf.for
+  // CHECK: "ttkernel.noc_async_read"
+  // CHECK: "ttkernel.noc_async_read_barrier"
+  // CHECK: "ttkernel.cb_push_back"
+  %1 = "ttir.add"(%arg0, %arg1, %0) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<128x64xf32, #layout_in>, tensor<128x64xf32, #layout_in>, tensor<128x64xf32, #layout_out>) -> tensor<128x64xf32, #layout_out>
+  return %1 : tensor<128x64xf32, #layout_out>
+}
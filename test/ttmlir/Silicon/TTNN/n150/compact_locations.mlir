@@ -0,0 +1,31 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path%" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer --ttnn-compact-locations %t.mlir > %t.ttnn
+// RUN: ttrt read --section all %t.ttnn 2>&1 | FileCheck %s --check-prefix=BINARY --implicit-check-not='"loc_info"'
+
+// Ops store the ID of their location, each location is stored once.
+// BINARY: "operations": [
+// BINARY: "loc_id": {{[0-9]+}}
+// BINARY: "locations": [
+// BINARY-DAG: "loc(\"add\")"
+// BINARY-DAG: "loc(\"multiply\")"
+// BINARY: ]
+
+module {
+  func.func @add(%arg0: tensor<64x128xf32>, %arg1: tensor<64x128xf32>) -> tensor<64x128xf32> {
+    %0 = tensor.empty() : tensor<64x128xf32>
+    // CHECK: {{.*}} = "ttnn.add"({{.*}}) {{.*}}
+    %1 = "ttir.add"(%arg0, %arg1, %0) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<64x128xf32>, tensor<64x128xf32>, tensor<64x128xf32>) -> tensor<64x128xf32> loc("add")
+    return %1 : tensor<64x128xf32>
+  }
+
+  func.func @multiply(%arg0: tensor<64x128xf32>, %arg1: tensor<64x128xf32>) -> tensor<64x128xf32> {
+    %0 = tensor.empty() : tensor<64x128xf32>
+    // CHECK: {{.*}} = "ttnn.multiply"({{.*}}) {{.*}}
+    %1 = "ttir.multiply"(%arg0, %arg1, %0) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<64x128xf32>, tensor<64x128xf32>, tensor<64x128xf32>) -> tensor<64x128xf32> loc("multiply")
+    %2 = tensor.empty() : tensor<64x128xf32>
+    // CHECK: {{.*}} = "ttnn.add"({{.*}}) {{.*}}
+    %3 = "ttir.add"(%1, %arg1, %2) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<64x128xf32>, tensor<64x128xf32>, tensor<64x128xf32>) -> tensor<64x128xf32> loc("multiply")
+    return %3 : tensor<64x128xf32>
+  }
+}
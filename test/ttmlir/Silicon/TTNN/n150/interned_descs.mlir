@@ -0,0 +1,21 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path%" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %t.ttnn
+// RUN: ttmlir-translate --ttnn-to-flatbuffer --ttnn-intern-descs=false %t.mlir > %t.not_interned.ttnn
+// RUN: %python -c "import os, sys; sys.exit(os.path.getsize(sys.argv[1]) >= os.path.getsize(sys.argv[2]))" %t.ttnn %t.not_interned.ttnn
+
+// The reshaped tensors have different layout attributes that only differ in
+// their linear map, so they share a single layout desc in the flatbuffer, which
+// is then smaller than without interning.
+func.func @reshape_add(%arg0: tensor<1x1x64x128xbf16>, %arg1: tensor<64x128xbf16>) -> tensor<1x1x64x128xbf16> {
+  %0 = tensor.empty() : tensor<64x128xbf16>
+  // CHECK: "ttnn.reshape"
+  %1 = "ttir.reshape"(%arg0, %0) <{shape = [64: i32, 128: i32]}> : (tensor<1x1x64x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+  %2 = tensor.empty() : tensor<64x128xbf16>
+  // CHECK: "ttnn.add"
+  %3 = "ttir.add"(%1, %arg1, %2) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<64x128xbf16>, tensor<64x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+  %4 = tensor.empty() : tensor<1x1x64x128xbf16>
+  // CHECK: "ttnn.reshape"
+  %5 = "ttir.reshape"(%3, %4) <{shape = [1: i32, 1: i32, 64: i32, 128: i32]}> : (tensor<64x128xbf16>, tensor<1x1x64x128xbf16>) -> tensor<1x1x64x128xbf16>
+  return %5 : tensor<1x1x64x128xbf16>
+}
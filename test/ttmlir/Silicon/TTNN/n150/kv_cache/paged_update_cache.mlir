@@ -0,0 +1,10 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path%" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %t.ttnn
+module {
+  func.func @forward(%arg0: tensor<128x8x32x64xbf16>, %arg1: tensor<1x4x8x64xbf16>, %arg2: tensor<4xi32>, %arg3: tensor<4x32xi32>) -> tensor<128x8x32x64xbf16> {
+    // CHECK: "ttnn.paged_update_cache"{{.*}}tensor<4xsi32{{.*}}tensor<4x32xsi32
+    %0 = "ttir.paged_update_cache"(%arg0, %arg1, %arg2, %arg3) : (tensor<128x8x32x64xbf16>, tensor<1x4x8x64xbf16>, tensor<4xi32>, tensor<4x32xi32>) -> tensor<128x8x32x64xbf16>
+    return %0 : tensor<128x8x32x64xbf16>
+  }
+}
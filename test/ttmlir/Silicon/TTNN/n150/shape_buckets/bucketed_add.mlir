@@ -0,0 +1,20 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path% shape-buckets=32,64" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %t.ttnn
+module {
+  // CHECK-LABEL: func.func @forward_bucket_32
+  // CHECK-SAME: tt.shape_bucket = #tt.shape_bucket<group = "forward", size = 32
+  // CHECK: "ttnn.add"
+  // CHECK-SAME: -> tensor<1x32x64xbf16
+  // CHECK-LABEL: func.func @forward_bucket_64
+  // CHECK-SAME: tt.shape_bucket = #tt.shape_bucket<group = "forward", size = 64
+  // CHECK: "ttnn.add"
+  // CHECK-SAME: -> tensor<1x64x64xbf16
+  func.func @forward(%arg0: tensor<1x?x64xbf16>, %arg1: tensor<1x?x64xbf16>) -> tensor<1x?x64xbf16> {
+    %c1 = arith.constant 1 : index
+    %dim = tensor.dim %arg0, %c1 : tensor<1x?x64xbf16>
+    %0 = tensor.empty(%dim) : tensor<1x?x64xbf16>
+    %1 = "ttir.add"(%arg0, %arg1, %0) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<1x?x64xbf16>, tensor<1x?x64xbf16>, tensor<1x?x64xbf16>) -> tensor<1x?x64xbf16>
+    return %1 : tensor<1x?x64xbf16>
+  }
+}
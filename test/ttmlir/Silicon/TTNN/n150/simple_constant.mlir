@@ -49,4 +49,10 @@ module @sysmem_creation attributes {} {
     // CHECK: %[[C:.*]] = "ttnn.full"[[C:.*]]
     return %0 : tensor<1x1xf32>
   }
+
+  func.func @test_constant_non_splat() -> tensor<2x4xf32> {
+    %0 = "ttir.constant"() <{value = dense<[[1.0, 2.0, 3.0, 4.0], [5.0, 6.0, 7.0, 8.0]]> : tensor<2x4xf32>}> : () -> tensor<2x4xf32>
+    // CHECK: %[[C:.*]] = "ttnn.constant"[[C:.*]]
+    return %0 : tensor<2x4xf32>
+  }
 }
@@ -0,0 +1,11 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path%" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %t.ttnn
+module {
+  func.func @forward(%arg0: tensor<1x8x128x64xbf16>, %arg1: tensor<1x8x128x64xbf16>, %arg2: tensor<1x8x128x64xbf16>) -> tensor<1x8x128x64xbf16> {
+    %0 = tensor.empty() : tensor<1x8x128x64xbf16>
+    // CHECK: "ttnn.scaled_dot_product_attention"[[C:.*]]
+    %1 = "ttir.scaled_dot_product_attention"(%arg0, %arg1, %arg2, %0) <{is_causal = true}> : (tensor<1x8x128x64xbf16>, tensor<1x8x128x64xbf16>, tensor<1x8x128x64xbf16>, tensor<1x8x128x64xbf16>) -> tensor<1x8x128x64xbf16>
+    return %1 : tensor<1x8x128x64xbf16>
+  }
+}
@@ -0,0 +1,25 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="enable-optimizer=true memory-layout-analysis-enabled=true" --ttmlir-compile-report=%t.opt.json %s -o %t.mlir
+// RUN: FileCheck %s --check-prefix=OPT --input-file=%t.opt.json
+// RUN: ttmlir-translate --ttnn-to-flatbuffer --ttmlir-compile-report=%t.translate.json %t.mlir -o %t.ttnn
+// RUN: FileCheck %s --check-prefix=TRANSLATE --input-file=%t.translate.json
+
+// OPT: "wall_time_ms":
+// OPT: "passes": [
+// OPT-DAG: "name": "ttnn-optimizer"
+// OPT-DAG: "name": "ttnn-deallocate"
+// OPT: "analyses": [
+// OPT: "name": "{{.*}}LegalLayoutAnalysis"
+// OPT: "counters": {
+// OPT: "legal-layout-analysis.candidates": {{[1-9][0-9]*}}
+// OPT: "legal-layout-analysis.legal-layouts": {{[1-9][0-9]*}}
+
+// TRANSLATE: "counters": {
+// TRANSLATE: "flatbuffer.bytes.programs": {{[1-9][0-9]*}}
+// TRANSLATE: "flatbuffer.bytes.total": {{[1-9][0-9]*}}
+func.func @forward(%arg0: tensor<64x128xbf16>, %arg1: tensor<128x96xbf16>, %arg2: tensor<64x96xbf16>) -> tensor<64x96xbf16> {
+  %0 = tensor.empty() : tensor<64x96xbf16>
+  %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<64x128xbf16>, tensor<128x96xbf16>, tensor<64x96xbf16>) -> tensor<64x96xbf16>
+  %2 = tensor.empty() : tensor<64x96xbf16>
+  %3 = "ttir.add"(%1, %arg2, %2) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<64x96xbf16>, tensor<64x96xbf16>, tensor<64x96xbf16>) -> tensor<64x96xbf16>
+  return %3 : tensor<64x96xbf16>
+}
@@ -0,0 +1,30 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline %s | ttmlir-translate --ttnn-to-flatbuffer -o %t.ttnn
+// RUN: od -An -tx1 -v %t.ttnn | tr -d ' \n' | FileCheck %s
+
+// The raw little-endian bytes of the constants appear in the tensor data
+// section, negative integers in two's complement.
+module {
+  func.func @constant_si32() -> tensor<4xi32> {
+    // CHECK-DAG: fffffffffeffffff0300000000000080
+    %0 = "ttir.constant"() <{value = dense<[-1, -2, 3, -2147483648]> : tensor<4xi32>}> : () -> tensor<4xi32>
+    return %0 : tensor<4xi32>
+  }
+
+  func.func @constant_ui32() -> tensor<4xui32> {
+    // CHECK-DAG: 01000000ffffffff0500000000000080
+    %0 = "ttir.constant"() <{value = dense<[1, 4294967295, 5, 2147483648]> : tensor<4xui32>}> : () -> tensor<4xui32>
+    return %0 : tensor<4xui32>
+  }
+
+  func.func @constant_si16() -> tensor<4xi16> {
+    // CHECK-DAG: ffffd4fe07000080
+    %0 = "ttir.constant"() <{value = dense<[-1, -300, 7, -32768]> : tensor<4xi16>}> : () -> tensor<4xi16>
+    return %0 : tensor<4xi16>
+  }
+
+  func.func @constant_bf16() -> tensor<4xbf16> {
+    // CHECK-DAG: 803f00c0404000c1
+    %0 = "ttir.constant"() <{value = dense<[1.0, -2.0, 3.0, -8.0]> : tensor<4xbf16>}> : () -> tensor<4xbf16>
+    return %0 : tensor<4xbf16>
+  }
+}
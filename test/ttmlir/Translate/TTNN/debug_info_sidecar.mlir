@@ -0,0 +1,17 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline %s | ttmlir-translate --ttnn-to-flatbuffer --ttnn-debug-info-file=%t.ttnnd -o %t.ttnn
+// RUN: test -s %t.ttnnd
+// The module source is only serialized into the sidecar.
+// RUN: grep -a -q "func.func @add" %t.ttnnd
+// RUN: not grep -a -q "func.func @add" %t.ttnn
+// RUN: head -c 8 %t.ttnn | tail -c 4 | FileCheck %s --check-prefix=BINARY
+// RUN: head -c 8 %t.ttnnd | tail -c 4 | FileCheck %s --check-prefix=SIDECAR
+// A sidecar of another module, the runtime rejects it for %t.ttnn.
+// RUN: sed 's/64x128/32x128/g' %s | ttmlir-opt --ttir-to-ttnn-backend-pipeline | ttmlir-translate --ttnn-to-flatbuffer --ttnn-debug-info-file=%t.other.ttnnd -o %t.other.ttnn
+// RUN: not cmp -s %t.ttnnd %t.other.ttnnd
+// BINARY: TTNN
+// SIDECAR: TTND
+func.func @add(%arg0: tensor<64x128xf32>, %arg1: tensor<64x128xf32>) -> tensor<64x128xf32> {
+  %0 = tensor.empty() : tensor<64x128xf32>
+  %1 = "ttir.add"(%arg0, %arg1, %0) <{operandSegmentSizes = array<i32: 2, 1>}> : (tensor<64x128xf32>, tensor<64x128xf32>, tensor<64x128xf32>) -> tensor<64x128xf32>
+  return %1 : tensor<64x128xf32>
+}
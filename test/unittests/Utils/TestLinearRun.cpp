@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "mlir/IR/AffineExpr.h"
+#include "mlir/IR/AffineMap.h"
+#include "mlir/IR/MLIRContext.h"
+#include "llvm/ADT/SmallVector.h"
+
+#include "ttmlir/Utils.h"
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace mlir;
+
+class LinearRunTest : public ::testing::Test {
+public:
+  MLIRContext context;
+
+  // Shard-like memory map: (d0, d1) -> (0, core_y, core_x, shard_offset) for a
+  // [shape0, shape1] tensor blocked onto a [grid0, grid1] grid.
+  AffineMap getShardedMap(int64_t shape0, int64_t shape1, int64_t grid0,
+                          int64_t grid1, bool transpose = false) {
+    AffineExpr d0 = getAffineDimExpr(transpose ? 1 : 0, &context);
+    AffineExpr d1 = getAffineDimExpr(transpose ? 0 : 1, &context);
+    int64_t shard0 = shape0 / grid0;
+    int64_t shard1 = shape1 / grid1;
+    SmallVector<AffineExpr> results = {
+        getAffineConstantExpr(0, &context), d0.floorDiv(shard0),
+        d1.floorDiv(shard1), (d0 % shard0) * shard1 + d1 % shard1};
+    return AffineMap::get(2, 0, results, &context);
+  }
+
+  // Checks every run reported along the innermost dimension against the
+  // element-wise evaluation of the map.
+  void verifyRuns(AffineMap map, ArrayRef<int64_t> shape) {
+    ::ttmlir::utils::sample(shape, [&](ArrayRef<int64_t> index) {
+      SmallVector<int64_t> point(index);
+      auto runs = ::ttmlir::utils::evalLinearRuns(map, point, 1);
+      std::int64_t extent = shape[1] - point[1];
+      for (auto const &run : runs) {
+        EXPECT_GE(run.extent, 1);
+        extent = std::min(extent, run.extent);
+      }
+      for (std::int64_t t = 0; t < extent; ++t) {
+        SmallVector<int64_t> stepped(point);
+        stepped[1] += t;
+        SmallVector<int64_t> expected = map.compose(stepped);
+        for (unsigned i = 0; i < runs.size(); ++i) {
+          ASSERT_EQ(expected[i], runs[i].value + runs[i].stride * t);
+        }
+      }
+    });
+  }
+};
+
+TEST_F(LinearRunTest, Sharded) {
+  verifyRuns(getShardedMap(16, 24, 1, 1), {16, 24});
+  verifyRuns(getShardedMap(16, 24, 2, 3), {16, 24});
+  verifyRuns(getShardedMap(16, 24, 4, 8), {16, 24});
+}
+
+TEST_F(LinearRunTest, Transposed) {
+  verifyRuns(getShardedMap(24, 16, 2, 2, /*transpose=*/true), {16, 24});
+}
+
+TEST_F(LinearRunTest, CeilDivAndNegativeStride) {
+  AffineExpr d0 = getAffineDimExpr(0, &context);
+  AffineExpr d1 = getAffineDimExpr(1, &context);
+  AffineMap map = AffineMap::get(
+      2, 0,
+      {d1.ceilDiv(3), (d0 - d1).floorDiv(4), (d0 * 2 - d1 * 3) % 5,
+       (d1 * 7 + d0).ceilDiv(6)},
+      &context);
+  verifyRuns(map, {8, 20});
+}
+
+// A row of a sharded map must be covered by one run per shard, so walking an
+// 8k x 8k tensor takes a number of evaluations proportional to the number of
+// rows rather than to the number of elements. The last element of every run is
+// checked against the element-wise evaluation of the map.
+TEST_F(LinearRunTest, LargeShapeWalk) {
+  constexpr int64_t dim = 8192;
+  AffineMap map = getShardedMap(dim, dim, 8, 8);
+
+  int64_t evaluations = 0;
+  int64_t elements = 0;
+  SmallVector<int64_t> point = {0, 0};
+  for (point[0] = 0; point[0] < dim; ++point[0]) {
+    for (point[1] = 0; point[1] < dim;) {
+      auto runs = ::ttmlir::utils::evalLinearRuns(map, point, 1);
+      int64_t extent = dim - point[1];
+      for (auto const &run : runs) {
+        extent = std::min(extent, run.extent);
+      }
+      SmallVector<int64_t> last(point);
+      last[1] += extent - 1;
+      SmallVector<int64_t> expected = map.compose(last);
+      for (unsigned i = 0; i < runs.size(); ++i) {
+        ASSERT_EQ(expected[i], runs[i].value + runs[i].stride * (extent - 1));
+      }
+      ++evaluations;
+      elements += extent;
+      point[1] += extent;
+    }
+  }
+
+  EXPECT_EQ(elements, dim * dim);
+  EXPECT_EQ(evaluations, dim * 8);
+}
@@ -0,0 +1,174 @@
+# SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+This script tracks the compile time of the TTIR to flatbuffer flow on the
+benchmark corpus in test/ttmlir/Benchmarks/CompileTime. Every module is lowered
+with the TTIR to TTNN backend pipeline and translated to a flatbuffer, with
+ttmlir-opt and ttmlir-translate writing a compile report (pass and analysis
+times, and counters such as layouts considered, op model queries and
+flatbuffer bytes per section) next to their outputs.
+
+The summary of a run can be saved and passed as the baseline of a later run,
+which then reports the modules whose compile time regressed by more than the
+threshold and the counters that changed, and exits with an error if any did.
+
+Usage:
+    python tools/scripts/benchmark-compile-time.py \
+        --bin-dir build/bin --save-baseline baseline.json
+    python tools/scripts/benchmark-compile-time.py \
+        --bin-dir build/bin --baseline baseline.json
+
+    --bin-dir: Directory containing ttmlir-opt and ttmlir-translate.
+    --corpus-dir: Directory of TTIR modules to compile.
+    --pipeline-options: Options of the TTIR to TTNN backend pipeline.
+    --system-desc-path: Optional system description for the backend pipeline.
+    --iterations: Number of timed compilations per module.
+    --output-dir: Directory to keep the outputs and compile reports in.
+    --baseline: Summary of an earlier run to compare against.
+    --save-baseline: File to save the summary of this run to.
+    --threshold: Relative compile time increase reported as a regression.
+    --top-passes: Number of slowest passes printed per module.
+"""
+
+import argparse
+import glob
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+DEFAULT_CORPUS_DIR = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)),
+    "..",
+    "..",
+    "test",
+    "ttmlir",
+    "Benchmarks",
+    "CompileTime",
+)
+
+
+def run_with_report(cmd, report_path):
+    subprocess.run(cmd + [f"--ttmlir-compile-report={report_path}"], check=True)
+    with open(report_path) as report_file:
+        return json.load(report_file)
+
+
+def compile_module(args, opt, translate, module_path, out_dir):
+    name = os.path.splitext(os.path.basename(module_path))[0]
+    ttnn_path = os.path.join(out_dir, f"{name}_ttnn.mlir")
+    binary_path = os.path.join(out_dir, f"{name}.ttnn")
+
+    options = args.pipeline_options
+    if args.system_desc_path:
+        options += f" system-desc-path={args.system_desc_path}"
+    opt_cmd = [
+        opt,
+        f"--ttir-to-ttnn-backend-pipeline={options}",
+        module_path,
+        "-o",
+        ttnn_path,
+    ]
+    translate_cmd = [translate, "--ttnn-to-flatbuffer", ttnn_path, "-o", binary_path]
+
+    opt_times, translate_times = [], []
+    for _ in range(args.iterations):
+        opt_report = run_with_report(opt_cmd, f"{ttnn_path}.report.json")
+        translate_report = run_with_report(
+            translate_cmd, f"{binary_path}.report.json"
+        )
+        opt_times.append(opt_report["wall_time_ms"])
+        translate_times.append(translate_report["wall_time_ms"])
+
+    # Counters do not depend on the run, so the last reports are kept.
+    counters = dict(opt_report["counters"])
+    counters.update(translate_report["counters"])
+    slowest_passes = [
+        (p["name"], p["time_ms"]) for p in opt_report["passes"][: args.top_passes]
+    ]
+    return name, {
+        "opt_ms": min(opt_times),
+        "translate_ms": min(translate_times),
+        "slowest_passes": slowest_passes,
+        "counters": counters,
+    }
+
+
+def compare(summary, baseline, threshold):
+    regressed = False
+    for name, result in summary.items():
+        if name not in baseline:
+            continue
+        base = baseline[name]
+        for key in ("opt_ms", "translate_ms"):
+            if result[key] > base[key] * (1 + threshold):
+                regressed = True
+                print(
+                    f"{name}: {key} regressed from {base[key]:.1f} to "
+                    f"{result[key]:.1f}"
+                )
+        for counter in sorted(set(result["counters"]) | set(base["counters"])):
+            old = base["counters"].get(counter, 0)
+            new = result["counters"].get(counter, 0)
+            if old != new:
+                regressed = True
+                print(f"{name}: {counter} changed from {old} to {new}")
+    return regressed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--bin-dir", default="build/bin")
+    parser.add_argument("--corpus-dir", default=DEFAULT_CORPUS_DIR)
+    parser.add_argument(
+        "--pipeline-options",
+        default="enable-optimizer=true memory-layout-analysis-enabled=true",
+    )
+    parser.add_argument("--system-desc-path", default="")
+    parser.add_argument("--iterations", type=int, default=3)
+    parser.add_argument("--output-dir", default="")
+    parser.add_argument("--baseline", default="")
+    parser.add_argument("--save-baseline", default="")
+    parser.add_argument("--threshold", type=float, default=0.1)
+    parser.add_argument("--top-passes", type=int, default=3)
+    args = parser.parse_args()
+
+    opt = os.path.join(args.bin_dir, "ttmlir-opt")
+    translate = os.path.join(args.bin_dir, "ttmlir-translate")
+    modules = sorted(glob.glob(os.path.join(args.corpus_dir, "*.mlir")))
+    if not modules:
+        print(f"No modules found in {args.corpus_dir}")
+        return 1
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        out_dir = args.output_dir or temp_dir
+        os.makedirs(out_dir, exist_ok=True)
+        summary = dict(
+            compile_module(args, opt, translate, module, out_dir)
+            for module in modules
+        )
+
+    for name, result in summary.items():
+        passes = ", ".join(f"{p} {t:.1f} ms" for p, t in result["slowest_passes"])
+        print(
+            f"{name:>20}: ttmlir-opt {result['opt_ms']:.1f} ms, "
+            f"ttmlir-translate {result['translate_ms']:.1f} ms ({passes})"
+        )
+
+    if args.save_baseline:
+        with open(args.save_baseline, "w") as baseline_file:
+            json.dump(summary, baseline_file, indent=2)
+
+    if args.baseline:
+        with open(args.baseline) as baseline_file:
+            baseline = json.load(baseline_file)
+        if compare(summary, baseline, args.threshold):
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,125 @@
+# SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+This script measures how long ttmlir-translate takes to serialize large TTNN
+modules to flatbuffers. It generates a TTIR module with a number of functions,
+each a chain of eltwise ops with distinct locations, lowers it once with the
+TTIR to TTNN backend pipeline, and then times the translation with printed
+locations, with compact locations, and with threading disabled.
+
+Usage:
+    python tools/scripts/benchmark-ttnn-to-flatbuffer.py \
+        --bin-dir build/bin --funcs 4 --ops-per-func 25000
+
+    --bin-dir: Directory containing ttmlir-opt and ttmlir-translate.
+    --funcs: Number of functions in the generated module.
+    --ops-per-func: Number of eltwise ops in each function.
+    --iterations: Number of timed translations per configuration.
+    --system-desc-path: Optional system description for the backend pipeline.
+"""
+
+import argparse
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+SHAPE = "tensor<32x32xbf16>"
+
+
+def generate_ttir_module(num_funcs, ops_per_func):
+    lines = ["module {"]
+    for func_idx in range(num_funcs):
+        lines.append(
+            f"  func.func @forward_{func_idx}(%arg0: {SHAPE}, %arg1: {SHAPE})"
+            f" -> {SHAPE} {{"
+        )
+        prev = "%arg0"
+        for op_idx in range(ops_per_func):
+            empty = f"%e{op_idx}"
+            result = f"%r{op_idx}"
+            lines.append(f"    {empty} = tensor.empty() : {SHAPE}")
+            lines.append(
+                f'    {result} = "ttir.add"({prev}, %arg1, {empty}) '
+                "<{operandSegmentSizes = array<i32: 2, 1>}> : "
+                f"({SHAPE}, {SHAPE}, {SHAPE}) -> {SHAPE} "
+                f'loc("forward_{func_idx}/add_{op_idx}")'
+            )
+            prev = result
+        lines.append(f"    return {prev} : {SHAPE}")
+        lines.append("  }")
+    lines.append("}")
+    return "\n".join(lines) + "\n"
+
+
+def time_translation(translate, ttnn_path, extra_args, iterations, out_dir):
+    out_path = os.path.join(out_dir, "out.ttnn")
+    debug_info_path = os.path.join(out_dir, "out.ttnnd")
+    cmd = [
+        translate,
+        "--ttnn-to-flatbuffer",
+        f"--ttnn-debug-info-file={debug_info_path}",
+        ttnn_path,
+        "-o",
+        out_path,
+    ] + extra_args
+    timings = []
+    for _ in range(iterations):
+        start = time.perf_counter()
+        subprocess.run(cmd, check=True)
+        timings.append(time.perf_counter() - start)
+    return timings, os.path.getsize(out_path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--bin-dir", default="build/bin")
+    parser.add_argument("--funcs", type=int, default=4)
+    parser.add_argument("--ops-per-func", type=int, default=25000)
+    parser.add_argument("--iterations", type=int, default=3)
+    parser.add_argument("--system-desc-path", default="")
+    args = parser.parse_args()
+
+    opt = os.path.join(args.bin_dir, "ttmlir-opt")
+    translate = os.path.join(args.bin_dir, "ttmlir-translate")
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        ttir_path = os.path.join(temp_dir, "module.mlir")
+        ttnn_path = os.path.join(temp_dir, "module_ttnn.mlir")
+        with open(ttir_path, "w") as ttir_file:
+            ttir_file.write(generate_ttir_module(args.funcs, args.ops_per_func))
+
+        pipeline = "--ttir-to-ttnn-backend-pipeline"
+        if args.system_desc_path:
+            pipeline += f'="system-desc-path={args.system_desc_path}"'
+        subprocess.run(
+            [opt, pipeline, ttir_path, "-o", ttnn_path, "--mlir-print-debuginfo"],
+            check=True,
+        )
+
+        configs = [
+            ("printed locations", []),
+            ("compact locations", ["--ttnn-compact-locations"]),
+            ("single threaded", ["--mlir-disable-threading"]),
+        ]
+        print(
+            f"{args.funcs} functions x {args.ops_per_func} ops, "
+            f"{args.iterations} iterations"
+        )
+        for name, extra_args in configs:
+            timings, size = time_translation(
+                translate, ttnn_path, extra_args, args.iterations, temp_dir
+            )
+            print(
+                f"{name:>20}: min {min(timings):.3f} s, "
+                f"mean {statistics.mean(timings):.3f} s, "
+                f"binary {size / 1024:.0f} KiB"
+            )
+
+
+if __name__ == "__main__":
+    sys.exit(main())
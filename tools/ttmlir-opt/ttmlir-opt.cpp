@@ -5,10 +5,57 @@
 #include "mlir/IR/MLIRContext.h"
 #include "mlir/InitAllDialects.h"
 #include "mlir/InitAllPasses.h"
+#include "mlir/Pass/PassManager.h"
 #include "mlir/Support/FileUtilities.h"
 #include "mlir/Tools/mlir-opt/MlirOptMain.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/ToolOutputFile.h"
 
 #include "ttmlir/RegisterAll.h"
+#include "ttmlir/Support/CompileReport.h"
+
+static llvm::cl::opt<std::string> compileReportPath(
+    "ttmlir-compile-report",
+    llvm::cl::desc("Write pass timings and compiler counters as JSON to the "
+                   "given file"),
+    llvm::cl::value_desc("filename"),
+    llvm::cl::cb<void, const std::string &>(
+        [](const std::string &) { mlir::tt::compile_report::enable(); }));
+
+// Same as MlirOptMain, but with the pass pipeline instrumented for the
+// compile report.
+static mlir::LogicalResult
+runWithCompileReport(llvm::StringRef inputFilename,
+                     llvm::StringRef outputFilename,
+                     mlir::DialectRegistry &registry) {
+  mlir::MlirOptMainConfig config =
+      mlir::MlirOptMainConfig::createFromCLOptions();
+  mlir::MlirOptMainConfig pipelineConfig = config;
+  config.setPassPipelineSetupFn([pipelineConfig](mlir::PassManager &pm) {
+    pm.addInstrumentation(
+        mlir::tt::compile_report::createTimingInstrumentation());
+    return pipelineConfig.setupPassPipeline(pm);
+  });
+
+  std::string errorMessage;
+  auto file = mlir::openInputFile(inputFilename, &errorMessage);
+  if (!file) {
+    llvm::errs() << errorMessage << "\n";
+    return mlir::failure();
+  }
+  auto output = mlir::openOutputFile(outputFilename, &errorMessage);
+  if (!output) {
+    llvm::errs() << errorMessage << "\n";
+    return mlir::failure();
+  }
+  if (mlir::failed(
+          mlir::MlirOptMain(output->os(), std::move(file), registry, config))) {
+    return mlir::failure();
+  }
+  output->keep();
+
+  return mlir::tt::compile_report::writeReport(compileReportPath);
+}
 
 int main(int argc, char **argv) {
   mlir::registerAllPasses();
@@ -18,6 +65,13 @@ int main(int argc, char **argv) {
   mlir::tt::registerAllDialects(registry);
   mlir::tt::registerAllExtensions(registry);
 
-  return mlir::asMainReturnCode(
-      mlir::MlirOptMain(argc, argv, "ttmlir optimizer driver\n", registry));
+  auto [inputFilename, outputFilename] = mlir::registerAndParseCLIOptions(
+      argc, argv, "ttmlir optimizer driver\n", registry);
+
+  if (mlir::tt::compile_report::isEnabled()) {
+    return mlir::asMainReturnCode(
+        runWithCompileReport(inputFilename, outputFilename, registry));
+  }
+  return mlir::asMainReturnCode(mlir::MlirOptMain(
+      argc, argv, inputFilename, outputFilename, registry));
 }
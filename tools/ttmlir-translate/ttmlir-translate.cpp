@@ -5,8 +5,11 @@
 #include "mlir/InitAllTranslations.h"
 #include "mlir/Support/LogicalResult.h"
 #include "mlir/Tools/mlir-translate/MlirTranslateMain.h"
+#include "llvm/Support/CommandLine.h"
 #include <mlir/IR/DialectRegistry.h>
 
+#include "ttmlir/Support/CompileReport.h"
+
 using namespace mlir;
 
 namespace mlir::tt::ttnn {
@@ -26,6 +29,14 @@ void registerTensixKernelToCpp();
 void registerNocKernelToCpp();
 } // namespace mlir::tt::ttkernel
 
+static llvm::cl::opt<std::string> compileReportPath(
+    "ttmlir-compile-report",
+    llvm::cl::desc("Write compiler counters of the translation as JSON to the "
+                   "given file"),
+    llvm::cl::value_desc("filename"),
+    llvm::cl::cb<void, const std::string &>(
+        [](const std::string &) { mlir::tt::compile_report::enable(); }));
+
 // Place to register all the custom translations
 static void registerCustomTranslations() {
   static bool initOnce = []() {
@@ -44,5 +55,11 @@ int main(int argc, char **argv) {
   registerAllTranslations();
   registerCustomTranslations();
 
-  return failed(mlirTranslateMain(argc, argv, "MLIR Translation Testing Tool"));
+  if (failed(mlirTranslateMain(argc, argv, "MLIR Translation Testing Tool"))) {
+    return 1;
+  }
+  if (mlir::tt::compile_report::isEnabled()) {
+    return failed(mlir::tt::compile_report::writeReport(compileReportPath));
+  }
+  return 0;
 }
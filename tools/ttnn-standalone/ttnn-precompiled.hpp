@@ -26,10 +26,12 @@
 #include "tensor/tensor.hpp"
 #include "tensor/types.hpp"
 #include "tt-metalium/bfloat16.hpp"
+#include "tt-metalium/host_api.hpp"
 #include "tt-metalium/small_vector.hpp"
 #include "types.hpp"
 // ANCHOR_END: standalone_includes
 
+#include <chrono>
 #include <cstddef>
 #include <iostream>
 #include <vector>
@@ -58,6 +60,33 @@ public:
   ttnn::IDevice *device;
 };
 
+// Runs `fn` on `args` once to warm up and then `iterations` more times,
+// printing the latency of each run. Every run waits for the device to finish
+// its work, so latencies include the device time.
+//
+template <typename Fn, typename... Args>
+void benchmark(const char *name, std::size_t iterations, Fn &&fn,
+               const Args &...args) {
+  fn(args...);
+  tt::tt_metal::Synchronize(DeviceGetter::getInstance());
+
+  double totalMs = 0;
+  for (std::size_t i = 0; i < iterations; i++) {
+    auto start = std::chrono::steady_clock::now();
+    fn(args...);
+    tt::tt_metal::Synchronize(DeviceGetter::getInstance());
+    std::chrono::duration<double, std::milli> latency =
+        std::chrono::steady_clock::now() - start;
+    totalMs += latency.count();
+    std::cout << name << " iteration " << i << ": " << latency.count()
+              << " ms" << std::endl;
+  }
+  if (iterations > 0) {
+    std::cout << name << " average: " << totalMs / iterations << " ms"
+              << std::endl;
+  }
+}
+
 } // namespace ttnn
 
 #endif // TOOLS_TTNN_STANDALONE_TTNN_PRECOMPILED_HPP
@@ -3,18 +3,20 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "ttnn-precompiled.hpp"
-ttnn::Tensor add(ttnn::Tensor v1, ttnn::Tensor v2) {
+static const ttnn::MemoryConfig & memory_config_0 = ttnn::MemoryConfig(ttnn::TensorMemoryLayout::INTERLEAVED, ttnn::BufferType::DRAM);
+static const ttnn::Shape & shape_1 = ttnn::Shape(tt::tt_metal::LegacyShape({32, 32, }));
+ttnn::Tensor add(const ttnn::Tensor & v1, const ttnn::Tensor & v2) {
   ttnn::IDevice* v3 = ttnn::DeviceGetter::getInstance();
-  ttnn::MemoryConfig v4 = ttnn::MemoryConfig(ttnn::TensorMemoryLayout::INTERLEAVED, ttnn::BufferType::DRAM);
+  const ttnn::MemoryConfig & v4 = memory_config_0;
   ttnn::Tensor v5 = ttnn::to_device(v1, v3, v4);
   ttnn::Tensor v6 = ttnn::to_layout(v5, ttnn::Layout::TILE, std::nullopt, std::nullopt, static_cast<::ttnn::IDevice *>(nullptr));
   ttnn::deallocate(v5, false);
-  ttnn::MemoryConfig v7 = ttnn::MemoryConfig(ttnn::TensorMemoryLayout::INTERLEAVED, ttnn::BufferType::DRAM);
+  const ttnn::MemoryConfig & v7 = memory_config_0;
   ttnn::Tensor v8 = ttnn::to_device(v2, v3, v7);
   ttnn::Tensor v9 = ttnn::to_layout(v8, ttnn::Layout::TILE, std::nullopt, std::nullopt, static_cast<::ttnn::IDevice *>(nullptr));
   ttnn::deallocate(v8, false);
-  ttnn::Shape v10 = ttnn::Shape(tt::tt_metal::LegacyShape({32, 32, }));
-  ttnn::MemoryConfig v11 = ttnn::MemoryConfig(ttnn::TensorMemoryLayout::INTERLEAVED, ttnn::BufferType::DRAM);
+  const ttnn::Shape & v10 = shape_1;
+  const ttnn::MemoryConfig & v11 = memory_config_0;
   ttnn::Tensor v12 = ttnn::empty(v10, ttnn::DataType::BFLOAT16, ttnn::Layout::TILE, v3, v11);
   ttnn::Tensor v13 = ttnn::add(v6, v9, std::nullopt, std::nullopt, v12);
   ttnn::deallocate(v9, false);
@@ -27,9 +29,9 @@ ttnn::Tensor add(ttnn::Tensor v1, ttnn::Tensor v2) {
 }
 
 std::tuple<ttnn::Tensor, ttnn::Tensor> createInputsFor_add() {
-  ttnn::Shape v1 = ttnn::Shape(tt::tt_metal::LegacyShape({32, 32, }));
+  const ttnn::Shape & v1 = shape_1;
   ttnn::Tensor v2 = ttnn::ones(v1, ttnn::DataType::BFLOAT16, ttnn::Layout::ROW_MAJOR, std::nullopt, std::nullopt);
-  ttnn::Shape v3 = ttnn::Shape(tt::tt_metal::LegacyShape({32, 32, }));
+  const ttnn::Shape & v3 = shape_1;
   ttnn::Tensor v4 = ttnn::ones(v3, ttnn::DataType::BFLOAT16, ttnn::Layout::ROW_MAJOR, std::nullopt, std::nullopt);
   return std::make_tuple(v2, v4);
 }
@@ -38,7 +40,9 @@ int32_t main() {
   ttnn::Tensor v1;
   ttnn::Tensor v2;
   std::tie(v1, v2) = createInputsFor_add();
-  ttnn::Tensor v3 = add(v1, v2);
-  int32_t v4 = 0;
-  return v4;
+  const ttnn::Tensor & v3 = (const ttnn::Tensor &) v1;
+  const ttnn::Tensor & v4 = (const ttnn::Tensor &) v2;
+  ttnn::Tensor v5 = add(v3, v4);
+  int32_t v6 = 0;
+  return v6;
 }